@@ -269,6 +269,7 @@ function(tinyorm_sources out_headers out_sources)
         query/processors/processor.hpp
         query/processors/sqliteprocessor.hpp
         query/querybuilder.hpp
+        query/querycache.hpp
         schema.hpp
         schema/blueprint.hpp
         schema/columndefinition.hpp
@@ -289,6 +290,7 @@ function(tinyorm_sources out_headers out_sources)
         sqliteconnection.hpp
         support/databaseconfiguration.hpp
         support/databaseconnectionsmap.hpp
+        support/deferredtouches.hpp
         support/replacebindings.hpp
         types/aboutvalue.hpp
         types/log.hpp
@@ -345,23 +347,33 @@ function(tinyorm_sources out_headers out_sources)
             tiny/relations/relationproxies.hpp
             tiny/relations/relationtypes.hpp
             tiny/softdeletes.hpp
+            tiny/support/identitymap.hpp
+            tiny/support/modelmetadata.hpp
             tiny/support/stores/baserelationstore.hpp
             tiny/support/stores/belongstomanyrelatedtablestore.hpp
+            tiny/support/stores/countercacherelationstore.hpp
+            tiny/support/stores/dispatchrelationstore.hpp
             tiny/support/stores/eagerrelationstore.hpp
+            tiny/support/stores/joinrelationstore.hpp
             tiny/support/stores/lazyrelationstore.hpp
-            tiny/support/stores/pushrelationstore.hpp
             tiny/support/stores/queriesrelationshipsstore.hpp
-            tiny/support/stores/serializerelationstore.hpp
             tiny/support/stores/touchownersrelationstore.hpp
             tiny/tinybuilder.hpp
             tiny/tinybuilderproxies.hpp
             tiny/tinyconcepts.hpp
             tiny/tinytypes.hpp
+            tiny/typedcolumns.hpp
+            tiny/types/attributeshash.hpp
+            tiny/types/attributeslayout.hpp
             tiny/types/connectionoverride.hpp
+            tiny/types/copyonwrite.hpp
             tiny/types/modelattributes.hpp
             tiny/types/modelscollection.hpp
             tiny/types/syncchanges.hpp
+            tiny/unitofwork.hpp
             tiny/utils/attribute.hpp
+            tiny/utils/cbor.hpp
+            tiny/utils/json.hpp
         )
     endif()
 
@@ -416,9 +428,11 @@ function(tinyorm_sources out_headers out_sources)
         query/grammars/postgresgrammar.cpp
         query/grammars/sqlitegrammar.cpp
         query/joinclause.cpp
+        query/processors/postgresprocessor.cpp
         query/processors/processor.cpp
         query/processors/sqliteprocessor.cpp
         query/querybuilder.cpp
+        query/querycache.cpp
         schema.cpp
         schema/blueprint.cpp
         schema/foreignidcolumndefinitionreference.cpp
@@ -433,6 +447,7 @@ function(tinyorm_sources out_headers out_sources)
         schema/schemabuilder.cpp
         schema/sqliteschemabuilder.cpp
         sqliteconnection.cpp
+        support/deferredtouches.cpp
         types/sqlquery.cpp
         utils/configuration.cpp
         utils/fs.cpp
@@ -450,8 +465,12 @@ function(tinyorm_sources out_headers out_sources)
             tiny/exceptions/modelnotfounderror.cpp
             tiny/exceptions/relationmappingnotfounderror.cpp
             tiny/exceptions/relationnotloadederror.cpp
+            tiny/support/identitymap.cpp
             tiny/tinytypes.cpp
+            tiny/unitofwork.cpp
             tiny/utils/attribute.cpp
+            tiny/utils/cbor.cpp
+            tiny/utils/json.cpp
         )
     endif()
 
@@ -484,6 +503,7 @@ function(tinytom_sources out_headers out_sources)
         commands/aboutcommand.hpp
         commands/command.hpp
         commands/completecommand.hpp
+        commands/database/rebuildcounterscommand.hpp
         commands/database/seedcommand.hpp
         commands/database/wipecommand.hpp
         commands/environmentcommand.hpp
@@ -555,6 +575,7 @@ function(tinytom_sources out_headers out_sources)
         commands/aboutcommand.cpp
         commands/command.cpp
         commands/completecommand.cpp
+        commands/database/rebuildcounterscommand.cpp
         commands/database/seedcommand.cpp
         commands/database/wipecommand.cpp
         commands/environmentcommand.cpp
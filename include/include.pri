@@ -87,6 +87,7 @@ headersList += \
     $$PWD/orm/query/processors/processor.hpp \
     $$PWD/orm/query/processors/sqliteprocessor.hpp \
     $$PWD/orm/query/querybuilder.hpp \
+    $$PWD/orm/query/querycache.hpp \
     $$PWD/orm/schema.hpp \
     $$PWD/orm/schema/blueprint.hpp \
     $$PWD/orm/schema/columndefinition.hpp \
@@ -107,6 +108,7 @@ headersList += \
     $$PWD/orm/sqliteconnection.hpp \
     $$PWD/orm/support/databaseconfiguration.hpp \
     $$PWD/orm/support/databaseconnectionsmap.hpp \
+    $$PWD/orm/support/deferredtouches.hpp \
     $$PWD/orm/support/replacebindings.hpp \
     $$PWD/orm/types/aboutvalue.hpp \
     $$PWD/orm/types/log.hpp \
@@ -162,23 +164,33 @@ headersList += \
         $$PWD/orm/tiny/relations/relationproxies.hpp \
         $$PWD/orm/tiny/relations/relationtypes.hpp \
         $$PWD/orm/tiny/softdeletes.hpp \
+        $$PWD/orm/tiny/support/identitymap.hpp \
+        $$PWD/orm/tiny/support/modelmetadata.hpp \
         $$PWD/orm/tiny/support/stores/baserelationstore.hpp \
         $$PWD/orm/tiny/support/stores/belongstomanyrelatedtablestore.hpp \
+        $$PWD/orm/tiny/support/stores/countercacherelationstore.hpp \
+        $$PWD/orm/tiny/support/stores/dispatchrelationstore.hpp \
         $$PWD/orm/tiny/support/stores/eagerrelationstore.hpp \
+        $$PWD/orm/tiny/support/stores/joinrelationstore.hpp \
         $$PWD/orm/tiny/support/stores/lazyrelationstore.hpp \
-        $$PWD/orm/tiny/support/stores/pushrelationstore.hpp \
         $$PWD/orm/tiny/support/stores/queriesrelationshipsstore.hpp \
-        $$PWD/orm/tiny/support/stores/serializerelationstore.hpp \
         $$PWD/orm/tiny/support/stores/touchownersrelationstore.hpp \
         $$PWD/orm/tiny/tinybuilder.hpp \
         $$PWD/orm/tiny/tinybuilderproxies.hpp \
         $$PWD/orm/tiny/tinyconcepts.hpp \
         $$PWD/orm/tiny/tinytypes.hpp \
+        $$PWD/orm/tiny/typedcolumns.hpp \
+        $$PWD/orm/tiny/types/attributeshash.hpp \
+        $$PWD/orm/tiny/types/attributeslayout.hpp \
         $$PWD/orm/tiny/types/connectionoverride.hpp \
+        $$PWD/orm/tiny/types/copyonwrite.hpp \
         $$PWD/orm/tiny/types/modelattributes.hpp \
         $$PWD/orm/tiny/types/modelscollection.hpp \
         $$PWD/orm/tiny/types/syncchanges.hpp \
+        $$PWD/orm/tiny/unitofwork.hpp \
         $$PWD/orm/tiny/utils/attribute.hpp \
+        $$PWD/orm/tiny/utils/cbor.hpp \
+        $$PWD/orm/tiny/utils/json.hpp \
 
 HEADERS += $$sorted(headersList)
 
@@ -5,7 +5,7 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
-#include <QString>
+#include <QStringList>
 
 #include "orm/macros/commonnamespace.hpp"
 #include "orm/macros/export.hpp"
@@ -35,7 +35,7 @@ namespace Concerns
     {
         Q_DISABLE_COPY_MOVE(ManagesTransactions)
 
-        // To access resetTransactions() method
+        // To access resetTransactions() method and m_queryCacheTags
         friend DatabaseConnection;
         // To access resetTransactions() method
         friend MySqlConnection;
@@ -121,6 +121,10 @@ namespace Concerns
 
         /*! Namespace prefix for MySQL savepoints. */
         QString m_savepointNamespace;
+
+        /*! Query result cache tags of the tables written in the active transaction,
+            they are invalidated again after the commit (empty for an unknown table). */
+        QStringList m_queryCacheTags;
     };
 
     /* public */
@@ -188,6 +188,7 @@ namespace Orm::Constants
     // Others
     TINYORM_EXPORT extern const QString NotImplemented;
     TINYORM_EXPORT extern const QString dummy_NONEXISTENT;
+    TINYORM_EXPORT extern const QString GroupLimitRow;
 
 } // namespace Orm::Constants
 
@@ -195,6 +195,7 @@ namespace Orm::Constants
     // Others
     inline const QString NotImplemented    = QStringLiteral("Not implemented :/.");
     inline const QString dummy_NONEXISTENT = QStringLiteral("dummy-NON_EXISTENT");
+    inline const QString GroupLimitRow     = QStringLiteral("tinyorm_row");
 
 } // namespace Orm::Constants
 
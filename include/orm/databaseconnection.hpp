@@ -167,6 +167,9 @@ namespace Orm
         inline bool isOpen();
         /*! Check database connection and show warnings when the state changed. */
         virtual bool pingDatabase();
+        /*! Determine whether the IDs generated by one multi-rows insert are
+            consecutive (so they can be computed from the last inserted ID). */
+        virtual bool hasConsecutiveInsertIds();
 
         /*! Get the SQL database driver used to access the database connection (const). */
         const TSqlDriver *driver();
@@ -342,6 +345,9 @@ namespace Orm
         /*! Determine if the elapsed time for queries should be counted. */
         inline bool shouldCountElapsed() const;
 
+        /*! Forget the cached results of the table written by the given statement. */
+        void invalidateQueryCache(const QString &queryString);
+
         /*! Log database connected, invoked during MySQL ping. */
         void logConnected();
         /*! Log database disconnected, invoked during MySQL ping. */
@@ -246,6 +246,11 @@ namespace Orm
         pretend(const std::function<void(DatabaseConnection &)> &callback,
                 const QString &connection = "");
 
+        /* Deferred touches */
+        /*! Execute the given callback and touch the owner models at the end, every
+            owner is touched only once (one update query for every table). */
+        static void withDeferredTouches(const std::function<void()> &callback);
+
         /* Records were modified */
         /*! Check if any records have been modified. */
         static bool getRecordsHaveBeenModified(const QString &connection = "");
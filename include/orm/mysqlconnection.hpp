@@ -53,6 +53,9 @@ namespace Orm
             MySQL reconnection logic is disabled (MYSQL_OPT_RECONNECT), TinyORM has
             own reconnector. */
         bool pingDatabase() final;
+        /*! Determine whether the IDs generated by one multi-rows insert are
+            consecutive (by the auto-increment settings, cached). */
+        bool hasConsecutiveInsertIds() final;
 
     protected:
         /*! Get the default query grammar instance. */
@@ -70,6 +73,8 @@ namespace Orm
         std::optional<bool> m_isMaria = std::nullopt;
         /*! Determine whether to use the upsert alias (by MySQL version >=8.0.19). */
         std::optional<bool> m_useUpsertAlias = std::nullopt;
+        /*! Are the IDs generated by one multi-rows insert consecutive? */
+        std::optional<bool> m_hasConsecutiveInsertIds = std::nullopt;
     };
 
     /* public */
@@ -7,7 +7,10 @@ TINY_SYSTEM_HEADER
 
 #include <QTimeZone>
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <variant>
 
 #include "orm/constants.hpp"
@@ -43,6 +46,7 @@ namespace Query
     /*! Binding types. */
     enum struct BindingType : quint8
     {
+        EXPRESSIONS,
         SELECT,
         FROM,
         JOIN,
@@ -107,6 +111,64 @@ namespace Query
         QString    sql        {}; // for the raw version; NOLINT(readability-redundant-member-init)
     };
 
+    /*! Common table expression item (the with clause). */
+    struct CommonTableExpressionItem
+    {
+        QString     name;
+        QString     query;
+        QStringList columns   {}; // NOLINT(readability-redundant-member-init)
+        bool        recursive {false};
+    };
+
+    /*! Union clause item. */
+    struct UnionItem
+    {
+        std::shared_ptr<QueryBuilder> query;
+        bool                          all {false};
+    };
+
+    /*! Group limit clause item (limit the number of records per group). */
+    struct GroupLimitItem
+    {
+        qint64  value;
+        QString column;
+    };
+
+    /*! Index hint item (use, force, or ignore index). */
+    struct IndexHintItem
+    {
+        QString type;
+        QString index;
+    };
+
+    /*! Query result cache item (used by the remember() and rememberForever()). */
+    struct RememberItem
+    {
+        std::optional<std::chrono::seconds> ttl;
+        QStringList                         tags;
+    };
+
+    /*! Progress of the updateInChunks() and deleteInChunks() (after every chunk). */
+    struct ChunkedWriteProgress
+    {
+        qint64 chunks    = 0;    // written chunks
+        qint64 rows      = 0;    // keys of the written chunks
+        qint64 affected  = 0;    // rows affected as reported by the database
+        bool   completed = true; // false if aborted by the progress callback
+    };
+
+    /*! Options of the updateInChunks() and deleteInChunks(). */
+    struct ChunkedWriteOptions
+    {
+        /*! Progress callback type, return false to stop writing the next chunks. */
+        using ProgressCallback = std::function<bool(const ChunkedWriteProgress &)>;
+
+        qint64                    chunkSize = 1000;
+        std::chrono::milliseconds sleep     {0}; // throttle between chunks
+        QString                   column    {}; // primary key if empty; NOLINT(readability-redundant-member-init)
+        ProgressCallback          progress  {}; // NOLINT(readability-redundant-member-init)
+    };
+
     /*! Order by clause item. */
     struct OrderByItem
     {
@@ -54,6 +54,14 @@ namespace Orm::Query::Concerns
                       qint64 count = 1000, const QString &column = "",
                       const QString &alias = "");
 
+        /*! Update records in chunks walked by the key ranges, every chunk is written
+            by its own statement to avoid the long lock holds. */
+        ChunkedWriteProgress
+        updateInChunks(const QList<UpdateItem> &values,
+                       const ChunkedWriteOptions &options = {});
+        /*! Delete records in chunks walked by the key ranges, every chunk is written
+            by its own statement to avoid the long lock holds. */
+        ChunkedWriteProgress deleteInChunks(const ChunkedWriteOptions &options = {});
 
         /*! Execute the query and get the first result if it's the sole matching
             record. */
@@ -67,6 +75,16 @@ namespace Orm::Query::Concerns
         Builder &builder() noexcept;
         /*! Static cast *this to the QueryBuilder & derived type, const version. */
         const Builder &builder() const noexcept;
+
+        /*! Write callback type, writes the given chunk and returns the affected
+            rows. */
+        using WriteChunkCallback = std::function<int(Builder &chunk)>;
+
+        /*! Walk the keys of the matching records by chunkById() and invoke the given
+            write callback for every chunk. */
+        ChunkedWriteProgress
+        writeInChunks(const ChunkedWriteOptions &options,
+                      const WriteChunkCallback &callback, const QString &functionName);
     };
 
     /* public */
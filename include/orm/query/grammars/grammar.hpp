@@ -55,6 +55,20 @@ namespace Orm::Query::Grammars
         prepareBindingsForUpdate(const BindingsMap &bindings,
                                  const QList<UpdateItem> &values);
 
+        /*! Compile an update statement with different values for every row into SQL
+            (rows are matched by the key column). */
+        virtual QString
+        compileUpdateMany(QueryBuilder &query, const QString &keyColumn,
+                          const QStringList &columns,
+                          const QList<QVariantMap> &values) const;
+        /*! Prepare the bindings for an update statement with different values for
+            every row. */
+        QList<QVariant>
+        prepareBindingsForUpdateMany(const BindingsMap &bindings,
+                                     const QString &keyColumn,
+                                     const QStringList &columns,
+                                     const QList<QVariantMap> &values) const;
+
         /*! Compile an "upsert" statement into SQL. */
         virtual QString
         compileUpsert(QueryBuilder &query, const QList<QVariantMap> &values,
@@ -105,13 +119,22 @@ namespace Orm::Query::Grammars
         /*! Compile the components necessary for a select clause. */
         QStringList compileComponents(const QueryBuilder &query) const;
 
+        /*! Compile the common table expressions (the with clause). */
+        QString compileExpressions(const QueryBuilder &query) const;
+        /*! Prepend the compiled common table expressions to the given statement. */
+        QString prependExpressions(const QueryBuilder &query, QString &&sql) const;
+
         /*! Compile an aggregated select clause. */
         QString compileAggregate(const QueryBuilder &query) const;
         /*! Compile the "select *" portion of the query. */
         virtual QString compileColumns(const QueryBuilder &query) const;
+        /*! Compile the optimizer hints comment (including the trailing space). */
+        virtual QString compileOptimizerHints(const QueryBuilder &query) const;
 
         /*! Compile the "from" portion of the query. */
         QString compileFrom(const QueryBuilder &query) const;
+        /*! Compile the index hint (empty string if the index hint is unsupported). */
+        virtual QString compileIndexHint(const QueryBuilder &query) const;
 
         /*! Compile the "where" portions of the query. */
         QString compileWheres(const QueryBuilder &query) const;
@@ -136,13 +159,26 @@ namespace Orm::Query::Grammars
 
         /*! Compile the "order by" portions of the query. */
         QString compileOrders(const QueryBuilder &query) const;
-        /*! Compile the query orders to the vector. */
-        QStringList compileOrdersToVector(const QueryBuilder &query) const;
+        /*! Compile the given orders to the vector. */
+        QStringList compileOrdersToVector(const QList<OrderByItem> &orders) const;
         /*! Compile the "limit" portions of the query. */
         QString compileLimit(const QueryBuilder &query) const;
         /*! Compile the "offset" portions of the query. */
         QString compileOffset(const QueryBuilder &query) const;
 
+        /*! Compile a group limit clause (limit the number of records per group). */
+        QString compileGroupLimit(const QueryBuilder &query) const;
+        /*! Compile a row number clause used by the group limit. */
+        QString compileRowNumber(const QString &partition,
+                                 const QueryBuilder &query) const;
+
+        /*! Compile the "union" queries attached to the main query. */
+        QString compileUnions(const QueryBuilder &query) const;
+        /*! Wrap a union sub-query in parentheses. */
+        virtual QString wrapUnion(const QString &sql) const;
+        /*! Compile a union aggregate query into SQL. */
+        QString compileUnionAggregate(const QueryBuilder &query) const;
+
         /*! Compile the lock into SQL. */
         virtual QString compileLock(const QueryBuilder &query) const;
 
@@ -190,6 +226,11 @@ namespace Orm::Query::Grammars
         /*! Compile a insert values lists. */
         QStringList compileInsertToVector(const QList<QVariantMap> &values) const;
 
+        /*! Flat the update values for the compileUpdateMany() (the same order as
+            their placeholders). */
+        virtual QList<QVariant>
+        flatValuesForUpdateMany(const QString &keyColumn, const QStringList &columns,
+                                const QList<QVariantMap> &values) const;
         /*! Compile the columns for an update statement. */
         virtual QString
         compileUpdateColumns(const QList<UpdateItem> &values) const;
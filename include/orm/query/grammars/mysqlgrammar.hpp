@@ -64,6 +64,11 @@ namespace Orm::Query::Grammars
         QString
         compileDeleteWithoutJoins(const QueryBuilder &query, const QString &table,
                                   const QString &wheres) const override;
+
+        /*! Compile the optimizer hints comment (including the trailing space). */
+        QString compileOptimizerHints(const QueryBuilder &query) const override;
+        /*! Compile the index hint (use, force, or ignore index). */
+        QString compileIndexHint(const QueryBuilder &query) const override;
     };
 
 } // namespace Orm::Query::Grammars
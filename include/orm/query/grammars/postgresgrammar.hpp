@@ -34,6 +34,11 @@ namespace Orm::Query::Grammars
         /*! Compile an update statement into SQL. */
         QString compileUpdate(QueryBuilder &query,
                               const QList<UpdateItem> &values) const override;
+        /*! Compile an update statement with different values for every row into SQL
+            (uses the update from the values list). */
+        QString compileUpdateMany(QueryBuilder &query, const QString &keyColumn,
+                                  const QStringList &columns,
+                                  const QList<QVariantMap> &values) const override;
         /*! Compile an "upsert" statement into SQL. */
         QString compileUpsert(
                     QueryBuilder &query, const QList<QVariantMap> &values,
@@ -74,6 +79,11 @@ namespace Orm::Query::Grammars
         QString dateBasedWhere(const QString &type, const
                                WhereConditionItem &where) const override;
 
+        /*! Flat the update values for the compileUpdateMany() (the same order as
+            their placeholders). */
+        QList<QVariant>
+        flatValuesForUpdateMany(const QString &keyColumn, const QStringList &columns,
+                                const QList<QVariantMap> &values) const override;
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QList<UpdateItem> &values) const override;
 
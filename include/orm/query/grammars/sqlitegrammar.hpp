@@ -76,6 +76,12 @@ namespace Orm::Query::Grammars
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QList<UpdateItem> &values) const override;
 
+        /*! Wrap a union sub-query in the sub-select. */
+        QString wrapUnion(const QString &sql) const override;
+
+        /*! Compile the index hint (only the force index is supported). */
+        QString compileIndexHint(const QueryBuilder &query) const override;
+
     private:
         /*! Compile an update statement with joins or limit into SQL. */
         QString compileUpdateWithJoinsOrLimit(QueryBuilder &query,
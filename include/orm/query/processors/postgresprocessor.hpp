@@ -13,15 +13,23 @@ namespace Orm::Query::Processors
 {
 
     /*! PostgreSQL processor, process SQL results. */
-    class PostgresProcessor final : public Processor
+    class TINYORM_EXPORT PostgresProcessor final : public Processor
     {
         Q_DISABLE_COPY_MOVE(PostgresProcessor)
 
+        /*! Alias for the SqlQuery. */
+        using SqlQuery = Orm::Types::SqlQuery;
+
     public:
         /*! Default constructor. */
         PostgresProcessor() = default;
         /*! Virtual destructor. */
         ~PostgresProcessor() final = default;
+
+        /*! Process the primary keys of the multi-rows insert (from the returning
+            clause). */
+        QList<quint64>
+        processInsertGetIds(SqlQuery &query, qsizetype count) const final;
     };
 
 } // namespace Orm::Query::Processors
@@ -38,6 +38,11 @@ namespace Query::Processors
 
         /*! Process the results of a column listing query. */
         virtual QStringList processColumnListing(SqlQuery &query) const;
+
+        /*! Process the primary keys of the multi-rows insert (the first inserted ID
+            is incremented by one for every row). */
+        virtual QList<quint64>
+        processInsertGetIds(SqlQuery &query, qsizetype count) const;
     };
 
     /* public */
@@ -28,6 +28,11 @@ namespace Orm::Query::Processors
 
         /*! Process the results of a column listing query. */
         QStringList processColumnListing(SqlQuery &query) const final;
+
+        /*! Process the primary keys of the multi-rows insert (computed backward from
+            the last inserted ID). */
+        QList<quint64>
+        processInsertGetIds(SqlQuery &query, qsizetype count) const final;
     };
 
 } // namespace Orm::Query::Processors
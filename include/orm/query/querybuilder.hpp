@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include "orm/query/concerns/buildsqueries.hpp"
 #include "orm/query/grammars/grammar.hpp"
+#include "orm/query/querycache.hpp"
 #include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -37,7 +38,7 @@ namespace Orm::Query
         // To access enforceOrderBy()
         friend Concerns::BuildsQueries;
 #ifndef TINYORM_DISABLE_ORM
-        // To access stripTableForPluck()
+        // To access stripTableForPluck() and the clauses qualified by the withJoin()
         template<typename Model>
         friend class Tiny::Builder;
 #endif
@@ -123,6 +124,10 @@ namespace Orm::Query
 
         /*! Insert a new record and get the value of the primary key. */
         quint64 insertGetId(const QVariantMap &values, const QString &sequence = "");
+        /*! Insert new records and get the values of the primary keys (multi-rows
+            insert, all records must have the same columns and no primary key). */
+        QList<quint64>
+        insertGetIds(const QList<QVariantMap> &values, const QString &sequence = "");
 
         /*! Insert new records into the database while ignoring errors. */
         std::tuple<int, std::optional<TSqlQuery>>
@@ -138,6 +143,11 @@ namespace Orm::Query
         /*! Update records in the database. */
         std::tuple<int, TSqlQuery>
         update(const QList<UpdateItem> &values);
+        /*! Update records in the database, every row can have different values
+            (rows are matched by the key column, all rows must have the same columns,
+            rows are updated in chunks if they exceed the bindings limit). */
+        std::tuple<int, std::optional<TSqlQuery>>
+        updateMany(const QString &keyColumn, const QList<QVariantMap> &values);
         /*! Insert or update a record matching the attributes, and fill it with values. */
         std::tuple<int, std::optional<TSqlQuery>>
         updateOrInsert(const QList<WhereItem> &attributes,
@@ -256,6 +266,17 @@ namespace Orm::Query
         Builder &fromRaw(const QString &expression,
                          const QList<QVariant> &bindings = {});
 
+        /* Common table expressions */
+        /*! Add a common table expression to the query (the with clause). */
+        template<SubQuery T>
+        Builder &withExpression(const QString &name, T &&query,
+                                const QStringList &columns = {},
+                                bool recursive = false);
+        /*! Add a recursive common table expression to the query. */
+        template<SubQuery T>
+        inline Builder &withRecursiveExpression(const QString &name, T &&query,
+                                                const QStringList &columns = {});
+
         /* Joins */
         /*! Add a join clause to the query. */
         template<JoinTable T>
@@ -679,6 +700,8 @@ namespace Orm::Query
         Builder &skip(qint64 value);
         /*! Set the limit and offset for a given page. */
         Builder &forPage(qint64 page, qint64 perPage = 30);
+        /*! Set the "limit" value per group partitioned by the given column. */
+        Builder &groupLimit(qint64 value, const QString &column);
 
         /*! Constrain the query to the previous "page" of results before a given ID. */
         Builder &forPageBeforeId(qint64 perPage = 30, const QVariant &lastId = {},
@@ -701,6 +724,24 @@ namespace Orm::Query
         decrement(const QString &column, T amount = 1,
                   const QList<UpdateItem> &extra = {});
 
+        /* Unions */
+        /*! Add a union statement to the query. */
+        template<QueryableShared T>
+        Builder &union_(T &&query, bool all = false);
+        /*! Add a union all statement to the query. */
+        template<QueryableShared T>
+        inline Builder &unionAll(T &&query);
+
+        /* Index and optimizer hints */
+        /*! Add an index hint to suggest a query index. */
+        Builder &useIndex(const QString &index);
+        /*! Add an index hint to force a query index. */
+        Builder &forceIndex(const QString &index);
+        /*! Add an index hint to ignore a query index. */
+        Builder &ignoreIndex(const QString &index);
+        /*! Add an optimizer hint to the query (eg. MAX_EXECUTION_TIME(1000)). */
+        Builder &optimizerHint(const QString &hint);
+
         /* Pessimistic Locking */
         /*! Lock the selected rows in the table for updating. */
         Builder &lockForUpdate();
@@ -715,6 +756,17 @@ namespace Orm::Query
         /*! Lock the selected rows in the table. */
         Builder &lock(QString &&value);
 
+        /* Query result cache */
+        /*! Cache the results of the query for the given time (the table names are
+            also used as tags, so writes to these tables forget the results). */
+        Builder &remember(std::chrono::seconds ttl, const QStringList &tags = {});
+        /*! Cache the results of the query until any of the tagged tables is written. */
+        Builder &rememberForever(const QStringList &tags = {});
+        /*! Get the cached result of the query, execute the query if it isn't cached
+            (the result is only materialized if the query isn't remembered). */
+        std::shared_ptr<const CachedResult>
+        getRemembered(const QList<Column> &columns = {ASTERISK});
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false);
@@ -771,6 +823,8 @@ namespace Orm::Query
         inline Builder &setColumns(const QList<Column> &columns) noexcept;
         /*! Set the columns that should be returned. */
         inline Builder &setColumns(QList<Column> &&columns) noexcept;
+        /*! Get the common table expressions for the query. */
+        inline const QList<CommonTableExpressionItem> &getExpressions() const noexcept;
         /*! Get the table associated with the query builder. */
         inline const FromClause &getFrom() const noexcept;
         /*! Get the table joins for the query. */
@@ -787,9 +841,27 @@ namespace Orm::Query
         inline qint64 getLimit() const noexcept;
         /*! Get the number of records to skip. */
         inline qint64 getOffset() const noexcept;
+        /*! Get the maximum number of records to return per group. */
+        inline const std::optional<GroupLimitItem> &getGroupLimit() const noexcept;
+        /*! Get the index hint for the query. */
+        inline const std::optional<IndexHintItem> &getIndexHint() const noexcept;
+        /*! Get the optimizer hints for the query. */
+        inline const QStringList &getOptimizerHints() const noexcept;
         /*! Get the row locking. */
         inline const std::variant<std::monostate, bool, QString> &
         getLock() const noexcept;
+        /*! Get the query result cache options (std::nullopt if not remembered). */
+        inline const std::optional<RememberItem> &getRemember() const noexcept;
+        /*! Determine whether the results of the query are cached. */
+        inline bool isRemembering() const noexcept;
+        /*! Get the query union statements. */
+        inline const QList<UnionItem> &getUnions() const noexcept;
+        /*! Get the orderings for the union query. */
+        inline const QList<OrderByItem> &getUnionOrders() const noexcept;
+        /*! Get the maximum number of records to return for the union query. */
+        inline qint64 getUnionLimit() const noexcept;
+        /*! Get the number of records to skip for the union query. */
+        inline qint64 getUnionOffset() const noexcept;
 
         /* Other methods */
         /*! Get a new instance of the query builder. */
@@ -824,6 +896,16 @@ namespace Orm::Query
         {
             /*! Columns property type (used to clone query without column names). */
             COLUMNS,
+            /*! Common table expressions property type (the with clause). */
+            EXPRESSIONS,
+            /*! Aggregate property type (used to compile union aggregates). */
+            AGGREGATE,
+            /*! Orders property type (used to compile group limits). */
+            ORDERS,
+            /*! Offset property type (used to compile group limits). */
+            OFFSET,
+            /*! Group limit property type (used to compile group limits). */
+            GROUP_LIMIT,
         };
 
         /*! Clone the query. */
@@ -834,6 +916,10 @@ namespace Orm::Query
         Builder cloneWithoutBindings(
                 const std::unordered_set<BindingType> &except) const;
 
+        /*! The maximum number of bindings in one statement (SQLite allows 32766
+            bindings by default, MySQL and PostgreSQL 65535). */
+        constexpr static qsizetype MaxBindings = 32766;
+
     protected:
         /*! Throw if the given operator is not valid for the current DB connection. */
         void throwIfInvalidOperator(const QString &comparison) const;
@@ -910,6 +996,20 @@ namespace Orm::Query
     private:
         /*! Run the query as a "select" statement against the connection. */
         SqlQuery runSelect();
+        /*! Run the query as a "select" statement using the query result cache. */
+        std::shared_ptr<const CachedResult> runSelectRemembered();
+        /*! Get the tags of the cached result (the user tags and table names). */
+        QStringList rememberTags() const;
+        /*! Append the names of the tables of this query and its nested and exists
+            queries to the given tags. */
+        void appendTableTags(QStringList &tags) const;
+        /*! Get a vector with values in the given column using the query result cache. */
+        QList<QVariant> pluckRemembered(const Column &column);
+        /*! Run the update statement with different values for every row (one chunk
+            of the updateMany()). */
+        std::tuple<int, TSqlQuery>
+        runUpdateMany(const QString &keyColumn, const QStringList &columns,
+                      const QList<QVariantMap> &values);
 
         /*! Set the table which the query is targeting. */
         inline Builder &setFrom(const FromClause &from);
@@ -936,6 +1036,9 @@ namespace Orm::Query
                 const std::function<void(JoinClause &)> &callback,
                 const QString &type);
 
+        /*! Add a union statement to the query, common code. */
+        Builder &unionInternal(std::shared_ptr<Builder> &&query, bool all);
+
         /*! Add a basic where clause to the query, common code. */
         Builder &whereInternal(
                 const Column &column, const QString &comparison, QVariant value,
@@ -955,17 +1058,20 @@ namespace Orm::Query
         /*! The current query value bindings.
             Order is crucial here because of that QMap with an enum struct is used. */
         BindingsMap m_bindings {
-            {BindingType::SELECT,     {}},
-            {BindingType::FROM,       {}},
-            {BindingType::JOIN,       {}},
-            {BindingType::WHERE,      {}},
-            {BindingType::GROUPBY,    {}},
-            {BindingType::HAVING,     {}},
-            {BindingType::ORDER,      {}},
-            {BindingType::UNION,      {}},
-            {BindingType::UNIONORDER, {}},
+            {BindingType::EXPRESSIONS, {}},
+            {BindingType::SELECT,      {}},
+            {BindingType::FROM,        {}},
+            {BindingType::JOIN,        {}},
+            {BindingType::WHERE,       {}},
+            {BindingType::GROUPBY,     {}},
+            {BindingType::HAVING,      {}},
+            {BindingType::ORDER,       {}},
+            {BindingType::UNION,       {}},
+            {BindingType::UNIONORDER,  {}},
         };
 
+        /*! The common table expressions for the query (the with clause). */
+        QList<CommonTableExpressionItem> m_expressions;
         /*! An aggregate function and column to be run. */
         std::optional<AggregateItem> m_aggregate = std::nullopt;
         /*! Indicates if the query returns distinct results. */
@@ -988,8 +1094,24 @@ namespace Orm::Query
         qint64 m_limit = -1;
         /*! The number of records to skip. */
         qint64 m_offset = -1;
+        /*! The maximum number of records to return per group. */
+        std::optional<GroupLimitItem> m_groupLimit = std::nullopt;
+        /*! The index hint for the query. */
+        std::optional<IndexHintItem> m_indexHint = std::nullopt;
+        /*! The optimizer hints for the query. */
+        QStringList m_optimizerHints;
         /*! Indicates whether row locking is being used. */
         std::variant<std::monostate, bool, QString> m_lock;
+        /*! The query result cache options. */
+        std::optional<RememberItem> m_remember = std::nullopt;
+        /*! The query union statements. */
+        QList<UnionItem> m_unions;
+        /*! The orderings for the union query. */
+        QList<OrderByItem> m_unionOrders;
+        /*! The maximum number of union records to return. */
+        qint64 m_unionLimit = -1;
+        /*! The number of union records to skip. */
+        qint64 m_unionOffset = -1;
     };
 
     /* public */
@@ -1183,6 +1305,30 @@ namespace Orm::Query
                        bindings);
     }
 
+    /* Common table expressions */
+
+    template<SubQuery T>
+    Builder &
+    Builder::withExpression(const QString &name, T &&query, const QStringList &columns,
+                            const bool recursive)
+    {
+        auto [queryString, bindings] = createSub(std::forward<T>(query)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+        m_expressions.append({name, std::move(queryString), columns, recursive});
+
+        addBinding(std::move(bindings), BindingType::EXPRESSIONS);
+
+        return *this;
+    }
+
+    template<SubQuery T>
+    Builder &
+    Builder::withRecursiveExpression(const QString &name, T &&query,
+                                     const QStringList &columns)
+    {
+        return withExpression(name, std::forward<T>(query), columns, true);
+    }
+
     /* Joins */
 
     template<JoinTable T>
@@ -1605,7 +1751,8 @@ namespace Orm::Query
     {
         auto [queryString, bindings] = createSub(std::forward<T>(query));
 
-        addBinding(std::move(bindings), BindingType::ORDER);
+        addBinding(std::move(bindings), m_unions.isEmpty() ? BindingType::ORDER
+                                                           : BindingType::UNIONORDER);
 
         return orderBy(Expression(PARENTH_ONE.arg(queryString)), direction);
     }
@@ -1646,6 +1793,40 @@ namespace Orm::Query
         return update(columns);
     }
 
+    /* Unions */
+
+    template<QueryableShared T>
+    Builder &Builder::union_(T &&query, const bool all)
+    {
+        if constexpr (std::invocable<T, Builder &>) {
+            // Ownership of the std::shared_ptr<QueryBuilder>
+            auto unionQuery = newQuery();
+
+            std::invoke(std::forward<T>(query), *unionQuery);
+
+            return unionInternal(std::move(unionQuery), all);
+        }
+
+        /* For the std::shared_ptr<QueryBuilder>, the bindings are added right away so
+           the union query is cloned, the later changes of the given query would
+           compile the SQL that doesn't match the added bindings. */
+        else if constexpr (std::convertible_to<T, const std::shared_ptr<Builder> &>) {
+            const std::shared_ptr<Builder> &unionQuery = query;
+
+            return unionInternal(std::make_shared<Builder>(unionQuery->clone()), all);
+        }
+
+        // For the QueryBuilder &, the union query has to outlive the given instance
+        else
+            return unionInternal(std::make_shared<Builder>(std::forward<T>(query)), all);
+    }
+
+    template<QueryableShared T>
+    Builder &Builder::unionAll(T &&query)
+    {
+        return union_(std::forward<T>(query), true);
+    }
+
     /* Getters / Setters */
 
     DatabaseConnection &Builder::getConnection() const noexcept
@@ -1718,6 +1899,12 @@ namespace Orm::Query
         return *this;
     }
 
+    const QList<CommonTableExpressionItem> &
+    Builder::getExpressions() const noexcept
+    {
+        return m_expressions;
+    }
+
     const FromClause &
     Builder::getFrom() const noexcept
     {
@@ -1764,12 +1951,63 @@ namespace Orm::Query
         return m_offset;
     }
 
+    const std::optional<GroupLimitItem> &
+    Builder::getGroupLimit() const noexcept
+    {
+        return m_groupLimit;
+    }
+
+    const std::optional<IndexHintItem> &
+    Builder::getIndexHint() const noexcept
+    {
+        return m_indexHint;
+    }
+
+    const QStringList &
+    Builder::getOptimizerHints() const noexcept
+    {
+        return m_optimizerHints;
+    }
+
     const std::variant<std::monostate, bool, QString> &
     Builder::getLock() const noexcept
     {
         return m_lock;
     }
 
+    const std::optional<RememberItem> &
+    Builder::getRemember() const noexcept
+    {
+        return m_remember;
+    }
+
+    bool Builder::isRemembering() const noexcept
+    {
+        return m_remember.has_value();
+    }
+
+    const QList<UnionItem> &
+    Builder::getUnions() const noexcept
+    {
+        return m_unions;
+    }
+
+    const QList<OrderByItem> &
+    Builder::getUnionOrders() const noexcept
+    {
+        return m_unionOrders;
+    }
+
+    qint64 Builder::getUnionLimit() const noexcept
+    {
+        return m_unionLimit;
+    }
+
+    qint64 Builder::getUnionOffset() const noexcept
+    {
+        return m_unionOffset;
+    }
+
     Builder Builder::clone() const
     {
         return *this;
@@ -0,0 +1,185 @@
+#pragma once
+#ifndef ORM_QUERY_QUERYCACHE_HPP
+#define ORM_QUERY_QUERYCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QStringList>
+#include <QVariant>
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <optional>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+    class SqlQuery;
+}
+
+namespace Query
+{
+
+    /*! Materialized result of the select query (the SqlQuery can't be cached). */
+    struct TINYORM_EXPORT CachedResult
+    {
+        /*! Field names of the result. */
+        QStringList columns;
+        /*! Values of all rows in the order of the columns. */
+        QList<QList<QVariant>> rows;
+
+        /*! Read all rows of the given query. */
+        static CachedResult fromQuery(Types::SqlQuery &query);
+
+        /*! Get the number of rows. */
+        inline QList<QList<QVariant>>::size_type size() const noexcept;
+        /*! Determine whether the result is empty. */
+        inline bool isEmpty() const noexcept;
+        /*! Get the value of the given column in the given row (invalid if the column
+            doesn't exist). */
+        QVariant value(QList<QList<QVariant>>::size_type row,
+                       const QString &column) const;
+
+        /*! Get the approximate size of the result in bytes. */
+        std::size_t memoryUsage() const;
+    };
+
+    /*! Library class for the process-wide query result cache, results are keyed by
+        the connection name, compiled SQL, and bindings, the least recently used
+        results are evicted to keep the number of entries and their memory usage
+        bounded, and the results tagged by the table name are forgotten when
+        the DatabaseConnection executes the write statement to this table (and again
+        when the transaction containing this statement is committed). */
+    class TINYORM_EXPORT QueryCache
+    {
+        Q_DISABLE_COPY_MOVE(QueryCache)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        QueryCache() = delete;
+        /*! Deleted destructor. */
+        ~QueryCache() = delete;
+
+        /*! Get the cache key for the given query. */
+        static QString key(const QString &connection, const QString &query,
+                           const QList<QVariant> &bindings);
+
+        /*! Get the cached result (nullptr if not cached or expired). */
+        static std::shared_ptr<const CachedResult> get(const QString &key);
+        /*! Get the current generation, it must be obtained before the select query is
+            executed and passed to the put(). */
+        static quint64 generation();
+        /*! Cache the given result (forever if the ttl is std::nullopt), the result
+            isn't cached if any of its tags was invalidated after the given generation
+            because it can be stale. */
+        static std::shared_ptr<const CachedResult>
+        put(const QString &key, CachedResult &&result,
+            std::optional<std::chrono::seconds> ttl, const QStringList &tags,
+            quint64 generation);
+
+        /*! Forget all the cached results tagged by any of the given tags. */
+        static void flushTags(const QStringList &tags);
+        /*! Forget all the cached results. */
+        static void flush();
+        /*! Forget the cached results of the table written by the given statement. */
+        static void invalidate(const QString &statement, const QString &tablePrefix);
+        /*! Forget the cached results of the given written table tag (all the cached
+            results if the tag is empty, the table is unknown). */
+        static void invalidateTag(const QString &tag);
+
+        /*! Get the tag of the table written by the given statement, an empty QString
+            if the table is unknown (std::nullopt if it isn't the write statement). */
+        static std::optional<QString>
+        writtenTag(const QString &statement, const QString &tablePrefix);
+
+        /*! Get the tag for the given table (w/o the alias, schema, and quotes). */
+        static QString tableTag(const QString &table, const QString &tablePrefix = "");
+        /*! Get the tag of the results that read the unknown tables (eg. the common
+            table expressions), these results are forgotten by every write. */
+        inline static QString anyTableTag();
+
+        /*! Get the maximum number of the cached results. */
+        static std::size_t maxEntries();
+        /*! Set the maximum number of the cached results. */
+        static void setMaxEntries(std::size_t maxEntries);
+        /*! Get the maximum memory usage of the cached results in bytes. */
+        static std::size_t memoryBudget();
+        /*! Set the maximum memory usage of the cached results in bytes. */
+        static void setMemoryBudget(std::size_t memoryBudget);
+
+        /*! Get the number of the cached results. */
+        static std::size_t size();
+        /*! Get the approximate memory usage of the cached results in bytes. */
+        static std::size_t memoryUsage();
+
+    private:
+        /*! Cached result with its metadata. */
+        struct Entry
+        {
+            /*! Cache key. */
+            QString key;
+            /*! Cached result. */
+            std::shared_ptr<const CachedResult> result;
+            /*! Expiration time (std::nullopt for the forever cached results). */
+            std::optional<std::chrono::steady_clock::time_point> expiresAt;
+            /*! Tags (table names and user tags). */
+            QStringList tags;
+            /*! Approximate memory usage of the result in bytes. */
+            std::size_t memory = 0;
+        };
+
+        /*! Cached entries and limits (defined in the querycache.cpp). */
+        struct Storage;
+
+        /*! Get the process-wide storage of the cached entries. */
+        static Storage &storage();
+
+        /*! Evict the least recently used entries until all limits are met. */
+        static void evictOverLimits(Storage &storage);
+        /*! Forget the given entry. */
+        static void erase(Storage &storage, std::list<Entry>::iterator entry);
+
+        /*! Determine whether any tag of the result read at the given generation was
+            invalidated in the meantime. */
+        static bool isStale(const Storage &storage, const QStringList &tags,
+                            quint64 generation);
+
+        /*! Get the table written by the given statement, an empty QString if it's
+            the write statement for an unknown table (std::nullopt if not writing). */
+        static std::optional<QString> writtenTable(const QString &statement);
+    };
+
+    /* CachedResult */
+
+    QList<QList<QVariant>>::size_type CachedResult::size() const noexcept
+    {
+        return rows.size();
+    }
+
+    bool CachedResult::isEmpty() const noexcept
+    {
+        return rows.isEmpty();
+    }
+
+    /* QueryCache */
+
+    QString QueryCache::anyTableTag()
+    {
+        // Can't be the table name
+        return QStringLiteral("*");
+    }
+
+} // namespace Query
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_QUERY_QUERYCACHE_HPP
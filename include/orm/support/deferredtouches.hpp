@@ -0,0 +1,88 @@
+#pragma once
+#ifndef ORM_SUPPORT_DEFERREDTOUCHES_HPP
+#define ORM_SUPPORT_DEFERREDTOUCHES_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+
+#include <functional>
+#include <map>
+#include <tuple>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Library class to defer the owner touches (update of the updated_at column),
+        touches are recorded in memory, deduplicated by the table and key, and flushed
+        using one update query for every table (used by the DB::withDeferredTouches()). */
+    class TINYORM_EXPORT DeferredTouches
+    {
+        Q_DISABLE_COPY_MOVE(DeferredTouches)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        DeferredTouches() = delete;
+        /*! Deleted destructor. */
+        ~DeferredTouches() = delete;
+
+        /*! Call the given callback and touch the recorded owners at the end. */
+        static void withDeferredTouches(const std::function<void()> &callback);
+
+        /*! Determine whether the owner touches are deferred in the current thread. */
+        static bool isDeferring() noexcept;
+
+        /*! Record the touch of the given owners, they are touched at the end
+            of the outermost withDeferredTouches() scope. */
+        static void defer(const QString &connection, const QString &table,
+                          const QString &keyName, const QString &updatedAtColumn,
+                          const QList<QVariant> &ids, const QVariant &timestamp);
+
+        /*! Keep the touches recorded in the committed transaction on the given
+            connection (called by the connection). */
+        static void commitTransaction(const QString &connection);
+        /*! Discard the touches recorded in the rolled back transaction on the given
+            connection (called by the connection). */
+        static void discardTransaction(const QString &connection);
+
+    private:
+        /*! Recorded owner touches for one table. */
+        struct TableTouches
+        {
+            /*! Timestamp to set (the last recorded one). */
+            QVariant timestamp;
+            /*! Owner IDs, keyed by the ID converted to the QString for deduplication. */
+            std::map<QString, QVariant> ids;
+        };
+
+        /*! Recorded touches key (connection, table, key name, and updated_at column). */
+        using TouchesKey = std::tuple<QString, QString, QString, QString>;
+        /*! Recorded touches type. */
+        using TouchesType = std::map<TouchesKey, TableTouches>;
+
+        /*! Touch all the recorded owners, one update query for every table. */
+        static void flush();
+        /*! Merge the given table touches into the given recorded touches. */
+        static void merge(TouchesType &touches, const TouchesKey &key,
+                          TableTouches &tableTouches);
+
+        /*! Get the recorded touches for the current thread. */
+        static TouchesType &touches() noexcept;
+        /*! Get the touches recorded in the active transactions for the current
+            thread (they are kept until the commit). */
+        static TouchesType &transactionTouches() noexcept;
+        /*! Get the withDeferredTouches() nesting level for the current thread. */
+        static std::size_t &level() noexcept;
+    };
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_DEFERREDTOUCHES_HPP
@@ -10,8 +10,8 @@ TINY_SYSTEM_HEADER
 #include "orm/macros/threadlocal.hpp"
 #include "orm/tiny/concerns/guardedmodel.hpp"
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
+#include "orm/tiny/support/modelmetadata.hpp"
 #include "orm/tiny/tinytypes.hpp"
-#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -22,9 +22,6 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     class GuardsAttributes : public Concerns::GuardedModel
     {
-        /*! Alias for the type utils. */
-        using TypeUtils = Orm::Utils::Type;
-
     public:
         /*! Get the fillable attributes for the model. */
         inline const QStringList &getFillable() const;
@@ -278,8 +275,9 @@ namespace Orm::Tiny::Concerns
     QString
     GuardsAttributes<Derived, AllRelations...>::getKeyForGuardableHash() const
     {
-        return QStringLiteral("%1-%2").arg(model().getConnectionName(),
-                                           TypeUtils::classPureBasename<Derived>());
+        return QStringLiteral("%1-%2").arg(
+                    model().getConnectionName(),
+                    Support::ModelMetadata<Derived>::instance().classBasename());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -21,7 +21,10 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/casts/attribute.hpp"
 #include "orm/tiny/exceptions/mutatormappingnotfounderror.hpp"
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
+#include "orm/tiny/typedcolumns.hpp"
+#include "orm/tiny/types/attributeslayout.hpp"
 #include "orm/tiny/utils/attribute.hpp"
+#include "orm/tiny/utils/cbor.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/helpers.hpp"
 #include "orm/utils/nullvariant.hpp"
@@ -39,6 +42,8 @@ namespace Orm::Tiny::Concerns
     {
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
+        /*! Alias for the CBOR utils. */
+        using CborUtils = Orm::Tiny::Utils::Cbor;
         /*! Alias for the configuration utils. */
         using ConfigUtils = Orm::Utils::Configuration;
         /*! Alias for the helper utils. */
@@ -90,8 +95,8 @@ namespace Orm::Tiny::Concerns
                              const QVariant &defaultValue = {}) const;
         /*! Get the model's original attribute values (transformed and insert order). */
         QList<AttributeItem> getOriginals() const;
-        /*! Get the model's original attributes hash (for fast lookup). */
-        inline const std::unordered_map<QString, AttributesSizeType> &
+        /*! Get the model's original attributes hash (for fast lookup, built lazily). */
+        const std::unordered_map<QString, AttributesSizeType> &
         getOriginalsHash() const;
         /*! Get the model's raw original attribute value. */
         QVariant getRawOriginal(const QString &key,
@@ -130,8 +135,8 @@ namespace Orm::Tiny::Concerns
 
         /*! Get the attributes that were changed (insertion order). */
         inline const QList<AttributeItem> &getChanges() const;
-        /*! Get the attributes that were changed (for fast lookup). */
-        inline const std::unordered_map<QString, AttributesSizeType> &
+        /*! Get the attributes that were changed (for fast lookup, built lazily). */
+        const std::unordered_map<QString, AttributesSizeType> &
         getChangesHash() const;
         /*! Determine if the model and all the given attribute(s) have
             remained the same. */
@@ -350,6 +355,20 @@ namespace Orm::Tiny::Concerns
         inline CastItem getCastItem(const QString &key) const;
         /*! Get the type of cast for a model attribute. */
         inline CastType getCastType(const QString &key) const;
+        /*! Find the cast item for a model attribute (nullptr if there is no cast). */
+        const CastItem *findCastItem(const QString &key) const;
+        /*! Determine whether the given attribute is in the model's date columns. */
+        bool isDatesColumn(const QString &key) const;
+        /*! Resolve the cast item for a model attribute w/o the cast plan. */
+        const CastItem *resolveCastItem(const QString &key) const;
+        /*! Determine whether the given attribute is in the date columns w/o the cast
+            plan. */
+        bool resolveIsDatesColumn(const QString &key) const;
+        /*! Find the attribute in the cast plan (nullptr if the plan isn't valid). */
+        const Types::CastPlan::Item *findCastPlanItem(const QString &key) const;
+        /*! Invalidate the cast plans of all the models of this type (after the casts
+            or dates were modified). */
+        inline static void invalidateCastPlans() noexcept;
 
         /*! Determine whether a value is Date / DateTime castable. */
         inline bool isDateCastable(const QString &key) const;
@@ -418,6 +437,26 @@ namespace Orm::Tiny::Concerns
         /*! Prepare a time for vector, map, or JSON serialization. */
         inline static QString serializeTime(QTime time);
 
+        /* Serialization - CBOR */
+        /*! Write the raw attributes, original, and changes to the CBOR stream. */
+        void attributesToCbor(QCborStreamWriter &writer) const;
+        /*! Restore the raw attributes, original, and changes from the CBOR stream. */
+        void attributesFromCbor(QCborStreamReader &reader);
+
+        /* Others */
+        /*! Restore the raw attributes, original, and changes (eg. after the failed
+            write). */
+        void restoreAttributes(QList<AttributeItem> &&attributes,
+                               QList<AttributeItem> &&original,
+                               QList<AttributeItem> &&changes);
+        /*! Set the raw attributes w/o duplicate keys and sync the original, the given
+            attributes layout of the same attribute names is shared. */
+        Derived &setRawAttributesShared(QList<AttributeItem> &&attributes,
+                                        const Types::AttributesLayout &layout);
+        /*! Resolve the cast plan of the current attributes and get the attributes
+            layout to share with the models hydrated from the same result. */
+        Types::AttributesLayout shareAttributesLayout();
+
         /* Data members */
         /*! The model's default values for attributes. */
         T_THREAD_LOCAL
@@ -433,12 +472,22 @@ namespace Orm::Tiny::Concerns
 
         /* Don't want to use std::reference_wrapper to attributes, because if a copy
            of the model is made, all references would be invalidated. */
-        /*! The model's attributes hash (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_attributesHash;
-        /*! The model attribute's original state (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_originalHash;
-        /*! The changed model attributes (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_changesHash;
+        /*! The model's attributes hash (for fast lookup, implicitly shared). */
+        Types::AttributesHash m_attributesHash;
+        /* The m_original and m_changes are rarely looked up by the key after
+           the hydration, so their hashes are built on first use only. */
+        /*! The model attribute's original state (for fast lookup, built lazily,
+            implicitly shared). */
+        mutable std::optional<Types::AttributesHash> m_originalHash = std::nullopt;
+        /*! The changed model attributes (for fast lookup, built lazily, implicitly
+            shared). */
+        mutable std::optional<Types::AttributesHash> m_changesHash = std::nullopt;
+        /*! The typed slots of the columns declared in the Derived::Columns (filled
+            from the m_attributes on first typed access, cleared on every write). */
+        mutable TypedAttributeSlots m_typedSlots;
+        /*! The resolved casts shared by the models hydrated from the same result
+            (nullptr if the attribute names were changed after the hydration). */
+        std::shared_ptr<const Types::CastPlan> m_castPlan = nullptr;
 
         /*! The storage format of the model's date columns. */
         T_THREAD_LOCAL
@@ -457,6 +506,10 @@ namespace Orm::Tiny::Concerns
         /*! The attributes that should be cast. */
         T_THREAD_LOCAL
         inline static std::unordered_map<QString, CastItem> u_casts;
+        /*! Version of the casts and dates, every modification invalidates the resolved
+            cast plans. */
+        T_THREAD_LOCAL
+        inline static quint64 castsVersion = 0;
 
         /*! Determine how the QDateTime time zone will be converted. */
         mutable std::optional<QtTimeZoneConfig> m_qtTimeZone = std::nullopt;
@@ -581,9 +634,11 @@ namespace Orm::Tiny::Concerns
         )
             value = fromDateTime(value);
 
+        const auto &attributesHash = m_attributesHash.get();
+
         // Found
-        if (const auto attribute = m_attributesHash.find(key);
-            attribute != m_attributesHash.end()
+        if (const auto attribute = attributesHash.find(key);
+            attribute != attributesHash.end()
         )
             m_attributes[attribute->second].value.swap(value);
 
@@ -592,11 +647,15 @@ namespace Orm::Tiny::Concerns
             auto position = m_attributes.size();
 
             m_attributes.append({key, value});
-            m_attributesHash.emplace(key, position);
+            // Makes a private copy if the hash is shared with another model instance
+            m_attributesHash.detach().emplace(key, position);
+            // The attribute positions were changed
+            m_castPlan.reset();
         }
 
         // It's enough to clear this cache and recompute when needed
         m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
 
         return model();
     }
@@ -609,18 +668,20 @@ namespace Orm::Tiny::Concerns
     {
         m_attributes = AttributeUtils::removeDuplicateKeys(attributes);
 
-        // Build attributes hash
-        m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<decltype (m_attributesHash)::size_type>(
-                                     m_attributes.size()));
+        // Build attributes hash (a shared hash isn't copied)
+        auto &attributesHash = m_attributesHash.clear();
+        attributesHash.reserve(static_cast<Types::AttributesHash::HashType::size_type>(
+                                   m_attributes.size()));
 
-        rehashAttributePositions(m_attributes, m_attributesHash);
+        rehashAttributePositions(m_attributes, attributesHash);
+        m_castPlan.reset();
 
         if (sync)
             syncOriginal();
 
         m_attributeMutatorsCache.clear();
         m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
 
         return model();
     }
@@ -631,21 +692,22 @@ namespace Orm::Tiny::Concerns
             QList<AttributeItem> &&attributes,
             const bool sync)
     {
-        m_attributes.reserve(attributes.size());
         m_attributes = AttributeUtils::removeDuplicateKeys(std::move(attributes));
 
-        // Build attributes hash
-        m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<decltype (m_attributesHash)::size_type>(
-                                     m_attributes.size()));
+        // Build attributes hash (a shared hash isn't copied)
+        auto &attributesHash = m_attributesHash.clear();
+        attributesHash.reserve(static_cast<Types::AttributesHash::HashType::size_type>(
+                                   m_attributes.size()));
 
-        rehashAttributePositions(m_attributes, m_attributesHash);
+        rehashAttributePositions(m_attributes, attributesHash);
+        m_castPlan.reset();
 
         if (sync)
             syncOriginal();
 
         m_attributeMutatorsCache.clear();
         m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
 
         return model();
     }
@@ -653,9 +715,12 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &HasAttributes<Derived, AllRelations...>::syncOriginal()
     {
+        /* The QList is implicitly shared so the m_original shares data with
+           the m_attributes until the first write, no attribute is copied here. */
         m_original = getAttributes();
 
-        rehashAttributePositions(m_original, m_originalHash);
+        // Will be rebuilt on first use in the getOriginalsHash()
+        m_originalHash.reset();
 
         return model();
     }
@@ -679,7 +744,7 @@ namespace Orm::Tiny::Concerns
         // FEATURE castable silverqx
 //        mergeAttributesFromClassCasts();
 
-        return m_attributesHash;
+        return m_attributesHash.get();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -693,7 +758,9 @@ namespace Orm::Tiny::Concerns
            get the attribute's value. Otherwise, we will return invalid QVariant.
            Also, don't user the hasCast(key) check here because there is always primary
            key cast and it would return null or invalid QVariant. */
-        if (m_attributesHash.contains(key) || basemodel().getUserCasts().contains(key))
+        if (m_attributesHash.get().contains(key) ||
+            basemodel().getUserCasts().contains(key)
+        )
             return getAttributeValue(key);
 
         // FUTURE add getRelationValue() overload without Related template argument, after that I will be able to use it here, Related template parameter will be obtained by the visitor, I think this task is impossible to do silverqx
@@ -722,11 +789,14 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::getAttributeFromArray(
             const QString &key) const
     {
+        const auto &attributesHash = m_attributesHash.get();
+
         // Not found
-        if (!m_attributesHash.contains(key))
+        const auto position = attributesHash.find(key);
+        if (position == attributesHash.cend())
             return {};
 
-        return m_attributes.at(m_attributesHash.at(key)).value;
+        return m_attributes.at(position->second).value;
     }
 
     // NOTE api different, doesn't support key = {} silverqx
@@ -760,7 +830,10 @@ namespace Orm::Tiny::Concerns
             typename HasAttributes<Derived, AllRelations...>::AttributesSizeType> &
     HasAttributes<Derived, AllRelations...>::getOriginalsHash() const
     {
-        return m_originalHash;
+        if (!m_originalHash)
+            m_originalHash.emplace(rehashAttributePositions(m_original));
+
+        return m_originalHash->get();
     }
 
     // NOTE api different silverqx
@@ -770,8 +843,10 @@ namespace Orm::Tiny::Concerns
             const QString &key, const QVariant &defaultValue) const
     {
         // Found
-        if (m_originalHash.contains(key))
-            return m_original.at(m_originalHash.at(key)).value;
+        if (const auto &originalHash = getOriginalsHash();
+            originalHash.contains(key)
+        )
+            return m_original.at(originalHash.at(key)).value;
 
         // Not found, return the default value
         return defaultValue;
@@ -791,23 +866,28 @@ namespace Orm::Tiny::Concerns
         const auto &key = value.key;
 
         // Not found
-        if (!m_attributesHash.contains(key))
+        if (!m_attributesHash.get().contains(key))
             return model();
 
-        const auto position = m_attributesHash.at(key);
+        // Makes a private copy if the hash is shared with another model instance
+        auto &attributesHash = m_attributesHash.detach();
+
+        const auto position = attributesHash.at(key);
 
         // FUTURE all the operations on this containers should be synchronized, later, I think that this is not true because connection or model can be used only from a thread where it was created silverqx
         m_attributes.removeAt(position);
-        m_attributesHash.erase(key);
+        attributesHash.erase(key);
 
         // Rehash attributes, but only attributes which were shifted
-        rehashAttributePositions(m_attributes, m_attributesHash, position);
+        rehashAttributePositions(m_attributes, attributesHash, position);
+        m_castPlan.reset();
 
         /* Need to clear the mutators cache because any mutator can depend on this unset
            attribute, so the recomputation will be needed. */
         m_attributeMutatorsCache.clear();
         // It's enough to clear this cache and recompute when needed
         m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
 
         return model();
     }
@@ -817,22 +897,27 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::unsetAttribute(const QString &key)
     {
         // Not found
-        if (!m_attributesHash.contains(key))
+        if (!m_attributesHash.get().contains(key))
             return model();
 
-        const auto position = m_attributesHash.at(key);
+        // Makes a private copy if the hash is shared with another model instance
+        auto &attributesHash = m_attributesHash.detach();
+
+        const auto position = attributesHash.at(key);
 
         m_attributes.removeAt(position);
-        m_attributesHash.erase(key);
+        attributesHash.erase(key);
 
         // Rehash attributes, but only attributes which were shifted
-        rehashAttributePositions(m_attributes, m_attributesHash, position);
+        rehashAttributePositions(m_attributes, attributesHash, position);
+        m_castPlan.reset();
 
         /* Need to clear the mutators cache because any mutator can depend on this unset
            attribute, so the recomputation will be needed. */
         m_attributeMutatorsCache.clear();
         // It's enough to clear this cache and recompute when needed
         m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
 
         return model();
     }
@@ -943,7 +1028,10 @@ namespace Orm::Tiny::Concerns
             typename HasAttributes<Derived, AllRelations...>::AttributesSizeType> &
     HasAttributes<Derived, AllRelations...>::getChangesHash() const
     {
-        return m_changesHash;
+        if (!m_changesHash)
+            m_changesHash.emplace(rehashAttributePositions(m_changes));
+
+        return m_changesHash->get();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1221,14 +1309,16 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool HasAttributes<Derived, AllRelations...>::hasCast(const QString &key) const
     {
-        return getCasts().contains(key);
+        return findCastItem(key) != nullptr;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool HasAttributes<Derived, AllRelations...>::hasCast(
             const QString &key, const std::unordered_set<CastType> &types) const
     {
-        return hasCast(key) && types.contains(getCastType(key));
+        const auto *const castItem = findCastItem(key);
+
+        return castItem != nullptr && types.contains(castItem->type());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1238,6 +1328,10 @@ namespace Orm::Tiny::Concerns
     {
         auto &userCasts = basemodel().getUserCasts();
 
+        // The newInstance() merges the user casts with themselves, nothing to merge
+        if (&casts == &userCasts)
+            return model();
+
         std::remove_cvref_t<decltype (casts)> mergedCasts;
         mergedCasts.reserve(userCasts.size() + casts.size());
 
@@ -1249,6 +1343,8 @@ namespace Orm::Tiny::Concerns
         // Swap user casts
         userCasts = std::move(mergedCasts);
 
+        invalidateCastPlans();
+
         return model();
     }
 
@@ -1259,6 +1355,8 @@ namespace Orm::Tiny::Concerns
     {
         basemodel().getUserCasts().merge(casts);
 
+        invalidateCastPlans();
+
         return model();
     }
 
@@ -1269,6 +1367,8 @@ namespace Orm::Tiny::Concerns
     {
         basemodel().getUserCasts().merge(std::move(casts));
 
+        invalidateCastPlans();
+
         return model();
     }
 
@@ -1277,6 +1377,8 @@ namespace Orm::Tiny::Concerns
     {
         basemodel().getUserCasts().clear();
 
+        invalidateCastPlans();
+
         return model();
     }
 
@@ -1489,7 +1591,7 @@ namespace Orm::Tiny::Concerns
            we need to return the null QVariant(QString) for the SQLite database, so
            the logic here is, whatever the QtSql driver returns if the QVariant is null
            we will return too. */
-        if (!value.isNull() && getDates().contains(key))
+        if (!value.isNull() && isDatesColumn(key))
             return asDateOrDateTime(value);
 
         return value;
@@ -1501,8 +1603,10 @@ namespace Orm::Tiny::Concerns
             const QString &key, const QVariant &defaultValue) const
     {
         // Found
-        if (m_originalHash.contains(key))
-            return transformModelValue(key, m_original.at(m_originalHash.at(key)).value);
+        if (const auto &originalHash = getOriginalsHash();
+            originalHash.contains(key)
+        )
+            return transformModelValue(key, m_original.at(originalHash.at(key)).value);
 
         // Not found, return the default value
         return defaultValue;
@@ -1540,7 +1644,8 @@ namespace Orm::Tiny::Concerns
     {
         m_changes = getDirty();
 
-        rehashAttributePositions(m_changes, m_changesHash);
+        // Will be rebuilt on first use in the getChangesHash()
+        m_changesHash.reset();
 
         return model();
     }
@@ -1568,9 +1673,11 @@ namespace Orm::Tiny::Concerns
             const auto &modelAttributeValue =
                     modelAttributes.at(modelAttributesHash.at(attribute)).value;
 
+            const auto &originalHash = getOriginalsHash();
+
             // The 'attribute' already exists in the m_original/Hash, update it
-            if (m_originalHash.contains(attribute)) {
-                const auto attributeIndex = m_originalHash.at(attribute);
+            if (originalHash.contains(attribute)) {
+                const auto attributeIndex = originalHash.at(attribute);
                 Q_ASSERT(attributeIndex >= 0 && attributeIndex < m_original.size());
 
                 m_original[attributeIndex].value = modelAttributeValue;
@@ -1587,7 +1694,8 @@ namespace Orm::Tiny::Concerns
 
                 m_original.append({attribute, modelAttributeValue});
 
-                rehashAttributePositions(m_original, m_originalHash, rehashFrom);
+                rehashAttributePositions(m_original, m_originalHash->detach(),
+                                         rehashFrom);
             }
         }
 
@@ -1599,7 +1707,7 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::originalIsEquivalent(
             const QString &key) const
     {
-        if (!m_originalHash.contains(key))
+        if (!getOriginalsHash().contains(key))
             return false;
 
         const auto attribute = getAttributeFromArray(key);
@@ -1672,7 +1780,7 @@ namespace Orm::Tiny::Concerns
     bool
     HasAttributes<Derived, AllRelations...>::isDateAttribute(const QString &key) const
     {
-        return getDates().contains(key) || isDateCastable(key);
+        return isDatesColumn(key) || isDateCastable(key);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -2059,6 +2167,10 @@ namespace Orm::Tiny::Concerns
     CastItem
     HasAttributes<Derived, AllRelations...>::getCastItem(const QString &key) const
     {
+        if (const auto *const castItem = findCastItem(key); castItem != nullptr)
+            return *castItem;
+
+        // Throw the std::out_of_range exception (the same as the getCasts().at(key))
         return getCasts().at(key);
     }
 
@@ -2066,14 +2178,104 @@ namespace Orm::Tiny::Concerns
     CastType
     HasAttributes<Derived, AllRelations...>::getCastType(const QString &key) const
     {
-        return getCasts().at(key).type();
+        return getCastItem(key).type();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const CastItem *
+    HasAttributes<Derived, AllRelations...>::findCastItem(const QString &key) const
+    {
+        // Resolved once for all the models hydrated from the same result
+        if (const auto *const planItem = findCastPlanItem(key); planItem != nullptr)
+            return planItem->castItem ? &*planItem->castItem : nullptr;
+
+        return resolveCastItem(key);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool
+    HasAttributes<Derived, AllRelations...>::isDatesColumn(const QString &key) const
+    {
+        if (const auto *const planItem = findCastPlanItem(key); planItem != nullptr)
+            return planItem->isDatesColumn;
+
+        return resolveIsDatesColumn(key);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const CastItem *
+    HasAttributes<Derived, AllRelations...>::resolveCastItem(const QString &key) const
+    {
+        /* Resolve the cast the same way as the getCasts() but without copying all
+           the u_casts, the cast is resolved on every attribute access, so the copy
+           of the whole hash for every attribute would be very expensive. */
+        const auto &basemodel = this->basemodel();
+
+        // The user defined casts have priority (try_emplace in the getCasts())
+        if (const auto &casts = basemodel.getUserCasts();
+            !casts.empty()
+        )
+            if (const auto castItem = casts.find(key); castItem != casts.end())
+                return &castItem->second;
+
+        // The primary key cast added on the fly, the same as in the getCasts()
+        if (basemodel.getIncrementing() && key == basemodel.getKeyName()) {
+            static const CastItem primaryKeyCast {CastType::ULongLong};
+
+            return &primaryKeyCast;
+        }
+
+        return nullptr;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool
+    HasAttributes<Derived, AllRelations...>::resolveIsDatesColumn(
+            const QString &key) const
+    {
+        // The same as the getDates().contains(key) but without building the vector
+        if (Model<Derived, AllRelations...>::getUserDates().contains(key))
+            return true;
+
+        return basemodel().usesTimestamps() &&
+               Model<Derived, AllRelations...>::timestampColumnNames().contains(key);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const Types::CastPlan::Item *
+    HasAttributes<Derived, AllRelations...>::findCastPlanItem(const QString &key) const
+    {
+        // The casts or dates were modified after the plan was resolved
+        if (!m_castPlan || m_castPlan->castsVersion != castsVersion)
+            return nullptr;
+
+        const auto &attributesHash = m_attributesHash.get();
+
+        // The attribute doesn't exist so it isn't in the plan
+        const auto attribute = attributesHash.find(key);
+        if (attribute == attributesHash.end())
+            return nullptr;
+
+        const auto position = static_cast<std::size_t>(attribute->second);
+
+        Q_ASSERT(position < m_castPlan->items.size());
+
+        return &m_castPlan->items[position];
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::invalidateCastPlans() noexcept
+    {
+        ++castsVersion;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool
     HasAttributes<Derived, AllRelations...>::isDateCastable(const QString &key) const
     {
-        return hasCast(key, {CastType::QDate, CastType::QDateTime, CastType::QTime});
+        const auto *const castItem = findCastItem(key);
+
+        return castItem != nullptr && isDateCastType(castItem->type());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -2081,8 +2283,16 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::isCustomDateCastable(
             const QString &key) const
     {
-        return hasCast(key, {CastType::CustomQDate, CastType::CustomQDateTime,
-                             CastType::CustomQTime});
+        const auto *const castItem = findCastItem(key);
+
+        if (castItem == nullptr)
+            return false;
+
+        const auto castType = castItem->type();
+
+        return castType == CastType::CustomQDate ||
+               castType == CastType::CustomQDateTime ||
+               castType == CastType::CustomQTime;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -2434,6 +2644,102 @@ namespace Orm::Tiny::Concerns
         return time.toString(Qt::ISODateWithMs); // Default is with fractional seconds (ms)
     }
 
+    /* Serialization - CBOR */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::attributesToCbor(
+            QCborStreamWriter &writer) const
+    {
+        // Raw values are written, casts and accessors are applied after restoring
+        writer.startArray(3);
+
+        CborUtils::writeAttributes(writer, m_attributes);
+        CborUtils::writeAttributes(writer, m_original);
+        CborUtils::writeAttributes(writer, m_changes);
+
+        writer.endArray();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::attributesFromCbor(
+            QCborStreamReader &reader)
+    {
+        CborUtils::enterArray(reader);
+
+        // The order of evaluation of the function arguments is unspecified
+        auto attributes = CborUtils::readAttributes(reader);
+        auto original   = CborUtils::readAttributes(reader);
+        auto changes    = CborUtils::readAttributes(reader);
+
+        restoreAttributes(std::move(attributes), std::move(original), std::move(changes));
+
+        CborUtils::leaveContainer(reader);
+    }
+
+    /* Others */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::restoreAttributes(
+            QList<AttributeItem> &&attributes, QList<AttributeItem> &&original,
+            QList<AttributeItem> &&changes)
+    {
+        // Also rebuilds the m_attributesHash and clears the mutators cache
+        setRawAttributes(std::move(attributes), false);
+
+        m_original = std::move(original);
+        m_changes  = std::move(changes);
+
+        // They will be rebuilt lazily
+        m_originalHash.reset();
+        m_changesHash.reset();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived &
+    HasAttributes<Derived, AllRelations...>::setRawAttributesShared(
+            QList<AttributeItem> &&attributes,
+            const Types::AttributesLayout &layout)
+    {
+        Q_ASSERT(attributes.size() ==
+                 static_cast<AttributesSizeType>(layout.attributesHash.get().size()));
+
+        m_attributes = std::move(attributes);
+
+        // Nothing is rebuilt, the first write makes a private copy
+        m_attributesHash = layout.attributesHash;
+        m_castPlan = layout.castPlan;
+
+        syncOriginal();
+
+        m_attributeMutatorsCache.clear();
+        m_modelAttributesCacheForMutators.reset();
+        m_typedSlots.clear();
+
+        return model();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Types::AttributesLayout
+    HasAttributes<Derived, AllRelations...>::shareAttributesLayout()
+    {
+        auto castPlan = std::make_shared<Types::CastPlan>();
+        castPlan->castsVersion = castsVersion;
+        castPlan->items.reserve(static_cast<std::size_t>(m_attributes.size()));
+
+        for (const auto &attribute : std::as_const(m_attributes)) {
+            const auto *const castItem = resolveCastItem(attribute.key);
+
+            castPlan->items.push_back({
+                castItem == nullptr ? std::nullopt : std::make_optional(*castItem),
+                resolveIsDatesColumn(attribute.key),
+            });
+        }
+
+        m_castPlan = std::move(castPlan);
+
+        return {m_attributesHash, m_castPlan};
+    }
+
     /* private */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -5,9 +5,13 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <typeindex>
+
 #include <range/v3/algorithm/contains.hpp>
 
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/invalidtemplateargumenterror.hpp"
+#include "orm/macros/likely.hpp"
 #include "orm/tiny/concerns/hasrelationstore.hpp"
 #include "orm/tiny/exceptions/relationmappingnotfounderror.hpp"
 #include "orm/tiny/exceptions/relationnotloadederror.hpp"
@@ -16,6 +20,9 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/relations/belongstomany.hpp"
 #include "orm/tiny/relations/hasmany.hpp"
 #include "orm/tiny/relations/hasone.hpp"
+#include "orm/tiny/support/modelmetadata.hpp"
+#include "orm/tiny/types/copyonwrite.hpp"
+#include "orm/tiny/utils/cbor.hpp"
 #include "orm/utils/string.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -49,19 +56,19 @@ namespace Concerns
         friend class Concerns::QueriesRelationships<Derived>;
         // To access XyzVisitor()-s, replaceRelations() and few other private methods
         friend class Model<Derived, AllRelations...>;
-        // To access private pushVisited()
-        friend class Support::Stores::PushRelationStore<Derived, AllRelations...>;
+        // To access private pushVisited() and serializeRelationVisited()
+        friend class Support::Stores::DispatchRelationStore<Derived, AllRelations...>;
         // To access private touchOwnersVisited()
         friend class Support::Stores::TouchOwnersRelationStore<Derived, AllRelations...>;
-        // To access private serializeRelationVisited()
-        template<SerializedAttributes C, typename Derived_,
-                 AllRelationsConcept ...AllRelations_>
-        friend class Support::Stores::SerializeRelationStore; // Partial specialization doens't work with friend
-        // To access eagerLoadRelationWithVisitor()
+        // To access private counterCacheVisited()
+        friend class Support::Stores::CounterCacheRelationStore<Derived, AllRelations...>;
+        // To access eagerLoadRelationWithVisitor() and joinLoadRelationWithVisitor()
         friend class Tiny::Builder<Derived>;
 
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
+        /*! Alias for the CBOR utils. */
+        using CborUtils = Orm::Tiny::Utils::Cbor;
         /*! Alias for the string utils. */
         using StringUtils = Orm::Utils::String;
         /*! Alias for the type utils. */
@@ -127,7 +134,7 @@ namespace Concerns
         /*! Get all the loaded relations for the instance. */
         inline const RelationsContainer<AllRelations...> &getRelations() const noexcept;
         /*! Get all the loaded relations for the instance. */
-        inline RelationsContainer<AllRelations...> &getRelations() noexcept;
+        inline RelationsContainer<AllRelations...> &getRelations();
 
         /*! Unset all the loaded relations for the instance. */
         Derived &unsetRelations();
@@ -182,6 +189,18 @@ namespace Concerns
         /*! Clear the u_touches for the model. */
         inline Derived &clearTouches();
 
+        /* Counter caches */
+        /*! Get the belongs-to relationships with the counter cache column on
+            the owner model. */
+        inline const QHash<QString, QString> &getCounterCaches() const;
+        /*! Determine whether the model maintains any counter cache column. */
+        inline bool hasCounterCaches() const;
+
+        /* Owners */
+        /*! Get the types of the owner models (the belongs-to relations from
+            the u_relations). */
+        std::vector<std::type_index> getOwnerTypes() const;
+
         /* Serialization - Relations */
         /*! Convert the model's relationships to the map or vector. */
         template<SerializedAttributes C, typename PivotType = void>
@@ -259,6 +278,20 @@ namespace Concerns
         /*! Get a map of all serializable relations (visible/hidden). */
         RelationsContainer<AllRelations...> getSerializableRelations() const;
 
+        /* Serialization - CBOR */
+        /*! Write all loaded relations and pivot relation names to the CBOR stream. */
+        void relationsToCbor(QCborStreamWriter &writer) const;
+        /*! Restore loaded relations and pivot relation names from the CBOR stream. */
+        void relationsFromCbor(QCborStreamReader &reader);
+
+        /*! Read the relation std::variant alternative by the given index. */
+        static RelationsType<AllRelations...>
+        relationFromCbor(QCborStreamReader &reader, quint64 index);
+        /*! Read the I-th relation std::variant alternative. */
+        template<std::size_t I>
+        static void relationAlternativeFromCbor(QCborStreamReader &reader,
+                                                RelationsType<AllRelations...> &models);
+
         /* Others */
         /*! Compare the u_relations hash (size and keys only). */
         static bool compareURelations(
@@ -271,10 +304,14 @@ namespace Concerns
 
         /* The libstdc++ shipped with the GCC <12.1 doesn't allow an incomplete
            mapped_type (value) in the std::unordered_map. */
-        /*! The loaded relationships for the model. */
-        RelationsContainer<AllRelations...> m_relations;
+        /*! The loaded relationships for the model (implicitly shared, the copies of
+            the same model share them until any of the copies modifies them). */
+        Types::CopyOnWrite<RelationsContainer<AllRelations...>> m_relations;
         /*! The relationships that should be touched on save. */
         QStringList u_touches;
+        /*! The belongs-to relationships with the counter cache column on the owner
+            model (an empty column name for the <table>_count column). */
+        QHash<QString, QString> u_counterCaches;
         // CUR1 use sets instead of QStringList where appropriate silverqx
         /*! Currently loaded Pivot relation names. */
         std::unordered_set<QString> m_pivots;
@@ -321,27 +358,38 @@ namespace Concerns
                 const WithItem &relation, const TinyBuilder<Derived> &builder,
                 ModelsCollection<CollectionModel> &models) const;
 
+        /* Join load relation store related */
+        /*! Obtain a relationship instance for loading using the join. */
+        void joinLoadRelationWithVisitor(
+                const QString &relation, const TinyBuilder<Derived> &builder,
+                QueryBuilder &query, QList<JoinLoadItem<Derived>> &joinLoads) const;
+
         /* Get related table for belongs-to-many relation store related */
         /*! Get Related model table name if the relation is BelongsToMany, otherwise
             return empty std::optional. */
         std::optional<QString>
         getRelatedTableForBelongsToManyWithVisitor(const QString &relation) const;
 
+        /* Dispatch relation store related */
+        /*! Get the relation operations resolved for the given relation name. */
+        const Support::Stores::RelationDispatch<Derived, AllRelations...> &
+        relationDispatch(const QString &relation) const;
+
         /* Push relation store related */
-        /*! Create push store and call push for every model. */
+        /*! Call push for every model using the resolved relation operations. */
         bool pushWithVisitor(const QString &relation,
                              RelationsType<AllRelations...> &models) const;
 
         /*! On the base of alternative held by m_relations decide, which
             pushVisited() to execute. */
         template<typename Related>
-        void pushVisited() const;
+        static bool pushVisited(RelationsType<AllRelations...> &models);
         /*! Push for Many relation types. */
         template<typename Related, typename Tag> requires std::same_as<Tag, Many>
-        void pushVisited() const;
+        static bool pushVisited(RelationsType<AllRelations...> &models);
         /*! Push for One relation type. */
         template<typename Related, typename Tag> requires std::same_as<Tag, One>
-        void pushVisited() const;
+        static bool pushVisited(RelationsType<AllRelations...> &models);
 
         /* Touch owners store related */
         /*! Create 'touch owners relation store' and touch all related models. */
@@ -351,6 +399,25 @@ namespace Concerns
         template<typename Related, typename Relation>
         void touchOwnersVisited(const Relation &relation, const QString &relationName);
 
+        /* Counter cache store related */
+        /*! Update the counter cache columns of the owning models after the write
+            (or collect the updates if the updates of the batch write are passed). */
+        void updateCounterCaches(const QVariantMap &original, bool countedBefore,
+                                 bool countedAfter,
+                                 CounterCacheUpdates *updates = nullptr) const;
+        /*! Create 'counter cache relation store' and update the owner's counter. */
+        void counterCacheWithVisitor(const QString &relation, const QString &column,
+                                     const QVariantMap &original, bool countedBefore,
+                                     bool countedAfter,
+                                     CounterCacheUpdates *updates) const;
+        /*! Decrement the counter of the original owner and increment the counter
+            of the current owner (only the BelongsTo relation is supported). */
+        template<typename Related, typename Relation>
+        void counterCacheVisited(Relation &relation, const QString &relationName,
+                                 const QString &column, const QVariantMap &original,
+                                 bool countedBefore, bool countedAfter,
+                                 CounterCacheUpdates *updates) const;
+
         /* QueriesRelationships store related */
         /*! Create 'QueriesRelationships relation store' to obtain relation instance. */
         template<typename Related = void>
@@ -371,7 +438,7 @@ namespace Concerns
                               const QList<WithItem> &onlyRelations);
 
         /* Serialization - Relations */
-        /*! Create and visit the serialize relation store. */
+        /*! Serialize the relation using the resolved relation operations. */
         template<SerializedAttributes C>
         void serializeRelationWithVisitor(
                 const QString &relation, const RelationsType<AllRelations...> &models,
@@ -500,7 +567,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::relationLoaded(
             const QString &relation) const
     {
-        return m_relations.contains(relation);
+        return m_relations.get().contains(relation);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -509,7 +576,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelation(
             const QString &relation, const ModelsCollection<Related> &models)
     {
-        m_relations[relation] = models;
+        m_relations.detach()[relation] = models;
 
         return model();
     }
@@ -520,7 +587,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelation(
             const QString &relation, ModelsCollection<Related> &&models)
     {
-        m_relations[relation] = std::move(models);
+        m_relations.detach()[relation] = std::move(models);
 
         return model();
     }
@@ -531,7 +598,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelation(
             const QString &relation, const std::optional<Related> &model)
     {
-        m_relations[relation] = model;
+        m_relations.detach()[relation] = model;
 
         return this->model();
     }
@@ -542,7 +609,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelation(
             const QString &relation, std::optional<Related> &&model)
     {
-        m_relations[relation] = std::move(model);
+        m_relations.detach()[relation] = std::move(model);
 
         return this->model();
     }
@@ -556,7 +623,7 @@ namespace Concerns
     {
         m_pivots.insert(relation);
 
-        m_relations[relation] = model;
+        m_relations.detach()[relation] = model;
 
         return this->model();
     }
@@ -570,7 +637,7 @@ namespace Concerns
     {
         m_pivots.insert(relation);
 
-        m_relations[relation] = std::move(model);
+        m_relations.detach()[relation] = std::move(model);
 
         return this->model();
     }
@@ -579,14 +646,15 @@ namespace Concerns
     const RelationsContainer<AllRelations...> &
     HasRelationships<Derived, AllRelations...>::getRelations() const noexcept
     {
-        return m_relations;
+        return m_relations.get();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     RelationsContainer<AllRelations...> &
-    HasRelationships<Derived, AllRelations...>::getRelations() noexcept
+    HasRelationships<Derived, AllRelations...>::getRelations()
     {
-        return m_relations;
+        // The relations can be modified through the returned reference
+        return m_relations.detachUnsharable();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -601,7 +669,7 @@ namespace Concerns
     Derived &
     HasRelationships<Derived, AllRelations...>::unsetRelation(const QString &relation)
     {
-        m_relations.erase(relation);
+        m_relations.detach().erase(relation);
 
         return model();
     }
@@ -814,6 +882,44 @@ namespace Concerns
         return model();
     }
 
+    /* Counter caches */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const QHash<QString, QString> &
+    HasRelationships<Derived, AllRelations...>::getCounterCaches() const
+    {
+        return basemodel().getUserCounterCaches();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool HasRelationships<Derived, AllRelations...>::hasCounterCaches() const
+    {
+        return !getCounterCaches().isEmpty();
+    }
+
+    /* Owners */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::vector<std::type_index>
+    HasRelationships<Derived, AllRelations...>::getOwnerTypes() const
+    {
+        const auto &relations = basemodel().getUserRelations();
+
+        std::vector<std::type_index> ownerTypes;
+        ownerTypes.reserve(static_cast<std::size_t>(relations.size()));
+
+        // The relation types are resolved only once for the Derived model
+        for (auto relation = relations.cbegin(); relation != relations.cend();
+             ++relation
+        )
+            if (const auto &dispatch = relationDispatch(relation.key());
+                dispatch.belongsToOwner != nullptr
+            )
+                ownerTypes.emplace_back(*dispatch.belongsToOwner);
+
+        return ownerTypes;
+    }
+
     /* Serialization - Relations */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -861,9 +967,10 @@ namespace Concerns
         if (!compareURelations(u_relations, right.u_relations))
             return false;
 
-        return m_relations == right.m_relations &&
-               u_touches   == right.u_touches   &&
-               m_pivots    == right.m_pivots;
+        return m_relations     == right.m_relations     &&
+               u_touches       == right.u_touches       &&
+               u_counterCaches == right.u_counterCaches &&
+               m_pivots        == right.m_pivots;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -913,7 +1020,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelations(
             const RelationsContainer<AllRelations...> &relations)
     {
-        m_relations = relations;
+        m_relations = decltype (m_relations)(relations);
 
         return model();
     }
@@ -923,7 +1030,7 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::setRelations(
             RelationsContainer<AllRelations...> &&relations)
     {
-        m_relations = std::move(relations);
+        m_relations = decltype (m_relations)(std::move(relations));
 
         return model();
     }
@@ -1028,22 +1135,28 @@ namespace Concerns
     template<typename Related>
     QString HasRelationships<Derived, AllRelations...>::pivotTableName() const
     {
-        /* The joining table name, by convention, is simply the snake_cased, models
-           sorted alphabetically and concatenated with an underscore, so we can
-           just sort the models and join them together to get the table name. */
-        QStringList segments {
-            // The table name of the current model instance
-            TypeUtils::classPureBasename<Derived>(),
-            // The table name of the related model instance
-            TypeUtils::classPureBasename<Related>(),
-        };
+        // The pivot table name depends only on the model types, compute it only once
+        static const auto pivotTable = []
+        {
+            /* The joining table name, by convention, is simply the snake_cased, models
+               sorted alphabetically and concatenated with an underscore, so we can
+               just sort the models and join them together to get the table name. */
+            QStringList segments {
+                // The table name of the current model instance
+                Support::ModelMetadata<Derived>::instance().classBasename(),
+                // The table name of the related model instance
+                Support::ModelMetadata<Related>::instance().classBasename(),
+            };
+
+            /* Now that we have the model names in the vector, we can just sort them
+               and use the join function to join them together with an underscore,
+               which is typically used by convention within the database system. */
+            segments.sort(Qt::CaseInsensitive);
 
-        /* Now that we have the model names in the vector, we can just sort them and
-           use the join function to join them together with an underscore,
-           which is typically used by convention within the database system. */
-        segments.sort(Qt::CaseInsensitive);
+            return segments.join(UNDERSCORE).toLower();
+        }();
 
-        return segments.join(UNDERSCORE).toLower();
+        return pivotTable;
     }
 
     /* Serialization - Relations */
@@ -1078,6 +1191,140 @@ namespace Concerns
                     hidden);
     }
 
+    /* Serialization - CBOR */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasRelationships<Derived, AllRelations...>::relationsToCbor(
+            QCborStreamWriter &writer) const
+    {
+        writer.startArray(2);
+
+        // All loaded relations, the hidden/visible rules don't apply here
+        const auto &relations = m_relations.get();
+
+        writer.startMap(static_cast<quint64>(relations.size()));
+
+        for (const auto &[relation, models] : relations) {
+            Q_ASSERT(!models.valueless_by_exception());
+
+            writer.append(QStringView(relation));
+
+            /* The std::variant alternative index determines what type has to be
+               restored, it's the same for the same AllRelations template parameters. */
+            writer.startArray(2);
+            writer.append(static_cast<quint64>(models.index()));
+
+            std::visit([&writer](const auto &alternative)
+            {
+                using Alternative = std::remove_cvref_t<decltype (alternative)>;
+
+                if constexpr (std::is_same_v<Alternative, std::monostate>)
+                    writer.appendNull();
+
+                // One type relationship
+                else if constexpr (requires { alternative.has_value(); }) {
+                    if (alternative)
+                        alternative->toCbor(writer);
+                    else // A NULL foreign key
+                        writer.appendNull();
+                }
+                // Many type relationship
+                else
+                    alternative.toCbor(writer);
+            },
+                models);
+
+            writer.endArray();
+        }
+
+        writer.endMap();
+
+        writer.startArray(static_cast<quint64>(m_pivots.size()));
+
+        for (const auto &pivot : m_pivots)
+            writer.append(QStringView(pivot));
+
+        writer.endArray();
+
+        writer.endArray();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasRelationships<Derived, AllRelations...>::relationsFromCbor(
+            QCborStreamReader &reader)
+    {
+        CborUtils::enterArray(reader);
+
+        CborUtils::enterMap(reader);
+
+        while (reader.hasNext()) {
+            auto relation = CborUtils::readString(reader);
+
+            CborUtils::enterArray(reader);
+
+            const auto index = CborUtils::readUnsignedInteger(reader);
+
+            m_relations.detach().insert_or_assign(std::move(relation),
+                                                  relationFromCbor(reader, index));
+
+            CborUtils::leaveContainer(reader);
+        }
+
+        CborUtils::leaveContainer(reader);
+
+        CborUtils::enterArray(reader);
+
+        while (reader.hasNext())
+            m_pivots.insert(CborUtils::readString(reader));
+
+        CborUtils::leaveContainer(reader);
+
+        CborUtils::leaveContainer(reader);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    RelationsType<AllRelations...>
+    HasRelationships<Derived, AllRelations...>::relationFromCbor(
+            QCborStreamReader &reader, const quint64 index)
+    {
+        RelationsType<AllRelations...> models;
+
+        // Dispatch the runtime index to the compile-time alternative index
+        const auto restored = [&reader, &models, index]<std::size_t ...I>(
+                                  std::index_sequence<I...> /*unused*/)
+        {
+            return ((index == I ? (relationAlternativeFromCbor<I>(reader, models), true)
+                                : false) || ...);
+        }(std::make_index_sequence<
+              std::variant_size_v<RelationsType<AllRelations...>>>());
+
+        CborUtils::throwIfInvalid(reader, restored, __tiny_func__);
+
+        return models;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<std::size_t I>
+    void HasRelationships<Derived, AllRelations...>::relationAlternativeFromCbor(
+            QCborStreamReader &reader, RelationsType<AllRelations...> &models)
+    {
+        using Alternative = std::variant_alternative_t<I, RelationsType<AllRelations...>>;
+
+        if constexpr (std::is_same_v<Alternative, std::monostate>)
+            CborUtils::readNull(reader);
+
+        // One type relationship
+        else if constexpr (requires (const Alternative &model) { model.has_value(); }) {
+            if (CborUtils::readNull(reader))
+                models.template emplace<I>(std::nullopt);
+            else
+                models.template emplace<I>(Alternative::value_type::fromCbor(reader));
+        }
+        // Many type relationship
+        else
+            models.template emplace<I>(Alternative::fromCbor(reader));
+    }
+
     /* Others */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1116,7 +1363,8 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::getRelationFromHash(
             const QString &relation)
     {
-        auto &relationVariant = m_relations.find(relation)->second;
+        // The related models can be modified through the returned pointers
+        auto &relationVariant = m_relations.detachUnsharable().find(relation)->second;
 
         // Check relation type to avoid std::bad_variant_access
         checkRelationType<ModelsCollection<Related>, Related>(
@@ -1138,7 +1386,8 @@ namespace Concerns
     HasRelationships<Derived, AllRelations...>::getRelationFromHash(
             const QString &relation)
     {
-        auto &relationVariant = m_relations.find(relation)->second;
+        // The related models can be modified through the returned pointers
+        auto &relationVariant = m_relations.detachUnsharable().find(relation)->second;
 
         // Check relation type to avoid std::bad_variant_access
         checkRelationType<std::optional<Related>, Related>(
@@ -1246,6 +1495,24 @@ namespace Concerns
         this->resetRelationStore();
     }
 
+    /* Join load relation store related */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasRelationships<Derived, AllRelations...>::joinLoadRelationWithVisitor(
+            const QString &relation, const TinyBuilder<Derived> &builder,
+            QueryBuilder &query, QList<JoinLoadItem<Derived>> &joinLoads) const
+    {
+        // Throw exception if a relation is not defined
+        validateUserRelation(relation);
+
+        /* Save the needed variables to the store to avoid passing variables
+           to the visitor. */
+        this->createJoinStore(builder, query, joinLoads, relation).visit(relation);
+
+        // Releases the ownership and destroy the top relation store on the stack
+        this->resetRelationStore();
+    }
+
     /* Get related table for belongs-to-many relation store related */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1273,6 +1540,38 @@ namespace Concerns
         return relatedTable;
     }
 
+    /* Dispatch relation store related */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const Support::Stores::RelationDispatch<Derived, AllRelations...> &
+    HasRelationships<Derived, AllRelations...>::relationDispatch(
+            const QString &relation) const
+    {
+        /*! Alias for the DispatchRelationStore (for shorter name). */
+        using DispatchRelationStore =
+                Support::Stores::DispatchRelationStore<Derived, AllRelations...>;
+
+        /* Already resolved for the Derived model, this is the hot path, it avoids
+           the relation store creation and the u_relations visitation. */
+        if (const auto *const dispatch = DispatchRelationStore::cached(relation);
+            dispatch != nullptr
+        ) T_LIKELY
+            return *dispatch;
+
+        // Throw exception if a relation is not defined
+        validateUserRelation(relation);
+
+        // Create the store and visit relation
+        this->createDispatchRelationStore();
+
+        const auto &dispatch = this->dispatchRelationStore().visitWithResult(relation);
+
+        // Releases the ownership and destroy the top relation store on the stack
+        this->resetRelationStore();
+
+        return dispatch;
+    }
+
     /* Push relation store related */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1287,65 +1586,51 @@ namespace Concerns
         if (variantIndex == 0)
             return true;
 
-        // Throw exception if a relation is not defined
-        validateUserRelation(relation);
-
-        // Save model/s to the store to avoid passing variables to the visitor
-        this->createPushStore(models).visit(relation);
-
-        const auto pushResult = this->pushStore().result();
-
-        // Releases the ownership and destroy the top relation store on the stack
-        this->resetRelationStore();
-
-        return pushResult;
+        // Throws exception if a relation is not defined
+        return relationDispatch(relation).push(models);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<typename Related>
-    void HasRelationships<Derived, AllRelations...>::pushVisited() const
+    bool HasRelationships<Derived, AllRelations...>::pushVisited(
+            RelationsType<AllRelations...> &models)
     {
-        const RelationsType<AllRelations...> &models = this->pushStore().models();
-
         // Invoke pushVisited() on the base of hold alternative in the models
         if (std::holds_alternative<ModelsCollection<Related>>(models))
-            pushVisited<Related, Many>();
+            return pushVisited<Related, Many>(models);
 
-        else if (std::holds_alternative<std::optional<Related>>(models))
-            pushVisited<Related, One>();
+        if (std::holds_alternative<std::optional<Related>>(models))
+            return pushVisited<Related, One>(models);
 
-        else
-            throw Orm::Exceptions::RuntimeError(
-                    "this->pushStore().models() holds unexpected alternative.");
+        throw Orm::Exceptions::RuntimeError(
+                    "The pushed relation models hold unexpected alternative.");
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<typename Related, typename Tag> requires std::same_as<Tag, Many>
-    void HasRelationships<Derived, AllRelations...>::pushVisited() const
+    bool HasRelationships<Derived, AllRelations...>::pushVisited(
+            RelationsType<AllRelations...> &models)
     {
-        auto &pushStore = this->pushStore();
-
-        for (auto &model : std::get<ModelsCollection<Related>>(pushStore.models()))
+        for (auto &model : std::get<ModelsCollection<Related>>(models))
             if (!model.push())
-                return pushStore.setResult(false); // clazy:exclude=returning-void-expression
+                return false;
 
-        pushStore.setResult(true);
+        return true;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<typename Related, typename Tag> requires std::same_as<Tag, One>
-    void HasRelationships<Derived, AllRelations...>::pushVisited() const
+    bool HasRelationships<Derived, AllRelations...>::pushVisited(
+            RelationsType<AllRelations...> &models)
     {
-        auto &pushStore = this->pushStore();
-
-        auto &model = std::get<std::optional<Related>>(pushStore.models());
+        auto &model = std::get<std::optional<Related>>(models);
         Q_ASSERT(model);
 
         // Skip a null model, consider it as success
         if (!model)
-            return pushStore.setResult(true); // clazy:exclude=returning-void-expression
+            return true;
 
-        pushStore.setResult(model->push());
+        return model->push();
     }
 
     /* Touch owners store related */
@@ -1397,6 +1682,108 @@ namespace Concerns
                     "Bad relation type passed to the Model::touchOwnersVisited().");
     }
 
+    /* Counter cache store related */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasRelationships<Derived, AllRelations...>::updateCounterCaches(
+            const QVariantMap &original, const bool countedBefore,
+            const bool countedAfter, CounterCacheUpdates *const updates) const
+    {
+        // Nothing to do, the model wasn't and isn't counted
+        if (!countedBefore && !countedAfter)
+            return;
+
+        const auto &counterCaches = getCounterCaches();
+
+        for (auto it = counterCaches.constBegin(); it != counterCaches.constEnd(); ++it)
+            counterCacheWithVisitor(
+                        it.key(),
+                        it.value().isEmpty()
+                        ? QStringLiteral("%1_count").arg(basemodel().getTable())
+                        : it.value(),
+                        original, countedBefore, countedAfter, updates);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void
+    HasRelationships<Derived, AllRelations...>::counterCacheWithVisitor(
+            const QString &relation, const QString &column, const QVariantMap &original,
+            const bool countedBefore, const bool countedAfter,
+            CounterCacheUpdates *const updates) const
+    {
+        // Throw exception if a relation is not defined
+        validateUserRelation(relation);
+
+        // Save model/s to the store to avoid passing variables to the visitor
+        this->createCounterCacheStore(relation, column, original, countedBefore,
+                                      countedAfter, updates)
+                .visit(relation);
+
+        // Releases the ownership and destroy the top relation store on the stack
+        this->resetRelationStore();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<typename Related, typename Relation>
+    void HasRelationships<Derived, AllRelations...>::counterCacheVisited(
+            Relation &relation, const QString &relationName,
+            const QString &column, const QVariantMap &original,
+            const bool countedBefore, const bool countedAfter,
+            CounterCacheUpdates *const updates) const
+    {
+        // Only the child model knows its owner
+        if constexpr (std::is_same_v<typename Relation::element_type,
+                                     Relations::BelongsTo<Derived, Related>>)
+        {
+            const auto &foreignKey = relation->getForeignKeyName();
+
+            const auto before = original.value(foreignKey);
+            const auto after = basemodel().getAttributeFromArray(foreignKey);
+
+            // Nothing to do, the model is still counted by the same owner
+            if (countedBefore && countedAfter && before == after)
+                return;
+
+            // The batch write sums the amounts, every owner is updated only once
+            if (updates != nullptr) {
+                auto &relationUpdates = updates->relations[relationName];
+
+                /* The relation instance of the first model is used for all the owners,
+                   it only needs the related model and the owner key name. */
+                if (!relationUpdates.update)
+                    relationUpdates.update =
+                            [column,
+                             sharedRelation = std::shared_ptr<
+                                 const typename Relation::element_type>(
+                                     std::move(relation))]
+                            (const qint64 amount, const QVariant &ownerKey)
+                    {
+                        sharedRelation->updateCounterCache(column, amount, ownerKey);
+                    };
+
+                if (countedBefore)
+                    relationUpdates.add(before, -1);
+
+                if (countedAfter)
+                    relationUpdates.add(after, 1);
+
+                return;
+            }
+
+            if (countedBefore)
+                relation->updateCounterCache(column, -1, before);
+
+            if (countedAfter)
+                relation->updateCounterCache(column, 1, after);
+        }
+        else
+            throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' relation in the u_counterCaches of the '%2' "
+                                   "model must be the belongs-to relation in %3().")
+                    .arg(relationName, TypeUtils::classPureBasename<Derived>(),
+                         __tiny_func__));
+    }
+
     /* QueriesRelationships store related */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1428,12 +1815,12 @@ namespace Concerns
     {
         QList<WithItem> relations;
         relations.reserve(static_cast<decltype (relations)::size_type>(
-                              m_relations.size()));
+                              m_relations.get().size()));
 
         /* Get all currently loaded relation names except pivot relations. We need
            to check for the pivot models, but only if the std::variant which holds
            relations also holds a pivot model alternative, otherwise it is useless. */
-        for (const auto &relation : m_relations) {
+        for (const auto &relation : m_relations.get()) {
             const auto &relationName = relation.first;
 
             // Skip pivot relations
@@ -1475,7 +1862,7 @@ namespace Concerns
             if (!relationsContainKey)
                 continue;
 
-            m_relations[key] = std::move(itRelation->second);
+            m_relations.detach()[key] = std::move(itRelation->second);
         }
     }
 
@@ -1487,12 +1874,12 @@ namespace Concerns
             const QString &relation, const RelationsType<AllRelations...> &models,
             C &attributes) const
     {
-        // Save model/s to the store to avoid passing variables to the visitor
-        this->createSerializeRelationStore(relation, models, attributes)
-                .visit(relation);
+        const auto &dispatch = relationDispatch(relation);
 
-        // Releases the ownership and destroy the top relation store on the stack
-        this->resetRelationStore();
+        if constexpr (std::is_same_v<C, QVariantMap>)
+            dispatch.serializeToMap(*this, relation, models, attributes);
+        else
+            dispatch.serializeToList(*this, relation, models, attributes);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
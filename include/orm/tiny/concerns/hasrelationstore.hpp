@@ -6,14 +6,16 @@
 TINY_SYSTEM_HEADER
 
 #include <stack>
+#include <vector>
 
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
 #include "orm/tiny/support/stores/belongstomanyrelatedtablestore.hpp" // IWYU pragma: keep
+#include "orm/tiny/support/stores/countercacherelationstore.hpp" // IWYU pragma: keep
+#include "orm/tiny/support/stores/dispatchrelationstore.hpp" // IWYU pragma: keep
 #include "orm/tiny/support/stores/eagerrelationstore.hpp" // IWYU pragma: keep
+#include "orm/tiny/support/stores/joinrelationstore.hpp" // IWYU pragma: keep
 #include "orm/tiny/support/stores/lazyrelationstore.hpp" // IWYU pragma: keep
-#include "orm/tiny/support/stores/pushrelationstore.hpp" // IWYU pragma: keep
 #include "orm/tiny/support/stores/queriesrelationshipsstore.hpp"
-#include "orm/tiny/support/stores/serializerelationstore.hpp" // IWYU pragma: keep
 #include "orm/tiny/support/stores/touchownersrelationstore.hpp" // IWYU pragma: keep
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -66,10 +68,18 @@ namespace Orm::Tiny::Concerns
                 const Tiny::TinyBuilder<Derived> &builder,
                 ModelsCollection<CollectionModel> &models,
                 const WithItem &relation) const;
-        /*! Factory method to create the push store. */
-        BaseRelationStore &createPushStore(RelationsType<AllRelations...> &models) const;
+        /*! Factory method to create the join store. */
+        BaseRelationStore &
+        createJoinStore(const Tiny::TinyBuilder<Derived> &builder, QueryBuilder &query,
+                        QList<JoinLoadItem<Derived>> &joinLoads,
+                        const QString &relation) const;
         /*! Factory method to create the touch owners store. */
         BaseRelationStore &createTouchOwnersStore(const QString &relation) const;
+        /*! Factory method to create the counter cache store. */
+        BaseRelationStore &
+        createCounterCacheStore(const QString &relation, const QString &column,
+                                const QVariantMap &original, bool countedBefore,
+                                bool countedAfter, CounterCacheUpdates *updates) const;
         /*! Factory method to create the lazy store. */
         template<typename Related>
         BaseRelationStore &createLazyStore() const;
@@ -87,19 +97,13 @@ namespace Orm::Tiny::Concerns
                         void(QueriesRelationshipsCallback<Related> &)> &callback,
                 std::optional<std::reference_wrapper<
                         QStringList>> relations = std::nullopt) const;
-        /*! Factory method to create the store for serializing relationship. */
-        template<SerializedAttributes C>
-        BaseRelationStore &
-        createSerializeRelationStore(
-                const QString &relation, const RelationsType<AllRelations...> &models,
-                C &attributes) const;
+        /*! Factory method to create the store to resolve the relation operations. */
+        BaseRelationStore &createDispatchRelationStore() const;
 
         /*! Release the ownership and destroy the top relation store on the stack. */
         void resetRelationStore() const;
 
         /* Getters for Relation stores */
-        /*! Reference to the push store. */
-        inline PushRelationStore &pushStore() const;
         /*! Cont reference to the touch owners relation store. */
         inline const TouchOwnersRelationStore &touchOwnersStore() const;
         /*! Const reference to the lazy store. */
@@ -112,9 +116,8 @@ namespace Orm::Tiny::Concerns
         template<typename Related = void>
         const QueriesRelationshipsStore<Related> &
         queriesRelationshipsStore() const;
-        /*! Const reference to the serialize relation store. */
-        template<SerializedAttributes C>
-        const SerializeRelationStore<C> &serializeRelationStore() const;
+        /*! Reference to the store to resolve the relation operations. */
+        inline DispatchRelationStore &dispatchRelationStore() const;
 
         /*! Type of the template message to generate. */
         enum struct CopyMoveTemplateType : quint8
@@ -134,9 +137,13 @@ namespace Orm::Tiny::Concerns
         /* Static cast this to a child's instance type (CRTP) */
         TINY_CRTP_MODEL_WITH_BASE_DECLARATIONS
 
+        /* The std::deque (the default std::stack container) allocates even when it's
+           empty, the std::vector doesn't, every model instance and copy has it. */
         /*! The store where the values will be saved, before BaseRelationStore::visit()
             is called. */
-        mutable std::stack<std::shared_ptr<BaseRelationStore>> m_relationStore;
+        mutable std::stack<std::shared_ptr<BaseRelationStore>,
+                           std::vector<std::shared_ptr<BaseRelationStore>>>
+        m_relationStore;
     };
 
     /* I have tried twice to make the m_relationStore to be only one instance per thread
@@ -242,12 +249,14 @@ namespace Orm::Tiny::Concerns
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     typename HasRelationStore<Derived, AllRelations...>::BaseRelationStore &
-    HasRelationStore<Derived, AllRelations...>::createPushStore(
-            RelationsType<AllRelations...> &models) const
+    HasRelationStore<Derived, AllRelations...>::createJoinStore(
+            const Tiny::TinyBuilder<Derived> &builder, QueryBuilder &query,
+            QList<JoinLoadItem<Derived>> &joinLoads, const QString &relation) const
     {
         m_relationStore.push(
-            std::make_shared<PushRelationStore>(const_cast<HasRelationStore *>(this), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                                models));
+            std::make_shared<JoinRelationStore>(
+                const_cast<HasRelationStore *>(this), builder, query, joinLoads, // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                relation));
 
         return *m_relationStore.top();
     }
@@ -263,6 +272,20 @@ namespace Orm::Tiny::Concerns
         return *m_relationStore.top();
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    typename HasRelationStore<Derived, AllRelations...>::BaseRelationStore &
+    HasRelationStore<Derived, AllRelations...>::createCounterCacheStore(
+            const QString &relation, const QString &column, const QVariantMap &original,
+            const bool countedBefore, const bool countedAfter,
+            CounterCacheUpdates *const updates) const
+    {
+        m_relationStore.push(std::make_shared<CounterCacheRelationStore>(
+                                 const_cast<HasRelationStore *>(this), relation, column, // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                 original, countedBefore, countedAfter, updates));
+
+        return *m_relationStore.top();
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<typename Related>
     typename HasRelationStore<Derived, AllRelations...>::BaseRelationStore &
@@ -302,15 +325,11 @@ namespace Orm::Tiny::Concerns
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    template<SerializedAttributes C>
     typename HasRelationStore<Derived, AllRelations...>::BaseRelationStore &
-    HasRelationStore<Derived, AllRelations...>::createSerializeRelationStore(
-            const QString &relation, const RelationsType<AllRelations...> &models,
-            C &attributes) const
+    HasRelationStore<Derived, AllRelations...>::createDispatchRelationStore() const
     {
-        m_relationStore.push(std::make_shared<SerializeRelationStore<C>>(
-                                 const_cast<HasRelationStore *>(this), relation, models, // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                 attributes));
+        m_relationStore.push(std::make_shared<DispatchRelationStore>(
+                                 const_cast<HasRelationStore *>(this))); // NOLINT(cppcoreguidelines-pro-type-const-cast)
 
         return *m_relationStore.top();
     }
@@ -323,13 +342,6 @@ namespace Orm::Tiny::Concerns
 
     /* Getters for Relation stores */
 
-    template<typename Derived, AllRelationsConcept ...AllRelations>
-    typename HasRelationStore<Derived, AllRelations...>::PushRelationStore &
-    HasRelationStore<Derived, AllRelations...>::pushStore() const
-    {
-        return *std::static_pointer_cast<PushRelationStore>(m_relationStore.top());
-    }
-
     template<typename Derived, AllRelationsConcept ...AllRelations>
     const typename HasRelationStore<Derived, AllRelations...>::TouchOwnersRelationStore &
     HasRelationStore<Derived, AllRelations...>::touchOwnersStore() const
@@ -368,13 +380,10 @@ namespace Orm::Tiny::Concerns
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    template<SerializedAttributes C>
-    const typename HasRelationStore<Derived, AllRelations...>::
-          template SerializeRelationStore<C> &
-    HasRelationStore<Derived, AllRelations...>::serializeRelationStore() const
+    typename HasRelationStore<Derived, AllRelations...>::DispatchRelationStore &
+    HasRelationStore<Derived, AllRelations...>::dispatchRelationStore() const
     {
-        return *std::static_pointer_cast<
-                const SerializeRelationStore<C>>(m_relationStore.top());
+        return *std::static_pointer_cast<DispatchRelationStore>(m_relationStore.top());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
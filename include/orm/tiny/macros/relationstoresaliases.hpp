@@ -30,32 +30,35 @@ TINY_SYSTEM_HEADER
     using BelongsToManyRelatedTableStore =                                              \
           Support::Stores::BelongsToManyRelatedTableStore<Derived, AllRelations...>;    \
                                                                                         \
+    /*! Alias for the CounterCacheRelationStore (for shorter name). */                  \
+    using CounterCacheRelationStore =                                                   \
+          Support::Stores::CounterCacheRelationStore<Derived, AllRelations...>;         \
+                                                                                        \
+    /*! Alias for the DispatchRelationStore (for shorter name). */                      \
+    using DispatchRelationStore =                                                       \
+          Support::Stores::DispatchRelationStore<Derived, AllRelations...>;             \
+                                                                                        \
     /*! Alias for the EagerRelationStore (for shorter name). */                         \
     template<TINY_RSA_ERS_CLANG16(TINY_RSA_ERS_IS_CLANG16) CollectionModel>             \
     using EagerRelationStore =                                                          \
           Support::Stores::                                                             \
                    EagerRelationStore<Derived, CollectionModel, AllRelations...>;       \
                                                                                         \
+    /*! Alias for the JoinRelationStore (for shorter name). */                          \
+    using JoinRelationStore =                                                           \
+          Support::Stores::JoinRelationStore<Derived, AllRelations...>;                 \
+                                                                                        \
     /*! Alias for the LazyRelationStore (for shorter name). */                          \
     template<typename Related>                                                          \
     using LazyRelationStore =                                                           \
           Support::Stores::LazyRelationStore<Derived, Related, AllRelations...>;        \
                                                                                         \
-    /*! Alias for the PushRelationStore (for shorter name). */                          \
-    using PushRelationStore =                                                           \
-          Support::Stores::PushRelationStore<Derived, AllRelations...>;                 \
-                                                                                        \
     /*! Alias for the QueriesRelationshipsStore (for shorter name). */                  \
     template<typename Related>                                                          \
     using QueriesRelationshipsStore =                                                   \
           Support::Stores::                                                             \
                    QueriesRelationshipsStore<Derived, Related, AllRelations...>;        \
                                                                                         \
-    /*! Alias for the SerializeRelationStore (for shorter name). */                     \
-    template<SerializedAttributes C>                                                    \
-    using SerializeRelationStore =                                                      \
-          Support::Stores::SerializeRelationStore<C, Derived, AllRelations...>;         \
-                                                                                        \
     /*! Alias for the TouchOwnersRelationStore (for shorter name). */                   \
     using TouchOwnersRelationStore =                                                    \
           Support::Stores::TouchOwnersRelationStore<Derived, AllRelations...>;
@@ -7,8 +7,14 @@ TINY_SYSTEM_HEADER
 
 #include <QJsonObject>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include "orm/concerns/hasconnectionresolver.hpp"
 #include "orm/connectionresolverinterface.hpp"
+#include "orm/macros/likely.hpp"
+#include "orm/macros/threadlocal.hpp"
 #include "orm/tiny/concerns/guardsattributes.hpp"
 #include "orm/tiny/concerns/hasattributes.hpp"
 #include "orm/tiny/concerns/hasrelationships.hpp"
@@ -16,7 +22,10 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/concerns/hidesattributes.hpp"
 #include "orm/tiny/exceptions/massassignmenterror.hpp"
 #include "orm/tiny/modelproxies.hpp"
+#include "orm/tiny/support/modelmetadata.hpp"
 #include "orm/tiny/tinybuilder.hpp" // IWYU pragma: keep
+#include "orm/tiny/typedcolumns.hpp"
+#include "orm/tiny/utils/json.hpp"
 #ifdef TINYORM_TESTS_CODE
 #  include "orm/tiny/types/connectionoverride.hpp"
 #endif
@@ -27,6 +36,7 @@ namespace Orm::Tiny
 {
     template<typename Derived>
     class SoftDeletes;
+    class UnitOfWork;
 
     /*! Alias for the Concerns::GuardedModel, shortcut alias. */
     using Concerns::GuardedModel; // Don't remove // NOLINT(misc-unused-using-decls)
@@ -65,9 +75,15 @@ namespace Orm::Tiny
         // FUTURE try to solve problem with forward declarations for friend methods, to allow only relevant methods from TinyBuilder silverqx
         // Used by TinyBuilder::eagerLoadRelations()
         friend TinyBuilder<Derived>;
+        // To access restoreAttributes() (reverts the failed flush)
+        friend UnitOfWork;
 
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
+        /*! Alias for the CBOR utils. */
+        using CborUtils = Orm::Tiny::Utils::Cbor;
+        /*! Alias for the JSON utils. */
+        using JsonUtils = Orm::Tiny::Utils::Json;
         /*! Alias for the helper utils. */
         using Helpers = Orm::Utils::Helpers;
         /*! Alias for the string utils. */
@@ -194,6 +210,15 @@ namespace Orm::Tiny
         /*! Destroy the model by the given ID. */
         inline static std::size_t destroy(const QVariant &id);
 
+        /*! Save all the given models, new models are inserted using the multi-rows
+            insert and existing models with the same dirty attributes are updated
+            using one update statement (instead of one statement for every model). */
+        static bool saveMany(const ModelsCollection<Derived *> &models,
+                             SaveOptions options = {});
+        /*! Delete all the given models, one delete statement is used for every chunk
+            of the keys (performs the soft delete if the model extends SoftDeletes). */
+        static std::size_t removeMany(const ModelsCollection<Derived *> &models);
+
         /* Operations on a Model instance */
         /*! Save the model to the database. */
         bool save(SaveOptions options = {});
@@ -287,6 +312,11 @@ namespace Orm::Tiny
         Derived
         newFromBuilder(QList<AttributeItem> &&attributes = {},
                        const std::optional<QString> &connection = std::nullopt) const;
+        /*! Create a new model instance that is existing, it shares the given
+            attributes layout (of the same attribute names w/o duplicates). */
+        Derived
+        newFromBuilder(QList<AttributeItem> &&attributes,
+                       const Types::AttributesLayout &layout) const;
         /*! Create a new instance of the given model. */
         inline Derived newInstance() const;
         /*! Create a new instance of the given model. */
@@ -325,6 +355,20 @@ namespace Orm::Tiny
         /*! Convert the model instance to JSON. */
         inline QByteArray
         toJson(QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write the model instance as JSON to the given device. */
+        inline bool
+        toJson(QIODevice &device,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+
+        /*! Convert the model instance to CBOR (raw attributes, original, changes,
+            and loaded relations, used for caching). */
+        QByteArray toCbor() const;
+        /*! Write the model instance to the CBOR stream. */
+        void toCbor(QCborStreamWriter &writer) const;
+        /*! Restore the model instance from CBOR created by the toCbor(). */
+        static Derived fromCbor(const QByteArray &cbor);
+        /*! Read the model instance from the CBOR stream. */
+        static Derived fromCbor(QCborStreamReader &reader);
 
         /* Getters / Setters */
         /*! Get the current connection name for the model. */
@@ -354,6 +398,15 @@ namespace Orm::Tiny
         /*! Get the default foreign key name for the model. */
         QString getForeignKey() const;
 
+        /* Typed columns */
+        /*! Get the raw attribute value of the column declared in the Derived::Columns
+            converted to the declared type (doesn't apply casts or accessors). */
+        template<ColumnName Name>
+        auto getTypedAttribute() const;
+        /*! Set the attribute value of the column declared in the Derived::Columns. */
+        template<ColumnName Name, typename T>
+        Derived &setTypedAttribute(T &&value);
+
         /* Others */
         /*! Qualify the given column name by the model's table. */
         QString qualifyColumn(const QString &column) const;
@@ -398,9 +451,48 @@ namespace Orm::Tiny
         /*! Perform any actions that are necessary after the model is saved. */
         void finishSave(SaveOptions options = {});
 
+        /*! Call the given write callback and update the counter cache columns
+            of the owning models, both in one transaction. */
+        bool runWithCounterCaches(const std::function<bool()> &callback);
+        /*! Call the given batch write callback and update the counter cache columns
+            of the owning models, one update for every owner, both in one
+            transaction. */
+        template<typename Callback>
+        static std::invoke_result_t<Callback>
+        runManyWithCounterCaches(const ModelsCollection<Derived *> &models,
+                                 Callback &&callback);
+        /*! Determine whether the model is counted by the counter caches (it exists
+            and isn't soft deleted). */
+        bool isCountedByCounterCaches() const;
+        /*! Determine whether the model with the given original attributes was
+            counted by the counter caches. */
+        bool isCountedByCounterCaches(const QVariantMap &original) const;
+
         /*! Insert the given attributes and set the ID on the model. */
         quint64 insertAndSetId(const TinyBuilder<Derived> &query,
                                const QList<AttributeItem> &attributes);
+        /*! Insert the given new models using the multi-rows insert and set their IDs
+            (all models must have the same connection and the same attributes). */
+        static void insertMany(const ModelsCollection<Derived *> &models,
+                               const QList<QVariantMap> &values, SaveOptions options);
+        /*! Update the given existing models using one update statement (all models
+            must have the same connection and the same dirty attributes). */
+        static void updateMany(const ModelsCollection<Derived *> &models,
+                               const QList<QVariantMap> &values, SaveOptions options);
+
+        /*! Perform the actual delete query on all the given models. */
+        static std::size_t performDeleteOnModels(
+                const ModelsCollection<Derived *> &models);
+        /*! Call the callback for every chunk of the existing models with the query
+            constrained by their keys (models are grouped by the connection), the chunk
+            size leaves room for the given number of other bindings (eg. SET values). */
+        template<typename Callback>
+        static std::size_t
+        chunkByKeys(const ModelsCollection<Derived *> &models, Callback &&callback,
+                    qsizetype otherBindings = 0);
+
+        /*! The maximum number of bindings in one statement. */
+        constexpr static qsizetype MaxBindings = QueryBuilder::MaxBindings;
 
         /* Data members */
         /*! The table associated with the model. */
@@ -508,6 +600,8 @@ namespace Orm::Tiny
         inline const QStringList &getUserTouches() const noexcept;
         /*! Get the u_touches relation names to touch from the Derived model. */
         inline QStringList &getUserTouches() noexcept;
+        /*! Get the u_counterCaches relations and columns from the Derived model. */
+        inline const QHash<QString, QString> &getUserCounterCaches() const noexcept;
 
         /* HasTimestamps */
         /*! Get the u_timestamps attribute from the Derived model. */
@@ -811,6 +905,108 @@ namespace Orm::Tiny
         return destroy(QList<QVariant> {id});
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::saveMany(
+            const ModelsCollection<Derived *> &models, const SaveOptions options)
+    {
+        /*! Models with the same connection and the same attributes to save. */
+        struct SaveGroup
+        {
+            /*! Models to save. */
+            ModelsCollection<Derived *> models;
+            /*! Attributes of the models to save (the same order as models). */
+            QList<QVariantMap> values;
+        };
+
+        /* Every multi-rows insert or update statement must have the same columns, so
+           models are grouped by the connection name followed by the attribute names
+           (all attributes of new models and dirty attributes of existing models). */
+        std::map<QStringList, SaveGroup> insertGroups;
+        std::map<QStringList, SaveGroup> updateGroups;
+        // All the models saved using the multi-rows insert or update statements
+        ModelsCollection<Derived *> batchModels;
+
+        auto saved = true;
+
+        for (auto *const derived : models) {
+            Model &model = *derived;
+
+            /* Models w/o attributes or dirty attributes are saved as usual, pivot
+               models can have a composite key so they are also saved one by one. */
+            if (model.getAttributes().isEmpty() ||
+                (model.exists &&
+                 (std::is_base_of_v<Relations::IsPivotModel, Derived> ||
+                  !model.isDirty()))
+            ) {
+                saved = model.save(options) && saved;
+                continue;
+            }
+
+            // The same as in the performInsert() and performUpdate()
+            if (model.usesTimestamps())
+                model.updateTimestamps();
+
+            auto values = AttributeUtils::convertVectorToMap(
+                              model.exists ? model.getDirty() : model.getAttributes());
+
+            // The changed primary key can't be matched by the update statement
+            if (model.exists && values.contains(model.getKeyName())) {
+                saved = model.save(options) && saved;
+                continue;
+            }
+
+            auto groupKey = values.keys();
+            groupKey.prepend(model.getConnectionName());
+
+            if (model.exists)
+                values.insert(model.getKeyName(), model.getKeyForSaveQuery());
+
+            auto &saveGroup = (model.exists ? updateGroups : insertGroups)[groupKey];
+            saveGroup.models << derived;
+            saveGroup.values << std::move(values);
+
+            batchModels << derived;
+        }
+
+        // The counters of the owners are updated once for all the batch written models
+        runManyWithCounterCaches(batchModels, [&insertGroups, &updateGroups, options]
+        {
+            for (const auto &[groupKey, insertGroup] : insertGroups)
+                insertMany(insertGroup.models, insertGroup.values, options);
+
+            for (const auto &[groupKey, updateGroup] : updateGroups)
+                updateMany(updateGroup.models, updateGroup.values, options);
+        });
+
+        return saved;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::size_t Model<Derived, AllRelations...>::removeMany(
+            const ModelsCollection<Derived *> &models)
+    {
+        // Nothing to do
+        if (models.isEmpty())
+            return 0;
+
+        if (models.constFirst()->getKeyName().isEmpty())
+            throw Orm::Exceptions::RuntimeError("No primary key defined on model.");
+
+        // The same as in the remove(), touch the owning models before the delete
+        for (const auto *const model : models)
+            if (model->exists)
+                model->touchOwners();
+
+        // The counters of the owners are updated once for all the deleted models
+        return runManyWithCounterCaches(models, [&models]
+        {
+            if constexpr (extendsSoftDeletes())
+                return Derived::runSoftDeleteMany(models);
+            else
+                return performDeleteOnModels(models);
+        });
+    }
+
     /* Operations on a Model instance */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -834,13 +1030,20 @@ namespace Orm::Tiny
            that is already in this database using the current IDs in this "where"
            clause to only update this model. Otherwise, we'll just insert them. */
         if (exists)
-            saved = this->isDirty() ? performUpdate(*query) : true;
+            saved = !this->isDirty() ||
+                    runWithCounterCaches([this, &query]
+            {
+                return performUpdate(*query);
+            });
 
         /* If the model is brand new, we'll insert it into our database and set the
            ID attribute on the model to the value of the newly inserted row's ID
            which is typically an auto-increment value managed by the database. */
         else {
-            saved = performInsert(*query);
+            saved = runWithCounterCaches([this, &query]
+            {
+                return performInsert(*query);
+            });
 
             if (const auto &connection = query->getConnection();
                 getConnectionName().isEmpty()
@@ -867,7 +1070,7 @@ namespace Orm::Tiny
         /* To sync all of the relationships to the database, we will simply spin through
            the relationships and save each model via this "push" method, which allows
            us to recurse into all of these nested relations for the model instance. */
-        for (auto &[relation, models] : this->m_relations)
+        for (auto &[relation, models] : this->m_relations.detach())
             /* Following Eloquent API, if any push failed, then quit, remaining push-es
                will not be processed. */
             if (!this->pushWithVisitor(relation, models))
@@ -936,10 +1139,15 @@ namespace Orm::Tiny
 
         // FUTURE performDeleteOnModel() and return value, check logic here, eg what happens when no model is delete and combinations silverqx
         // FUTURE inconsistent return values save(), update(), remove(), ..., also Pivot::remove() silverqx
-        if constexpr (Model::extendsSoftDeletes())
-            model().SoftDeletes<Derived>::performDeleteOnModel();
-        else
-            Model::performDeleteOnModel();
+        runWithCounterCaches([this]
+        {
+            if constexpr (Model::extendsSoftDeletes())
+                model().SoftDeletes<Derived>::performDeleteOnModel();
+            else
+                Model::performDeleteOnModel();
+
+            return true;
+        });
 
         /* Once the model has been deleted, we will fire off the deleted event so that
            the developers may hook into post-delete operations. We will then return
@@ -1111,18 +1319,19 @@ namespace Orm::Tiny
            model, the u_xyz data members are compared here. I don't like it though,
            one caveat of this is that if a user defines the operator==() then these
            data members will be compared twice. */
-        return model.u_table        == derivedRight.u_table        &&
-               model.u_incrementing == derivedRight.u_incrementing &&
-               model.u_primaryKey   == derivedRight.u_primaryKey   &&
-               model.u_with         == derivedRight.u_with         &&
-//               model.u_withCount    == derivedRight.u_withCount    &&
-               model.u_connection   == derivedRight.u_connection   &&
+        return model.u_table         == derivedRight.u_table         &&
+               model.u_incrementing  == derivedRight.u_incrementing  &&
+               model.u_primaryKey    == derivedRight.u_primaryKey    &&
+               model.u_with          == derivedRight.u_with          &&
+//               model.u_withCount     == derivedRight.u_withCount     &&
+               model.u_connection    == derivedRight.u_connection    &&
                // HasAttributes
-               model.u_appends      == derivedRight.u_appends      &&
+               model.u_appends       == derivedRight.u_appends       &&
                // HasRelationships
-               model.u_touches      == derivedRight.u_touches      &&
+               model.u_touches       == derivedRight.u_touches       &&
+               model.u_counterCaches == derivedRight.u_counterCaches &&
                // HasTimestamps
-               model.u_timestamps   == derivedRight.u_timestamps;
+               model.u_timestamps    == derivedRight.u_timestamps;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1311,6 +1520,21 @@ namespace Orm::Tiny
         return model;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived
+    Model<Derived, AllRelations...>::newFromBuilder(
+            QList<AttributeItem> &&attributes,
+            const Types::AttributesLayout &layout) const
+    {
+        auto model = newInstance({}, true);
+
+        model.setRawAttributesShared(std::move(attributes), layout);
+
+        model.setConnection(getConnectionName());
+
+        return model;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived
     Model<Derived, AllRelations...>::newInstance() const
@@ -1383,7 +1607,8 @@ namespace Orm::Tiny
         {
             instance.setRawAttributes(std::move(attributes));
 
-            instance.setRelations(this->getRelations());
+            // The relations are implicitly shared with the replicated model
+            instance.m_relations = this->m_relations;
         });
     }
 
@@ -1455,7 +1680,89 @@ namespace Orm::Tiny
     QByteArray
     Model<Derived, AllRelations...>::toJson(const QJsonDocument::JsonFormat format) const
     {
-        return toJsonDocument().toJson(format);
+        // Write the JSON directly, no QJsonObject/QJsonDocument copies are needed
+        return JsonUtils::toJson(toMap(), format);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool
+    Model<Derived, AllRelations...>::toJson(
+            QIODevice &device, const QJsonDocument::JsonFormat format) const
+    {
+        return JsonUtils::toJson(device, toMap(), format);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QByteArray Model<Derived, AllRelations...>::toCbor() const
+    {
+        QByteArray cbor;
+        QCborStreamWriter writer(&cbor);
+
+        toCbor(writer);
+
+        return cbor;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void Model<Derived, AllRelations...>::toCbor(QCborStreamWriter &writer) const
+    {
+        writer.startArray(5);
+
+        // To detect the CBOR data created by another model type
+        writer.append(QStringView(
+                          Support::ModelMetadata<Derived>::instance().classBasename()));
+        writer.append(exists);
+
+        // Only the connection set on this model instance
+        if (const auto &connection = model().u_connection; connection.isEmpty())
+            writer.appendNull();
+        else
+            writer.append(QStringView(connection));
+
+        this->attributesToCbor(writer);
+        this->relationsToCbor(writer);
+
+        writer.endArray();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived Model<Derived, AllRelations...>::fromCbor(const QByteArray &cbor)
+    {
+        QCborStreamReader reader(cbor);
+
+        return fromCbor(reader);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived Model<Derived, AllRelations...>::fromCbor(QCborStreamReader &reader)
+    {
+        CborUtils::enterArray(reader);
+
+        const auto &classBasename =
+                Support::ModelMetadata<Derived>::instance().classBasename();
+
+        if (const auto className = CborUtils::readString(reader);
+            className != classBasename
+        ) T_UNLIKELY
+            throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("The CBOR data were created by the '%1' model, "
+                                   "they can't be restored as the '%2' model in %3().")
+                    .arg(className, classBasename, __tiny_func__));
+
+        // The attributes will be replaced so don't fill the default attributes
+        Derived model(dontFillDefaultAttributes);
+
+        model.exists = CborUtils::readBool(reader);
+
+        if (!CborUtils::readNull(reader))
+            model.setConnection(CborUtils::readString(reader));
+
+        model.attributesFromCbor(reader);
+        model.relationsFromCbor(reader);
+
+        CborUtils::leaveContainer(reader);
+
+        return model;
     }
 
     /* Getters / Setters */
@@ -1523,11 +1830,11 @@ namespace Orm::Tiny
 
         const auto &table = model.u_table;
 
-        // Guess as pluralized snake_case table name and set the u_table
+        /* Guess as pluralized snake_case table name and set the u_table, the guessed
+           name is computed only once for the Derived model type. */
         if (table.isEmpty())
             const_cast<QString &>(model.u_table) =
-                TMPL_PLURAL.arg(
-                    StringUtils::snake(TypeUtils::classPureBasename<Derived>()));
+                    Support::ModelMetadata<Derived>::instance().guessedTable();
 
         return table;
     }
@@ -1582,10 +1889,67 @@ namespace Orm::Tiny
     QString Model<Derived, AllRelations...>::getForeignKey() const
     {
         return QStringLiteral("%1_%2").arg(
-                    StringUtils::snake(TypeUtils::classPureBasename<Derived>()),
+                    Support::ModelMetadata<Derived>::instance().snakeName(),
                     getKeyName());
     }
 
+    /* Typed columns */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<ColumnName Name>
+    auto Model<Derived, AllRelations...>::getTypedAttribute() const
+    {
+        using Columns = typename Derived::Columns;
+        static_assert(Columns::template contains<Name>,
+                      "The column isn't declared in the Derived::Columns.");
+
+        using ColumnType = typename Columns::template TypeOf<Name>;
+
+        // The slot index is resolved at compile-time
+        auto &slot = std::get<Columns::template indexOf<Name>()>(
+                         this->m_typedSlots.template get<typename Columns::Slots>());
+
+        // Already converted, no lookup and no QVariant unboxing
+        if (slot) T_LIKELY
+            return *slot;
+
+        // Initialize as late as possible
+        static const auto key = Name.toString();
+
+        const auto &attributesHash = this->m_attributesHash.get();
+
+        // Found, convert it only once, the slot is cleared on every attribute write
+        if (const auto position = attributesHash.find(key);
+            position != attributesHash.end()
+        )
+            return slot.emplace(this->m_attributes.at(position->second).value
+                                .template value<ColumnType>());
+
+        // Not found, return the default value of the declared type
+        return ColumnType {};
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<ColumnName Name, typename T>
+    Derived &Model<Derived, AllRelations...>::setTypedAttribute(T &&value)
+    {
+        using Columns = typename Derived::Columns;
+        static_assert(Columns::template contains<Name>,
+                      "The column isn't declared in the Derived::Columns.");
+
+        using ColumnType = typename Columns::template TypeOf<Name>;
+        static_assert(std::is_convertible_v<T, ColumnType>,
+                      "The value isn't convertible to the declared column type.");
+
+        // Initialize as late as possible
+        static const auto key = Name.toString();
+
+        /* The setAttribute() is called so the mutators, dates, and the dirty tracking
+           work the same way as for the dynamic attributes. */
+        return this->setAttribute(
+                    key, QVariant::fromValue(ColumnType(std::forward<T>(value))));
+    }
+
     /* Others */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1656,9 +2020,9 @@ namespace Orm::Tiny
     {
         // Found
         if (const auto &keyName = getKeyName();
-            this->m_originalHash.contains(keyName)
+            this->getOriginalsHash().contains(keyName)
         )
-            return this->m_original.at(this->m_originalHash.at(keyName)).value;
+            return this->m_original.at(this->getOriginalsHash().at(keyName)).value;
 
         // Not found, return the primary key value
         return getKey();
@@ -1763,6 +2127,155 @@ namespace Orm::Tiny
         this->syncOriginal();
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::runWithCounterCaches(
+            const std::function<bool()> &callback)
+    {
+        // Nothing to do
+        if (!this->hasCounterCaches())
+            return std::invoke(callback);
+
+        /* The original attributes are synced with the current values during the write,
+           so the original foreign keys must be saved before. */
+        const auto original = AttributeUtils::convertVectorToMap(this->getRawOriginals());
+        const auto countedBefore = isCountedByCounterCaches(original);
+
+        auto &connection = getConnection();
+        const auto inTransaction = connection.inTransaction();
+
+        // The write and the counters update must succeed or fail together
+        if (!inTransaction)
+            connection.beginTransaction();
+
+        try {
+            const auto written = std::invoke(callback);
+
+            if (written)
+                this->updateCounterCaches(original, countedBefore,
+                                          isCountedByCounterCaches());
+
+            if (!inTransaction)
+                connection.commit();
+
+            return written;
+
+        } catch (...) {
+            if (!inTransaction)
+                connection.rollBack();
+
+            throw;
+        }
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<typename Callback>
+    std::invoke_result_t<Callback>
+    Model<Derived, AllRelations...>::runManyWithCounterCaches(
+            const ModelsCollection<Derived *> &models, Callback &&callback)
+    {
+        // Nothing to do
+        if (models.isEmpty() || !models.constFirst()->hasCounterCaches())
+            return std::invoke(std::forward<Callback>(callback));
+
+        /*! The model and its state before the batch write. */
+        struct CountedModel
+        {
+            /*! The written model. */
+            Derived *model;
+            /*! The original attributes before the write. */
+            QVariantMap original;
+            /*! Determine whether the model was counted before the write. */
+            bool countedBefore;
+        };
+
+        /* The original attributes are synced with the current values during the write,
+           so the original foreign keys must be saved before, the same as in
+           the runWithCounterCaches(). */
+        std::vector<CountedModel> countedModels;
+        countedModels.reserve(static_cast<std::size_t>(models.size()));
+
+        for (auto *const derived : models) {
+            const Model &model = *derived;
+
+            auto original = AttributeUtils::convertVectorToMap(model.getRawOriginals());
+            const auto countedBefore = model.isCountedByCounterCaches(original);
+
+            countedModels.push_back({derived, std::move(original), countedBefore});
+        }
+
+        // Sum the amounts of all the models and update every owner only once
+        const auto updateCounterCaches = [&countedModels]
+        {
+            CounterCacheUpdates updates;
+
+            for (const auto &[derived, original, countedBefore] : countedModels) {
+                const Model &model = *derived;
+
+                model.updateCounterCaches(original, countedBefore,
+                                          model.isCountedByCounterCaches(), &updates);
+            }
+
+            updates.apply();
+        };
+
+        auto &connection = models.constFirst()->getConnection();
+        const auto inTransaction = connection.inTransaction();
+
+        // The batch write and the counters update must succeed or fail together
+        if (!inTransaction)
+            connection.beginTransaction();
+
+        try {
+            using Result = std::invoke_result_t<Callback>;
+
+            if constexpr (std::is_void_v<Result>) {
+                std::invoke(std::forward<Callback>(callback));
+
+                updateCounterCaches();
+
+                if (!inTransaction)
+                    connection.commit();
+
+            } else {
+                auto result = std::invoke(std::forward<Callback>(callback));
+
+                updateCounterCaches();
+
+                if (!inTransaction)
+                    connection.commit();
+
+                return result;
+            }
+
+        } catch (...) {
+            if (!inTransaction)
+                connection.rollBack();
+
+            throw;
+        }
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::isCountedByCounterCaches() const
+    {
+        if constexpr (extendsSoftDeletes())
+            return exists && !model().trashed();
+        else
+            return exists;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::isCountedByCounterCaches(
+            const QVariantMap &original) const
+    {
+        if constexpr (extendsSoftDeletes()) {
+            const auto deletedAt = original.value(Derived::getDeletedAtColumn());
+
+            return exists && (!deletedAt.isValid() || deletedAt.isNull());
+        } else
+            return exists;
+    }
+
     // FEATURE dilemma primarykey, add support for Derived::KeyType silverqx
     template<typename Derived, AllRelationsConcept ...AllRelations>
     quint64 Model<Derived, AllRelations...>::insertAndSetId(
@@ -1783,6 +2296,186 @@ namespace Orm::Tiny
         return id;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void Model<Derived, AllRelations...>::insertMany(
+            const ModelsCollection<Derived *> &models, const QList<QVariantMap> &values,
+            const SaveOptions options)
+    {
+        Q_ASSERT(!models.isEmpty() && models.size() == values.size());
+
+        const Model &firstModel = *models.constFirst();
+
+        // Ownership of a unique_ptr()
+        const auto query = firstModel.newModelQuery();
+        const auto &keyName = firstModel.getKeyName();
+        const auto incrementing = firstModel.getIncrementing();
+
+        // Keep the number of bindings under the limit of all supported databases
+        const auto chunkSize = std::max<qsizetype>(
+                                   1, MaxBindings / values.constFirst().size());
+
+        auto &connection = query->getConnection();
+
+        /* The primary keys set by a user must be kept, the generated IDs can't be
+           obtained for them anyway (the models in one group have the same columns). */
+        const auto obtainIds = incrementing && !values.constFirst().contains(keyName);
+
+        /* All chunks must be inserted or none of them, also the inserted rows must be
+           rolled back if their IDs can't be obtained. */
+        const auto useTransaction = (obtainIds || values.size() > chunkSize) &&
+                                    !connection.inTransaction();
+
+        if (useTransaction)
+            connection.beginTransaction();
+
+        // Number of the models with the assigned ID (they are reverted on failure)
+        qsizetype assignedIds = 0;
+
+        try {
+            for (qsizetype offset = 0; offset < values.size(); offset += chunkSize) {
+                const auto chunk = values.mid(offset, chunkSize);
+
+                // The same as in the performInsert() but for all models at once
+                if (!obtainIds) {
+                    query->getQuery().insert(chunk);
+                    continue;
+                }
+
+                const auto ids = query->getQuery().insertGetIds(chunk, keyName);
+
+                if (ids.size() != chunk.size()) T_UNLIKELY {
+                    // Nothing is inserted while pretending
+                    if (connection.pretending())
+                        continue;
+
+                    throw Orm::Exceptions::RuntimeError(
+                            QStringLiteral(
+                                "Failed to obtain the primary keys of the inserted "
+                                "'%1' models, %2 keys obtained for %3 rows in %4().")
+                            .arg(TypeUtils::classPureBasename<Derived>())
+                            .arg(ids.size()).arg(chunk.size())
+                            .arg(__tiny_func__));
+                }
+
+                for (qsizetype index = 0; index < ids.size(); ++index, ++assignedIds)
+                    models.at(offset + index)->setAttribute(keyName, ids.at(index));
+            }
+
+            if (useTransaction)
+                connection.commit();
+
+        } catch (...) {
+            if (useTransaction)
+                connection.rollBack();
+
+            // The IDs of the failed batch aren't valid, the rows will be rolled back
+            for (qsizetype index = 0; index < assignedIds; ++index)
+                models.at(index)->unsetAttribute(keyName);
+
+            throw;
+        }
+
+        const auto &connectionName = connection.getName();
+
+        // The same as in the save() for every inserted model
+        for (auto *const derived : models) {
+            Model &model = *derived;
+
+            model.exists = true;
+
+            if (model.getConnectionName().isEmpty())
+                model.setConnection(connectionName);
+
+            model.finishSave(options);
+        }
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void Model<Derived, AllRelations...>::updateMany(
+            const ModelsCollection<Derived *> &models, const QList<QVariantMap> &values,
+            const SaveOptions options)
+    {
+        Q_ASSERT(!models.isEmpty() && models.size() == values.size());
+
+        const Model &firstModel = *models.constFirst();
+
+        /* Timestamps are already a part of the dirty attributes, so call the base
+           query builder directly, it also splits the values to chunks. */
+        firstModel.newModelQuery()->getQuery().updateMany(firstModel.getKeyName(),
+                                                          values);
+
+        // The base query builder bypasses the TinyBuilder, forget the updated models
+        if (Support::IdentityMap::isEnabled())
+            Support::IdentityMap::evict(firstModel.getConnection().getName(),
+                                        firstModel.getTable(), models.modelKeys());
+
+        // The same as in the save() and performUpdate() for every updated model
+        for (auto *const derived : models) {
+            Model &model = *derived;
+
+            model.syncChanges();
+
+            model.finishSave(options);
+        }
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::size_t Model<Derived, AllRelations...>::performDeleteOnModels(
+            const ModelsCollection<Derived *> &models)
+    {
+        return chunkByKeys(models, [](TinyBuilder<Derived> &query,
+                                      const ModelsCollection<Derived *> &chunk)
+        {
+            const auto [affected, _] = query.remove();
+
+            for (auto *const model : chunk)
+                model->exists = false;
+
+            return affected;
+        });
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<typename Callback>
+    std::size_t Model<Derived, AllRelations...>::chunkByKeys(
+            const ModelsCollection<Derived *> &models, Callback &&callback,
+            const qsizetype otherBindings)
+    {
+        Q_ASSERT(otherBindings >= 0 && otherBindings < MaxBindings);
+
+        // The keys and the other bindings have to fit into one statement
+        const auto maxKeys = MaxBindings - otherBindings;
+
+        // Only the existing models can be deleted or restored
+        std::map<QString, ModelsCollection<Derived *>> connectionGroups;
+
+        for (auto *const model : models)
+            if (model->exists)
+                connectionGroups[model->getConnectionName()] << model;
+
+        std::size_t affected = 0;
+
+        for (const auto &[connection, group] : connectionGroups)
+            for (qsizetype offset = 0; offset < group.size(); offset += maxKeys) {
+                const auto chunkSize = std::min(maxKeys, group.size() - offset);
+
+                ModelsCollection<Derived *> chunk;
+                chunk.reserve(chunkSize);
+
+                std::copy_n(group.cbegin() + offset, chunkSize,
+                            std::back_inserter(chunk));
+
+                // Ownership of a unique_ptr()
+                auto query = chunk.constFirst()->newModelQuery();
+                query->whereKey(chunk.modelKeys());
+
+                affected += static_cast<std::size_t>(
+                                std::invoke(callback, *query, chunk));
+            }
+
+        return affected;
+    }
+
     /* private */
 
     /* Operations on a Model instance */
@@ -2044,6 +2737,13 @@ namespace Orm::Tiny
         return model().u_touches;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const QHash<QString, QString> &
+    Model<Derived, AllRelations...>::getUserCounterCaches() const noexcept
+    {
+        return model().u_counterCaches;
+    }
+
     /* HasTimestamps */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -2163,6 +2863,8 @@ namespace Orm::Tiny
     void Model<Derived, AllRelations...>::appendToUserDates(const QString &column)
     {
         const_cast<QStringList &>(Derived::u_dates) << column;
+
+        Concerns::HasAttributes<Derived, AllRelations...>::invalidateCastPlans();
     }
 
 } // namespace Orm::Tiny
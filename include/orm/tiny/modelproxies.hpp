@@ -152,6 +152,13 @@ namespace Tiny
         static std::unique_ptr<TinyBuilder<Derived>>
         with(QList<QString> &&relations);
 
+        /*! Begin querying a model with the relation loaded using the left join. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        withJoin(const QString &relation);
+        /*! Begin querying a model with the relations loaded using the left join. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        withJoin(const QList<QString> &relations);
+
         /*! Prevent the specified relations from being eager loaded. */
         static std::unique_ptr<TinyBuilder<Derived>>
         without(const QList<QString> &relations);
@@ -865,6 +872,14 @@ namespace Tiny
         static std::unique_ptr<TinyBuilder<Derived>>
         lock(QString &&value);
 
+        /* Query result cache */
+        /*! Cache the results of the query for the given time. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        remember(std::chrono::seconds ttl, const QStringList &tags = {});
+        /*! Cache the results of the query until any of the tagged tables is written. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        rememberForever(const QStringList &tags = {});
+
         /* Builds Queries */
         /*! Chunk the results of the query. */
         static bool
@@ -1312,6 +1327,28 @@ namespace Tiny
         return builder;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::withJoin(const QString &relation)
+    {
+        auto builder = query();
+
+        builder->withJoin(relation);
+
+        return builder;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::withJoin(const QList<QString> &relations)
+    {
+        auto builder = query();
+
+        builder->withJoin(relations);
+
+        return builder;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     std::unique_ptr<TinyBuilder<Derived>>
     ModelProxies<Derived, AllRelations...>::without(const QList<QString> &relations)
@@ -3359,6 +3396,31 @@ namespace Tiny
         return builder;
     }
 
+    /* Query result cache */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::remember(
+            const std::chrono::seconds ttl, const QStringList &tags)
+    {
+        auto builder = query();
+
+        builder->remember(ttl, tags);
+
+        return builder;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::rememberForever(const QStringList &tags)
+    {
+        auto builder = query();
+
+        builder->rememberForever(tags);
+
+        return builder;
+    }
+
     /* Builds Queries */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
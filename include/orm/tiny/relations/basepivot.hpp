@@ -237,7 +237,7 @@ namespace Orm::Tiny::Relations
         /* If a primary key is defined on the current Pivot model, we can use
            Model's 'remove' method, otherwise we have to build a query with
            the help of QueryBuilder's 'where' method. */
-        if (this->m_attributesHash.contains(this->getKeyName()))
+        if (this->m_attributesHash.get().contains(this->getKeyName()))
             return Model<PivotModel>::remove();
 
         // FEATURE events silverqx
@@ -314,7 +314,7 @@ namespace Orm::Tiny::Relations
         /* If the pivot table contains a primary key then use this primary key
            in the where clause. */
         if (const auto &primaryKeyName = this->getKeyName();
-            this->m_attributesHash.contains(primaryKeyName)
+            this->m_attributesHash.get().contains(primaryKeyName)
         )
             // Also check if this primary key is valid
             if (const auto id = this->getKeyForSelectQuery();
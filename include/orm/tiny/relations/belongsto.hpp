@@ -59,6 +59,16 @@ namespace Orm::Tiny::Relations
         inline void addEagerConstraints(const ModelsCollection<Model> &models) override;
         /*! Set the constraints for an eager load of the relation. */
         inline void addEagerConstraints(const ModelsCollection<Model *> &models) override;
+        /*! Convert the limit of the eager load query to the limit per parent model. */
+        inline void addEagerGroupLimit() const override;
+        /*! Add the left join for loading the relation using the join, return
+            the related model's column used in the join condition. */
+        QString addJoinLoadConstraints(QueryBuilder &query,
+                                       const QString &alias) const override;
+        /*! Get the default related model for the relation loaded using the join
+            if the left join didn't match (std::nullopt w/o the withDefault()). */
+        inline std::optional<Related>
+        getJoinLoadDefaultFor(const Model &parent) const override;
 
         /*! Initialize the relation on a set of models. */
         inline ModelsCollection<Model> &
@@ -81,6 +91,8 @@ namespace Orm::Tiny::Relations
         /*! Get the results of the relationship. */
         std::variant<ModelsCollection<Related>, std::optional<Related>>
         getResults() const override;
+        /*! Get the relationship for eager loading. */
+        ModelsCollection<Related> getEager() const override;
 
         /* Updating relationship */
         /*! Associate the model instance to the given parent. */
@@ -92,6 +104,16 @@ namespace Orm::Tiny::Relations
         /*! Alias of "dissociate" method. */
         inline Model &disassociate() const;
 
+        /* Timestamps */
+        /*! Touch the owner model of the relationship. */
+        void touch() const override;
+
+        /* Counter cache */
+        /*! Increment or decrement the counter cache column of the owner model with
+            the given key (the owner's updated_at column isn't touched). */
+        void updateCounterCache(const QString &column, qint64 amount,
+                                const QVariant &ownerKey) const;
+
         /* Getters / Setters */
         /*! Get the child of the relationship. */
         inline const Model &getChild() const noexcept;
@@ -131,6 +153,11 @@ namespace Orm::Tiny::Relations
         template<ModelConcept M>
         inline QVariant getRelatedKeyFrom(const M &model) const;
 
+        /* Identity map */
+        /*! Determine whether the owners can be obtained from the identity map (owned
+            by the primary key and the relation constraint is the only where clause). */
+        inline bool canUseIdentityMap() const;
+
         /* Querying Relationship Existence/Absence */
         /*! Add the constraints for a relationship query. */
         std::unique_ptr<Builder<Related>>
@@ -237,6 +264,31 @@ namespace Orm::Tiny::Relations
         addEagerConstraintsInternal(models);
     }
 
+    template<class Model, class Related>
+    void BelongsTo<Model, Related>::addEagerGroupLimit() const
+    {
+        /* Nothing to do, every child model has only one parent model so the limit
+           can only be applied to the whole eager load query. */
+    }
+
+    template<class Model, class Related>
+    QString
+    BelongsTo<Model, Related>::addJoinLoadConstraints(QueryBuilder &query,
+                                                      const QString &alias) const
+    {
+        this->addJoinLoadJoin(query, alias, m_ownerKey,
+                              m_child->qualifyColumn(m_foreignKey));
+
+        return m_ownerKey;
+    }
+
+    template<class Model, class Related>
+    std::optional<Related>
+    BelongsTo<Model, Related>::getJoinLoadDefaultFor(const Model &parent) const
+    {
+        return this->getDefaultFor(parent);
+    }
+
     template<class Model, class Related>
     ModelsCollection<Model> &
     BelongsTo<Model, Related>::initRelation(ModelsCollection<Model> &models,
@@ -278,8 +330,8 @@ namespace Orm::Tiny::Relations
 
         /*! Build model dictionary keyed by the parent's primary key. */
         for (auto &&result : results)
-            dictionary.emplace(result.getAttribute(m_ownerKey)
-                               .template value<typename Model::KeyType>(),
+            dictionary.emplace(Relation<Model, Related>::getDictionaryKey(result,
+                                                                          m_ownerKey),
                                std::move(result));
 
         return dictionary;
@@ -289,18 +341,37 @@ namespace Orm::Tiny::Relations
     std::variant<ModelsCollection<Related>, std::optional<Related>>
     BelongsTo<Model, Related>::getResults() const
     {
+        const auto foreignKey = m_child->getAttribute(m_foreignKey);
+
         // Model doesn't contain foreign key ( eg empty Model instance )
-        if (const auto foreignKey = m_child->getAttribute(m_foreignKey);
-            !foreignKey.isValid() || foreignKey.isNull()
-        )
+        if (!foreignKey.isValid() || foreignKey.isNull())
             return this->getDefaultFor(*m_child);
 
+        // The owner could be already loaded in the identity map scope
+        if (canUseIdentityMap()) {
+            auto owner = this->m_related->newQuery()->find(foreignKey);
+
+            return owner ? std::move(owner) : this->getDefaultFor(*m_child);
+        }
+
         // NRVO doesn't kick in so I have to move
         auto first = this->m_query->first();
 
         return first ? std::move(first) : this->getDefaultFor(*m_child);
     }
 
+    template<class Model, class Related>
+    ModelsCollection<Related> BelongsTo<Model, Related>::getEager() const
+    {
+        /* The eager constraint is the only where clause, query only the owners that
+           weren't loaded in the identity map scope yet. */
+        if (canUseIdentityMap())
+            return this->m_related->newQuery()->findMany(
+                        this->getBaseQuery().getWheres().constFirst().values);
+
+        return Relation<Model, Related>::getEager();
+    }
+
     /* Updating relationship */
 
     template<class Model, class Related>
@@ -343,6 +414,57 @@ namespace Orm::Tiny::Relations
         return dissociate();
     }
 
+    /* Timestamps */
+
+    template<class Model, class Related>
+    void BelongsTo<Model, Related>::touch() const
+    {
+        if (Related::isIgnoringTouch())
+            return;
+
+        // The owner is touched at the end of the DB::withDeferredTouches()
+        if (this->deferTouch(m_ownerKey, {getParentKey()}))
+            return;
+
+        Relation<Model, Related>::touch();
+    }
+
+    /* Counter cache */
+
+    template<class Model, class Related>
+    void BelongsTo<Model, Related>::updateCounterCache(
+            const QString &column, const qint64 amount, const QVariant &ownerKey) const
+    {
+        // Nothing to do, the child model isn't associated with any owner
+        if (amount == 0 || !ownerKey.isValid() || ownerKey.isNull())
+            return;
+
+        /* Ownership of a unique_ptr(), w/o the global scopes so the counter of
+           the soft deleted owner is also kept in sync. */
+        auto query = this->m_related->newModelQuery();
+        auto &baseQuery = query->getQuery();
+
+        baseQuery.where(m_ownerKey, EQ, ownerKey);
+
+        if (amount > 0)
+            baseQuery.increment(column, amount);
+        else
+            baseQuery.decrement(column, -amount);
+
+        // Nothing is remembered outside of the identity map scope
+        if (!Support::IdentityMap::isEnabled())
+            return;
+
+        // The remembered owner has the stale counter
+        const auto &connection = baseQuery.getConnection().getName();
+        const auto &table = this->m_related->getTable();
+
+        if (m_ownerKey == this->m_related->getKeyName())
+            Support::IdentityMap::evict(connection, table, {ownerKey});
+        else
+            Support::IdentityMap::evictTable(connection, table);
+    }
+
     /* Getters / Setters */
 
     template<class Model, class Related>
@@ -448,6 +570,15 @@ namespace Orm::Tiny::Relations
         return model.getAttribute(m_ownerKey);
     }
 
+    /* Identity map */
+
+    template<class Model, class Related>
+    bool BelongsTo<Model, Related>::canUseIdentityMap() const
+    {
+        return m_ownerKey == this->m_related->getKeyName() &&
+               this->m_query->canUseIdentityMap({ASTERISK}, 1);
+    }
+
     /* Querying Relationship Existence/Absence */
 
     template<class Model, class Related>
@@ -522,16 +653,19 @@ namespace Orm::Tiny::Relations
         for (ModelLoopType model : models) {
             auto *const modelPointer = Relation<Model,Related>::toPointer(model);
 
-            if (const auto foreignKey = modelPointer->getAttribute(m_foreignKey)
-                                        .template value<typename Model::KeyType>();
-                dictionary.contains(foreignKey)
+            if (const auto related = dictionary.constFind(
+                                         Relation<Model, Related>::getDictionaryKey(
+                                             *modelPointer, m_foreignKey));
+                related != dictionary.cend()
             )
                 modelPointer->setRelation(
                             relation,
                             std::make_optional<Related>(
                                 /* Don't move here! as one Related model can be set
-                                   on more parent models. */
-                                dictionary.find(foreignKey).value()));
+                                   on more parent models. The copy is cheap, all
+                                   copies share the attributes (also the attributes
+                                   hash) until one of them is modified. */
+                                related.value()));
         }
     }
 
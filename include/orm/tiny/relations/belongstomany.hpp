@@ -515,9 +515,9 @@ namespace Orm::Tiny::Relations
         for (auto &&result : results) {
 
             const auto foreignPivotKey =
-                    result.template getRelation<PivotType, Orm::One>(m_accessor)
-                    ->getAttribute(m_foreignPivotKey)
-                    .template value<typename Model::KeyType>();
+                    Relation<Model, Related>::getDictionaryKey(
+                        *result.template getRelation<PivotType, Orm::One>(m_accessor),
+                        m_foreignPivotKey);
 
             dictionary[foreignPivotKey] << std::move(result);
         }
@@ -736,6 +736,10 @@ namespace Orm::Tiny::Relations
         if (ids.isEmpty())
             return;
 
+        // The related models are touched at the end of the DB::withDeferredTouches()
+        if (this->deferTouch(key, ids))
+            return;
+
         /* If we actually have IDs for the relation, we will run the query to update all
            the related model's timestamps, to make sure these all reflect the changes
            to the parent models. This will help us keep any caching synced up here. */
@@ -1592,14 +1596,15 @@ namespace Orm::Tiny::Relations
         for (ModelLoopType model : models) {
             auto *const modelPointer = Relation<Model,Related>::toPointer(model);
 
-            if (const auto parentKey = modelPointer->getAttribute(m_parentKey)
-                .template value<typename Model::KeyType>();
-                dictionary.contains(parentKey)
+            if (const auto related = dictionary.find(
+                                         Relation<Model, Related>::getDictionaryKey(
+                                             *modelPointer, m_parentKey));
+                related != dictionary.end()
             )
                 modelPointer->template setRelation<Related>(
                             /* Is safe to move as the hash is keyed by IDs so every ID
                                has its own related models prepared. */
-                            relation, std::move(dictionary.find(parentKey).value()));
+                            relation, std::move(related.value()));
         }
     }
 
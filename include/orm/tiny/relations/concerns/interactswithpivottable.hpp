@@ -8,9 +8,11 @@ TINY_SYSTEM_HEADER
 #include "orm/macros/sqldrivermappings.hpp"
 #include TINY_INCLUDE_TSqlRecord
 
+#include <range/v3/view/map.hpp>
 #include <range/v3/view/set_algorithm.hpp>
 
 #include "orm/exceptions/domainerror.hpp"
+#include "orm/macros/likely.hpp"
 #include "orm/ormconcepts.hpp"
 #include "orm/tiny/types/syncchanges.hpp"
 #include "orm/tiny/utils/attribute.hpp"
@@ -187,6 +189,9 @@ namespace Concerns
         formatAttachRecords(
                 const std::map<RelatedKeyType,
                                QList<AttributeItem>> &idsWithAttributes) const;
+        /*! Insert the attach records into the pivot table (multi-row insert for every
+            chunk of records, all the records must have the same columns). */
+        void insertAttachRecords(const QList<QVariantMap> &records) const;
 
         /*! Create a new pivot attachment record. */
         QList<AttributeItem>
@@ -212,11 +217,12 @@ namespace Concerns
                 const QVariant &id, const QList<AttributeItem> &attributes,
                 bool touch = true) const;
 
-        /*! Attach all of the records that aren't in the given current records. */
+        /*! Attach all of the records that aren't in the given current pivots and
+            update the changed ones (batched, doesn't touch). */
         SyncChanges
         attachNew(const std::map<RelatedKeyType,
                                  QList<AttributeItem>> &records,
-                  const QList<QVariant> &current, bool touch = true) const;
+                  QList<PivotType> &currentPivots) const;
 
         /*! Convert IDs vector to the map with attributes keyed by IDs. */
         std::map<RelatedKeyType, QList<AttributeItem>>
@@ -382,9 +388,8 @@ namespace Concerns
             /* Here we will insert the attachment records into the pivot table. Once
                we have inserted the records, we will touch the relationships if
                necessary and the function will return. */
-            newPivotStatement()->insert(
-                    AttributeUtils::convertVectorsToMaps(
-                        formatAttachRecords(ids, attributes)));
+            insertAttachRecords(AttributeUtils::convertVectorsToMaps(
+                                    formatAttachRecords(ids, attributes)));
         else
             attachUsingCustomClass(ids, attributes);
 
@@ -427,9 +432,8 @@ namespace Concerns
             /* Here we will insert the attachment records into the pivot table. Once
                we have inserted the records, we will touch the relationships if
                necessary and the function will return. */
-            newPivotStatement()->insert(
-                    AttributeUtils::convertVectorsToMaps(
-                        formatAttachRecords(idsWithAttributes)));
+            insertAttachRecords(AttributeUtils::convertVectorsToMaps(
+                                    formatAttachRecords(idsWithAttributes)));
         else
             attachUsingCustomClass(idsWithAttributes);
 
@@ -454,7 +458,8 @@ namespace Concerns
         /* First we need to attach any of the associated models that are not currently
            in this joining table. We'll spin through the given IDs, checking to see
            if they exist in the vector of current ones, and if not we will insert. */
-        auto current = getRelatedIds(getCurrentlyAttachedPivots());
+        auto currentPivots = getCurrentlyAttachedPivots();
+        auto current = getRelatedIds(currentPivots);
 
         // Compute different keys, these keys will be detached
         auto ids = idsFromRecords(idsWithAttributes);
@@ -467,9 +472,10 @@ namespace Concerns
 
         /* Next, we will take the differences of the currents and given IDs and detach
            all of the entities that exist in the "current" vector but are not in the
-           vector of the new IDs given to the method which will complete the sync. */
+           vector of the new IDs given to the method which will complete the sync.
+           All of them are detached using one query, the touch is done at the end. */
         if (detaching && !detach.isEmpty()) {
-            this->detach(detach);
+            this->detach(detach, false);
 
             changes.at(Detached) = std::move(detach);
         }
@@ -478,12 +484,14 @@ namespace Concerns
            touching until after the entire operation is complete so we don't fire a
            ton of touch operations until we are totally done syncing the records. */
         changes.template merge<RelatedKeyType>(
-                    attachNew(idsWithAttributes, current, false));
+                    attachNew(idsWithAttributes, currentPivots));
 
         /* Once we have finished attaching or detaching the records, we will see if we
            have done any attaching or detaching, and if we have we will touch these
            relationships if they are configured to touch on any database updates. */
-        if (!changes.at(Attached).isEmpty() || !changes.at(Updated_).isEmpty())
+        if (!changes.at(Attached).isEmpty() || !changes.at(Detached).isEmpty() ||
+            !changes.at(Updated_).isEmpty()
+        )
             touchIfTouching_();
 
         return changes;
@@ -765,6 +773,49 @@ namespace Concerns
         return records;
     }
 
+    template<class Model, class Related, class PivotType>
+    void InteractsWithPivotTable<Model, Related, PivotType>::insertAttachRecords(
+            const QList<QVariantMap> &records) const
+    {
+        // Nothing to do
+        if (records.isEmpty())
+            return;
+
+        /* Keep the number of bindings under the limit of all supported databases,
+           every row has the binding for every column. */
+        const auto chunkSize = std::max<qsizetype>(
+                                   1, QueryBuilder::MaxBindings /
+                                      records.constFirst().size());
+
+        // All records fit into one statement
+        if (records.size() <= chunkSize) T_LIKELY {
+            newPivotStatement()->insert(records);
+            return;
+        }
+
+        auto &connection = getBaseQuery_().getConnection();
+
+        // All chunks are inserted or none of them, don't begin the nested transaction
+        const auto inTransaction = connection.inTransaction();
+
+        if (!inTransaction)
+            connection.beginTransaction();
+
+        try {
+            for (qsizetype offset = 0; offset < records.size(); offset += chunkSize)
+                newPivotStatement()->insert(records.mid(offset, chunkSize));
+
+            if (!inTransaction)
+                connection.commit();
+
+        } catch (...) {
+            if (!inTransaction)
+                connection.rollBack();
+
+            throw;
+        }
+    }
+
     template<class Model, class Related, class PivotType>
     QList<AttributeItem>
     InteractsWithPivotTable<Model, Related, PivotType>::baseAttachRecord(
@@ -907,31 +958,77 @@ namespace Concerns
     SyncChanges
     InteractsWithPivotTable<Model, Related, PivotType>::attachNew(
             const std::map<RelatedKeyType, QList<AttributeItem>> &records,
-            const QList<QVariant> &current, const bool touch) const
+            QList<PivotType> &currentPivots) const
     {
         SyncChanges changes;
 
+        // Currently attached pivots keyed by the related ID
+        std::map<RelatedKeyType, PivotType *> current;
+        for (auto &pivot : currentPivots)
+            current.emplace(castKey<RelatedKeyType>(
+                                pivot.getAttribute(getRelatedPivotKeyName_())),
+                            &pivot);
+
+        /* New records grouped by the attribute names because the multi-row insert
+           needs the same columns for all rows, usually there is only one group. */
+        std::map<std::set<QString>,
+                 std::map<RelatedKeyType, QList<AttributeItem>>> attachGroups;
+        // Changed pivot rows grouped by the changed columns (for the updateMany())
+        std::map<QStringList, QList<QVariantMap>> updateGroups;
+
         for (const auto &[id, attributes] : records) {
+            const auto itPivot = current.find(id);
+
             /* If the ID is not in the list of existing pivot IDs, we will insert
                a new pivot record, otherwise, we will just update this existing record
                on this joining table, so that the developers will easily update these
                records pain free. */
-            if (!current.contains(id)) {
-                attach(id, attributes, touch);
+            if (itPivot == current.end()) {
+                attachGroups[AttributeUtils::keys(attributes)].emplace(id, attributes);
 
                 changes.at(Attached) << id;
+                continue;
             }
 
             /* If the pivot record already exists, we'll try to update the attributes
-               that were given to the method. If the model is actually updated, we will
+               that were given to the method. If the pivot is actually changed, we will
                add it to the list of updated pivot records, so we return them back
                out to the consumer. */
-            else if (!attributes.isEmpty() &&
-                     updateExistingPivot(id, attributes, touch)
-            )
-                changes.at(Updated_) << id;
+            if (attributes.isEmpty())
+                continue;
+
+            auto &pivot = *itPivot->second;
+
+            if (!pivot.fill(attributes).isDirty())
+                continue;
+
+            // Custom pivots are saved one by one (casts, timestamps, and events)
+            if constexpr (CustomPivot<PivotType>)
+                pivot.save();
+
+            else {
+                auto dirty = pivot.getDirty();
+
+                if (hasPivotColumn(updatedAt_()))
+                    addTimestampsToAttachment(dirty, true);
+
+                auto row = AttributeUtils::convertVectorToMap(dirty);
+                row.insert(getRelatedPivotKeyName_(), id);
+
+                updateGroups[row.keys()] << std::move(row);
+            }
+
+            changes.at(Updated_) << id;
         }
 
+        // One multi-row insert for all new records
+        for (const auto &group : attachGroups | ranges::views::values)
+            attach(group, false);
+
+        // One update for all changed pivot records (different values for every row)
+        for (const auto &rows : updateGroups | ranges::views::values)
+            newPivotQuery()->updateMany(getRelatedPivotKeyName_(), rows);
+
         return changes;
     }
 
@@ -67,6 +67,17 @@ namespace Orm::Tiny::Relations
         std::variant<ModelsCollection<Related>, std::optional<Related>>
         getResults() const override;
 
+        /*! Add the left join for loading the relation using the join, return
+            the related model's column used in the join condition. */
+        QString addJoinLoadConstraints(QueryBuilder &query,
+                                       const QString &alias) const override;
+        /*! Get the default related model for the relation loaded using the join
+            if the left join didn't match (std::nullopt w/o the withDefault()). */
+        inline std::optional<Related>
+        getJoinLoadDefaultFor(const Model &parent) const override;
+        /*! Determine whether more related rows can be joined to one parent row. */
+        inline bool joinLoadMatchesMany() const noexcept override;
+
         /* Others */
         /*! The textual representation of the Relation type. */
         inline const QString &relationTypeName() const override;
@@ -170,6 +181,33 @@ namespace Orm::Tiny::Relations
         return first ? std::move(first) : this->getDefaultFor(*this->m_parent);
     }
 
+    template<class Model, class Related>
+    QString
+    HasOne<Model, Related>::addJoinLoadConstraints(QueryBuilder &query,
+                                                   const QString &alias) const
+    {
+        auto foreignKey = this->getForeignKeyName();
+
+        this->addJoinLoadJoin(query, alias, foreignKey,
+                              this->getQualifiedParentKeyName());
+
+        return foreignKey;
+    }
+
+    template<class Model, class Related>
+    std::optional<Related>
+    HasOne<Model, Related>::getJoinLoadDefaultFor(const Model &parent) const
+    {
+        return this->getDefaultFor(parent);
+    }
+
+    template<class Model, class Related>
+    bool HasOne<Model, Related>::joinLoadMatchesMany() const noexcept
+    {
+        // The foreign key doesn't have to be unique
+        return true;
+    }
+
     /* Others */
 
     template<class Model, class Related>
@@ -295,7 +295,10 @@ namespace Orm::Tiny::Relations
     HasOneOrMany<Model, Related>::saveMany(ModelsCollection<Related> &models) const
     {
         for (auto &model : models)
-            save(model);
+            setForeignAttributesForCreate(model);
+
+        // New models are inserted using the multi-rows insert
+        Related::saveMany(models.toPointers());
 
         return models;
     }
@@ -304,8 +307,7 @@ namespace Orm::Tiny::Relations
     ModelsCollection<Related>
     HasOneOrMany<Model, Related>::saveMany(ModelsCollection<Related> &&models) const
     {
-        for (auto &model : models)
-            save(model);
+        saveMany(models);
 
         return std::move(models);
     }
@@ -344,8 +346,14 @@ namespace Orm::Tiny::Relations
         ModelsCollection<Related> instances;
         instances.reserve(records.size());
 
-        for (const auto &record : records)
-            instances << create(record);
+        for (const auto &record : records) {
+            instances << this->m_related->newInstance(record);
+
+            setForeignAttributesForCreate(instances.last());
+        }
+
+        // All the new models are inserted using the multi-rows insert
+        Related::saveMany(instances.toPointers());
 
         return instances;
     }
@@ -358,8 +366,14 @@ namespace Orm::Tiny::Relations
         ModelsCollection<Related> instances;
         instances.reserve(records.size());
 
-        for (auto &&record : records)
-            instances << create(std::move(record));
+        for (auto &&record : records) {
+            instances << this->m_related->newInstance(std::move(record));
+
+            setForeignAttributesForCreate(instances.last());
+        }
+
+        // All the new models are inserted using the multi-rows insert
+        Related::saveMany(instances.toPointers());
 
         return instances;
     }
@@ -385,17 +399,17 @@ namespace Orm::Tiny::Relations
         for (ModelLoopType model : models) {
             auto *const modelPointer = Relation<Model,Related>::toPointer(model);
 
-            if (const auto parentKey = modelPointer->getAttribute(m_localKey)
-                                       .template value<typename Model::KeyType>();
-                dictionary.contains(parentKey)
+            if (const auto related = dictionary.find(
+                                         Relation<Model, Related>::getDictionaryKey(
+                                             *modelPointer, m_localKey));
+                related != dictionary.end()
             )
                 /* HasMany - is safe to move as the hash is keyed by IDs so every ID
                              has its own related models prepared.
                    HasOne  - is also safe to move as the hash is keyed by IDs so every ID
                              has its own related model prepared and this related model
                              will not be assigned to any other parent model. */
-                modelPointer->setRelation(relation,
-                                          std::move(dictionary.find(parentKey).value()));
+                modelPointer->setRelation(relation, std::move(related.value()));
         }
     }
 
@@ -408,10 +422,13 @@ namespace Orm::Tiny::Relations
         QHash<typename Model::KeyType, RelationType> dictionary;
         dictionary.reserve(results.size());
 
+        // Don't split the qualified foreign key for every related model
+        const auto foreignKeyName = getForeignKeyName();
+
         for (auto &&result : results)
             if constexpr (
-                const auto foreignKey = result.getAttribute(getForeignKeyName())
-                                        .template value<typename Model::KeyType>();
+                const auto foreignKey = Relation<Model, Related>::getDictionaryKey(
+                                            result, foreignKeyName);
                 std::is_same_v<RelationType, ModelsCollection<Related>>
             )
                 dictionary[foreignKey] << std::move(result);
@@ -8,8 +8,12 @@ TINY_SYSTEM_HEADER
 #include <range/v3/action/sort.hpp>
 #include <range/v3/action/unique.hpp>
 
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/runtimeerror.hpp"
+#include "orm/macros/likely.hpp"
 #include "orm/macros/threadlocal.hpp"
+#include "orm/query/joinclause.hpp"
+#include "orm/support/deferredtouches.hpp"
 #include "orm/tiny/relations/relationproxies.hpp"
 #include "orm/tiny/relations/relationtypes.hpp"
 #include "orm/utils/notnull.hpp"
@@ -80,6 +84,18 @@ namespace Relations
         virtual void addEagerConstraints(const ModelsCollection<Model> &models) = 0;
         /*! Set the constraints for an eager load of the relation. */
         virtual void addEagerConstraints(const ModelsCollection<Model *> &models) = 0;
+        /*! Convert the limit of the eager load query to the limit per parent model. */
+        virtual void addEagerGroupLimit() const;
+        /*! Add the left join for loading the relation using the join, return
+            the related model's column used in the join condition. */
+        virtual QString
+        addJoinLoadConstraints(QueryBuilder &query, const QString &alias) const;
+        /*! Get the default related model for the relation loaded using the join
+            if the left join didn't match (std::nullopt w/o the withDefault()). */
+        inline virtual std::optional<Related>
+        getJoinLoadDefaultFor(const Model &parent) const;
+        /*! Determine whether more related rows can be joined to one parent row. */
+        inline virtual bool joinLoadMatchesMany() const noexcept;
 
         /*! Initialize the relation on a set of models. */
         virtual ModelsCollection<Model> &
@@ -104,7 +120,7 @@ namespace Relations
         getResults() const = 0;
 
         /*! Get the relationship for eager loading. */
-        inline ModelsCollection<Related> getEager() const;
+        inline virtual ModelsCollection<Related> getEager() const;
         /*! Execute the query as a "select" statement. */
         inline virtual ModelsCollection<Related>
         get(const QList<Column> &columns = {ASTERISK}) const; // NOLINT(google-default-arguments)
@@ -160,6 +176,11 @@ namespace Relations
         getKeys(const ModelsCollection<CollectionModel> &models,
                 const QString &key = "") const;
 
+        /*! Get the model's raw attribute converted to the dictionary key type. */
+        template<typename KeyModel>
+        static typename Model::KeyType
+        getDictionaryKey(const KeyModel &model, const QString &key);
+
         /*! Convert the Model pointer to the pointer (no-op). */
         constexpr static Model *toPointer(Model *model);
         /*! Convert the Model pointer to the pointer (no-op). */
@@ -169,6 +190,18 @@ namespace Relations
         /*! Convert the const Model reference to the pointer. */
         inline static const Model *toPointer(const Model &model) noexcept;
 
+        /* Timestamps */
+        /*! Record the touch of the related models if the touches are deferred
+            (DB::withDeferredTouches()), return false if they aren't deferred. */
+        bool deferTouch(const QString &keyName, const QList<QVariant> &ids) const;
+
+        /* Join loading */
+        /*! Add the left join of the aliased related table for loading the relation
+            using the join, the trashed related models are excluded. */
+        void addJoinLoadJoin(QueryBuilder &query, const QString &alias,
+                             const QString &relatedColumn,
+                             const QString &parentColumn) const;
+
         /* Querying Relationship Existence/Absence */
         /*! Add the constraints for an internal relationship existence query.
             Essentially, these queries compare on column names like whereColumn. */
@@ -238,6 +271,43 @@ namespace Relations
         return relation;
     }
 
+    template<class Model, class Related>
+    void Relation<Model, Related>::addEagerGroupLimit() const
+    {
+        auto &query = getBaseQuery();
+
+        /* The limit would be applied to the whole eager load query so it would load
+           the given number of related models for all parent models together, it has
+           to be converted to the limit per parent model (window function). */
+        if (const auto limit = query.getLimit(); limit > -1)
+            query.groupLimit(limit, getExistenceCompareKey());
+    }
+
+    template<class Model, class Related>
+    QString
+    Relation<Model, Related>::addJoinLoadConstraints(
+            QueryBuilder &/*unused*/, const QString &/*unused*/) const
+    {
+        throw Orm::Exceptions::RuntimeError(
+                    QStringLiteral("The join loading is not supported for '%1' "
+                                   "relation type, only belongs-to and has-one "
+                                   "relations can be loaded using the join in %2().")
+                    .arg(relationTypeName(), __tiny_func__));
+    }
+
+    template<class Model, class Related>
+    std::optional<Related>
+    Relation<Model, Related>::getJoinLoadDefaultFor(const Model &/*unused*/) const
+    {
+        return std::nullopt;
+    }
+
+    template<class Model, class Related>
+    bool Relation<Model, Related>::joinLoadMatchesMany() const noexcept
+    {
+        return false;
+    }
+
     template<class Model, class Related>
     ModelsCollection<Related>
     Relation<Model, Related>::getEager() const
@@ -397,6 +467,20 @@ namespace Relations
                 | ranges::actions::unique;
     }
 
+    template<class Model, class Related>
+    template<typename KeyModel>
+    typename Model::KeyType
+    Relation<Model, Related>::getDictionaryKey(const KeyModel &model,
+                                               const QString &key)
+    {
+        /* The getAttribute() isn't used because keys don't need to be transformed
+           (casted or converted to dates), the value<KeyType>() does the conversion
+           anyway, this avoids the casts lookups for every model during eager loading.
+           The invalid QVariant is converted to the default KeyType if not found. */
+        return model.getAttributeFromArray(key)
+                .template value<typename Model::KeyType>();
+    }
+
     template<class Model, class Related>
     constexpr Model *
     Relation<Model, Related>::toPointer(Model *const model)
@@ -431,8 +515,57 @@ namespace Relations
         return &model;
     }
 
+    /* Timestamps */
+
+    template<class Model, class Related>
+    bool Relation<Model, Related>::deferTouch(const QString &keyName,
+                                              const QList<QVariant> &ids) const
+    {
+        if (!Orm::Support::DeferredTouches::isDeferring()) T_LIKELY
+            return false;
+
+        const auto &related = getRelated();
+
+        Orm::Support::DeferredTouches::defer(
+                    related.getConnectionName(), related.getTable(), keyName,
+                    Related::getUpdatedAtColumn(), ids,
+                    related.freshTimestampString());
+
+        return true;
+    }
+
     /* Querying Relationship Existence/Absence */
 
+    /* Join loading */
+
+    template<class Model, class Related>
+    void Relation<Model, Related>::addJoinLoadJoin(
+            QueryBuilder &query, const QString &alias, const QString &relatedColumn,
+            const QString &parentColumn) const
+    {
+        /* The where clauses of the relation method are written for the related table,
+           they can't be applied to the aliased table of the left join. */
+        if (!getBaseQuery().getWheres().isEmpty()) T_UNLIKELY
+            throw Orm::Exceptions::LogicError(
+                    QStringLiteral("The '%1' relation defines the where constraints, "
+                                   "the relation with constraints can't be loaded "
+                                   "using the join, use the with() instead in %2().")
+                    .arg(relationTypeName(), __tiny_func__));
+
+        /* The related table is aliased so the same table can be joined more times,
+           eg. self-referencing relations or two relations to the same table. */
+        query.leftJoin(QStringLiteral("%1 as %2").arg(m_related->getTable(), alias),
+                       [&alias, &relatedColumn, &parentColumn]
+                       (Orm::Query::JoinClause &join)
+        {
+            join.on(DOT_IN.arg(alias, relatedColumn), EQ, parentColumn);
+
+            // The same as the SoftDeletes constraint of the eager loading query
+            if constexpr (Related::extendsSoftDeletes())
+                join.whereNull(DOT_IN.arg(alias, Related::getDeletedAtColumn()));
+        });
+    }
+
     template<class Model, class Related>
     std::unique_ptr<Builder<Related>>
     Relation<Model, Related>::getRelationExistenceQuery( // NOLINT(google-default-arguments)
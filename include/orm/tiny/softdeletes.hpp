@@ -5,10 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <algorithm>
+
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/transform.hpp>
 
-#include "orm/ormtypes.hpp"
+#include "orm/tiny/tinytypes.hpp"
 #include "orm/utils/helpers.hpp"
 #include "orm/utils/nullvariant.hpp"
 
@@ -53,6 +55,13 @@ namespace Orm::Tiny
         /*! Restore a soft-deleted model instance. */
         bool restore();
 
+        /*! Force a hard delete on all the given soft deletable models (one delete
+            statement for every chunk of the keys). */
+        static std::size_t forceDeleteMany(const ModelsCollection<Derived *> &models);
+        /*! Restore all the given soft-deleted models (one update statement for all
+            models with the same dirty attributes). */
+        static bool restoreMany(const ModelsCollection<Derived *> &models);
+
         /*! Determine if the model instance has been soft-deleted. */
         bool trashed() const;
 
@@ -72,6 +81,8 @@ namespace Orm::Tiny
         void performDeleteOnModel();
         /*! Perform the actual delete query on this model instance. */
         void runSoftDelete();
+        /*! Perform the actual soft delete query on all the given models. */
+        static std::size_t runSoftDeleteMany(const ModelsCollection<Derived *> &models);
 
         /*! Indicates if the model is currently force deleting. */
         bool m_forceDeleting = false;
@@ -134,6 +145,51 @@ namespace Orm::Tiny
         return model.save();
     }
 
+    template<typename Derived>
+    std::size_t
+    SoftDeletes<Derived>::forceDeleteMany(const ModelsCollection<Derived *> &models)
+    {
+        // The same as in the Model::removeMany(), touch the owning models
+        for (const auto *const model : models)
+            if (model->exists)
+                model->touchOwners();
+
+        // The counters of the owners are updated once for all the deleted models
+        return Derived::runManyWithCounterCaches(models, [&models]
+        {
+            return Derived::chunkByKeys(models, [](auto &query, const auto &chunk)
+            {
+                const auto [affected, _] = query.forceDelete();
+
+                for (auto *const model : chunk)
+                    model->exists = false;
+
+                return affected;
+            });
+        });
+    }
+
+    template<typename Derived>
+    bool SoftDeletes<Derived>::restoreMany(const ModelsCollection<Derived *> &models)
+    {
+        ModelsCollection<Derived *> existingModels;
+        existingModels.reserve(models.size());
+
+        // Clear the deleted timestamp, the same as in the restore()
+        for (auto *const model : models) {
+            if (!model->exists)
+                continue;
+
+            model->setAttribute(getDeletedAtColumn(), NullVariant::QDateTime());
+
+            existingModels << model;
+        }
+
+        // Models with the same dirty attributes are updated at once
+        return Derived::saveMany(existingModels) &&
+               existingModels.size() == models.size();
+    }
+
     template<typename Derived>
     bool SoftDeletes<Derived>::trashed() const
     {
@@ -222,6 +278,60 @@ namespace Orm::Tiny
         model.syncOriginalAttributes(columnNames);
     }
 
+    template<typename Derived>
+    std::size_t
+    SoftDeletes<Derived>::runSoftDeleteMany(const ModelsCollection<Derived *> &models)
+    {
+        // Nothing to do
+        if (models.isEmpty())
+            return 0;
+
+        const auto &firstModel = *models.constFirst();
+
+        // The same as in the runSoftDelete() but one timestamp for all models
+        const auto timestamp = firstModel.freshTimestamp();
+        auto timestampString = firstModel.fromDateTime(timestamp);
+
+        QList<UpdateItem> columns;
+        columns.reserve(2);
+
+        columns.append({getDeletedAtColumn(), timestampString});
+
+        // Update also the updated_at column
+        const auto &updatedAtColumn = Derived::getUpdatedAtColumn();
+        const auto updateUpdatedAt = firstModel.usesTimestamps() &&
+                                     !updatedAtColumn.isEmpty();
+
+        if (updateUpdatedAt)
+            columns.append({updatedAtColumn, std::move(timestampString)});
+
+        const auto columnNames = columns
+                | ranges::views::transform([](const auto &updateItem)
+        {
+            return updateItem.column;
+        })
+                | ranges::to<QStringList>();
+
+        return Derived::chunkByKeys(models, [&](auto &query, const auto &chunk)
+        {
+            const auto [affected, _] = query.update(columns);
+
+            for (auto *const model : chunk) {
+                model->setAttribute(getDeletedAtColumn(), timestamp);
+
+                if (updateUpdatedAt)
+                    model->setUpdatedAt(timestamp);
+
+                // Sync original attributes with their current values
+                model->syncOriginalAttributes(columnNames);
+            }
+
+            return affected;
+        },
+            // The SET values are bound before the keys
+            columns.size());
+    }
+
     /* private */
 
     template<typename Derived>
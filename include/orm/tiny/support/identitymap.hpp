@@ -0,0 +1,135 @@
+#pragma once
+#ifndef ORM_TINY_SUPPORT_IDENTITYMAP_HPP
+#define ORM_TINY_SUPPORT_IDENTITYMAP_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <typeindex>
+
+#include "orm/macros/export.hpp"
+#include "orm/tiny/tinyconcepts.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Support
+{
+
+    /*! Library class for the per-thread identity map, the models loaded by the primary
+        key inside the withIdentityMap() scope are remembered by the connection, table,
+        and primary key, and the next find(), findMany(), or eager load of the same
+        models returns their copies w/o querying the database. */
+    class TINYORM_EXPORT IdentityMap
+    {
+        Q_DISABLE_COPY_MOVE(IdentityMap)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        IdentityMap() = delete;
+        /*! Deleted destructor. */
+        ~IdentityMap() = delete;
+
+        /*! Call the given callback with the identity map enabled, all the remembered
+            models are forgotten at the end of the outermost scope. */
+        static void withIdentityMap(const std::function<void()> &callback);
+
+        /*! Determine whether the identity map is enabled in the current thread. */
+        static bool isEnabled() noexcept;
+
+        /*! Forget all the remembered models. */
+        static void clear() noexcept;
+        /*! Forget the remembered models with the given primary keys. */
+        static void evict(const QString &connection, const QString &table,
+                          const QList<QVariant> &ids);
+        /*! Forget all the remembered models of the given table. */
+        static void evictTable(const QString &connection, const QString &table);
+
+        /*! Get the number of the remembered models. */
+        static std::size_t size() noexcept;
+
+        /*! Get a copy of the remembered model (std::nullopt if not remembered). */
+        template<ModelConcept Model>
+        static std::optional<Model>
+        get(const QString &connection, const QString &table, const QVariant &id);
+        /*! Remember a copy of the given model (nothing if the map is disabled). */
+        template<ModelConcept Model>
+        static void
+        put(const QString &connection, const QString &table, const Model &model);
+
+    private:
+        /*! Remembered model. */
+        struct Entry
+        {
+            /*! Model type (the same table can be used by more model types). */
+            std::type_index type;
+            /*! Copy of the model. */
+            std::shared_ptr<const void> model;
+        };
+
+        /*! Remembered model key (connection, table, and primary key as QString). */
+        using KeyType = std::tuple<QString, QString, QString>;
+        /*! Remembered models type (ordered so the table can be evicted at once). */
+        using ModelsType = std::map<KeyType, Entry>;
+
+        /*! Get the remembered models for the current thread. */
+        static ModelsType &models() noexcept;
+        /*! Get the withIdentityMap() nesting level for the current thread. */
+        static std::size_t &level() noexcept;
+
+        /*! Determine whether the given primary key can't identify a model. */
+        inline static bool isNullKey(const QVariant &id);
+    };
+
+    /* public */
+
+    template<ModelConcept Model>
+    std::optional<Model>
+    IdentityMap::get(const QString &connection, const QString &table,
+                     const QVariant &id)
+    {
+        if (isNullKey(id))
+            return std::nullopt;
+
+        const auto &models = IdentityMap::models();
+
+        const auto it = models.find(KeyType {connection, table, id.toString()});
+
+        if (it == models.cend() || it->second.type != std::type_index(typeid (Model)))
+            return std::nullopt;
+
+        return *std::static_pointer_cast<const Model>(it->second.model);
+    }
+
+    template<ModelConcept Model>
+    void IdentityMap::put(const QString &connection, const QString &table,
+                          const Model &model)
+    {
+        const auto id = model.getKey();
+
+        if (!isEnabled() || isNullKey(id))
+            return;
+
+        models().insert_or_assign(KeyType {connection, table, id.toString()},
+                                  Entry {std::type_index(typeid (Model)),
+                                         std::make_shared<const Model>(model)});
+    }
+
+    /* private */
+
+    bool IdentityMap::isNullKey(const QVariant &id)
+    {
+        return !id.isValid() || id.isNull();
+    }
+
+} // namespace Orm::Tiny::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_SUPPORT_IDENTITYMAP_HPP
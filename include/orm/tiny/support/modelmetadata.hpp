@@ -0,0 +1,97 @@
+#pragma once
+#ifndef ORM_TINY_SUPPORT_MODELMETADATA_HPP
+#define ORM_TINY_SUPPORT_MODELMETADATA_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/constants.hpp"
+#include "orm/utils/string.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Support
+{
+
+    /*! Immutable metadata of the model type, computed once at first use and shared
+        by all threads (doesn't depend on the model instance or u_xx data members). */
+    template<typename Derived>
+    class ModelMetadata
+    {
+        Q_DISABLE_COPY_MOVE(ModelMetadata)
+
+        /*! Alias for the string utils. */
+        using StringUtils = Orm::Utils::String;
+        /*! Alias for the type utils. */
+        using TypeUtils = Orm::Utils::Type;
+
+    public:
+        /*! Default destructor. */
+        ~ModelMetadata() = default;
+
+        /*! Get the metadata instance of the Derived model type. */
+        inline static const ModelMetadata &instance();
+
+        /*! Get the model's class name w/o a namespace and template parameters. */
+        inline const QString &classBasename() const noexcept;
+        /*! Get the model's snake_cased class name (used by the default foreign key). */
+        inline const QString &snakeName() const noexcept;
+        /*! Get the guessed table name (pluralized snake_cased class name). */
+        inline const QString &guessedTable() const noexcept;
+
+    private:
+        /*! Private constructor (computes all metadata). */
+        ModelMetadata();
+
+        /*! The model's class name w/o a namespace and template parameters. */
+        QString m_classBasename;
+        /*! The model's snake_cased class name. */
+        QString m_snakeName;
+        /*! The guessed table name (pluralized snake_cased class name). */
+        QString m_guessedTable;
+    };
+
+    /* public */
+
+    template<typename Derived>
+    const ModelMetadata<Derived> &ModelMetadata<Derived>::instance()
+    {
+        // The initialization of the function-local static is thread-safe
+        static const ModelMetadata cached;
+
+        return cached;
+    }
+
+    template<typename Derived>
+    const QString &ModelMetadata<Derived>::classBasename() const noexcept
+    {
+        return m_classBasename;
+    }
+
+    template<typename Derived>
+    const QString &ModelMetadata<Derived>::snakeName() const noexcept
+    {
+        return m_snakeName;
+    }
+
+    template<typename Derived>
+    const QString &ModelMetadata<Derived>::guessedTable() const noexcept
+    {
+        return m_guessedTable;
+    }
+
+    /* private */
+
+    template<typename Derived>
+    ModelMetadata<Derived>::ModelMetadata()
+        : m_classBasename(TypeUtils::classPureBasename<Derived>())
+        , m_snakeName(StringUtils::snake(m_classBasename))
+        , m_guessedTable(Orm::Constants::TMPL_PLURAL.arg(m_snakeName))
+    {}
+
+} // namespace Orm::Tiny::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_SUPPORT_MODELMETADATA_HPP
@@ -38,14 +38,17 @@ namespace Support::Stores
                                   std::unique_ptr<Relations::IsRelation>>;
 
     /* Forward declarations */
+    /*! The store for updating owner's counter cache columns. */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    class CounterCacheRelationStore;
     /*! The store for loading eager relations. */
     template<typename Derived,
              TINY_RSA_ERS_CLANG16(TINY_RSA_ERS_IS_CLANG16) CollectionModel,
              AllRelationsConcept ...AllRelations>
     class EagerRelationStore;
+    /*! The store for loading relations using the left join. */
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    /*! The store for the Model push() method. */
-    class PushRelationStore;
+    class JoinRelationStore;
     template<typename Derived, AllRelationsConcept ...AllRelations>
     /*! The store for touching owner's timestamps. */
     class TouchOwnersRelationStore;
@@ -58,10 +61,9 @@ namespace Support::Stores
     /*! The store for obtaining a Relation instance for QueriesRelationships. */
     template<typename Derived, typename Related, AllRelationsConcept ...AllRelations>
     class QueriesRelationshipsStore;
-    /*! The store for serializing relationship. */
-    template<SerializedAttributes C, typename Derived,
-             AllRelationsConcept ...AllRelations>
-    class SerializeRelationStore;
+    /*! The store to resolve the relation operations for the relation name. */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    class DispatchRelationStore;
 
     /*! Type of data saved in the relation store. */
     enum struct RelationStoreType : quint8
@@ -70,10 +72,12 @@ namespace Support::Stores
         EAGER,
         /*! The store for loading eager relations (collection of pointers). */
         EAGER_POINTERS,
-        /*! The store for the Model push() method. */
-        PUSH,
+        /*! The store for loading relations using the left join. */
+        JOIN,
         /*! The store for touching owner's timestamps. */
         TOUCH_OWNERS,
+        /*! The store for updating owner's counter cache columns. */
+        COUNTER_CACHE,
         /*! The store for the lazy loading. */
         LAZY_RESULTS,
         /*! The store to obtain the related table name for BelongsToMany relation. */
@@ -84,10 +88,8 @@ namespace Support::Stores
         QUERIES_RELATIONSHIPS_TINY,
         /*! Save arguments needed to build a query for last relation in hasNested(). */
         QUERIES_RELATIONSHIPS_TINY_NESTED,
-        /*! The store for serializing relationship (QVariantMap). */
-        RELATION_TO_MAP,
-        /*! The store for serializing relationship (QList<AttributeItem>). */
-        RELATION_TO_VECTOR,
+        /*! The store to resolve the relation operations (push and serialization). */
+        DISPATCH,
     };
 
     /*! Base class for relation stores. */
@@ -181,24 +183,30 @@ namespace Support::Stores
             static_cast<EagerRelationStore<Derived *> &>(*this).visited(method);
             break;
 
+        case RelationStoreType::JOIN:
+            static_cast<JoinRelationStore &>(*this).visited(method);
+            break;
+
         case RelationStoreType::TOUCH_OWNERS:
             static_cast<TouchOwnersRelationStore &>(*this).visited(method);
             break;
 
-        case RelationStoreType::PUSH:
-            static_cast<PushRelationStore &>(*this).visited(method);
+        case RelationStoreType::COUNTER_CACHE:
+            static_cast<CounterCacheRelationStore &>(*this).visited(method);
             break;
 
         case RelationStoreType::BELONGSTOMANY_RELATED_TABLE:
             static_cast<BelongsToManyRelatedTableStore &>(*this).visited(method);
             break;
 
+        case RelationStoreType::DISPATCH:
+            static_cast<DispatchRelationStore &>(*this).visited(method);
+            break;
+
         case RelationStoreType::LAZY_RESULTS:
         case RelationStoreType::QUERIES_RELATIONSHIPS_QUERY:
         case RelationStoreType::QUERIES_RELATIONSHIPS_TINY:
         case RelationStoreType::QUERIES_RELATIONSHIPS_TINY_NESTED:
-        case RelationStoreType::RELATION_TO_MAP:
-        case RelationStoreType::RELATION_TO_VECTOR:
         {
             using Related = typename std::invoke_result_t<Method, Derived>
                                         ::element_type::RelatedType;
@@ -219,16 +227,6 @@ namespace Support::Stores
                         .template visited<Related>(method);
                 break;
 
-            case RelationStoreType::RELATION_TO_MAP:
-                static_cast<SerializeRelationStore<QVariantMap> &>(*this)
-                        .visited(method);
-                break;
-
-            case RelationStoreType::RELATION_TO_VECTOR:
-                static_cast<SerializeRelationStore<QList<AttributeItem>> &>(*this)
-                        .visited(method);
-                break;
-
             default:
                 Q_UNREACHABLE();
             }
@@ -0,0 +1,102 @@
+#pragma once
+#ifndef ORM_TINY_RELATIONS_STORES_COUNTERCACHERELATIONSTORE_HPP
+#define ORM_TINY_RELATIONS_STORES_COUNTERCACHERELATIONSTORE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/tiny/support/stores/baserelationstore.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Support::Stores
+{
+
+    /*! The store for updating owner's counter cache columns. */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    class CounterCacheRelationStore final :
+            public BaseRelationStore<Derived, AllRelations...>
+    {
+        Q_DISABLE_COPY_MOVE(CounterCacheRelationStore)
+
+        /*! Alias for the NotNull. */
+        template<typename T>
+        using NotNull = Orm::Utils::NotNull<T>;
+
+        /*! Alias for the BaseRelationStore (for shorter name). */
+        using BaseRelationStore_ = BaseRelationStore<Derived, AllRelations...>;
+        /*! Alias for the HasRelationStore (for shorter name). */
+        using HasRelationStore = Concerns::HasRelationStore<Derived, AllRelations...>;
+
+        // To access visited()
+        friend BaseRelationStore_;
+
+    public:
+        /*! Constructor. */
+        CounterCacheRelationStore(
+                NotNull<HasRelationStore *> hasRelationStore, const QString &relation,
+                const QString &column, const QVariantMap &original,
+                bool countedBefore, bool countedAfter, CounterCacheUpdates *updates);
+        /*! Default destructor. */
+        ~CounterCacheRelationStore() = default;
+
+    private:
+        /*! Method called after visitation. */
+        template<RelationshipMethod<Derived> Method>
+        void visited(Method method);
+
+        /*! The relation name. */
+        NotNull<const QString *> m_relation;
+        /*! The counter cache column on the owner model. */
+        NotNull<const QString *> m_column;
+        /*! The original attributes of the model before the write. */
+        NotNull<const QVariantMap *> m_original;
+        /*! Determine whether the model was counted before the write. */
+        bool m_countedBefore;
+        /*! Determine whether the model is counted after the write. */
+        bool m_countedAfter;
+        /*! The updates collected during the batch write (nullptr to update
+            the counters immediately). */
+        CounterCacheUpdates *m_updates;
+    };
+
+    /* public */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    CounterCacheRelationStore<Derived, AllRelations...>::CounterCacheRelationStore(
+            NotNull<HasRelationStore *> hasRelationStore, const QString &relation,
+            const QString &column, const QVariantMap &original,
+            const bool countedBefore, const bool countedAfter,
+            CounterCacheUpdates *const updates
+    )
+        : BaseRelationStore_(hasRelationStore, RelationStoreType::COUNTER_CACHE)
+        , m_relation(&relation)
+        , m_column(&column)
+        , m_original(&original)
+        , m_countedBefore(countedBefore)
+        , m_countedAfter(countedAfter)
+        , m_updates(updates)
+    {}
+
+    /* private */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<RelationshipMethod<Derived> Method>
+    void
+    CounterCacheRelationStore<Derived, AllRelations...>::visited(const Method method)
+    {
+        auto relationInstance = std::invoke(method, this->model());
+
+        using Related = typename std::invoke_result_t<Method, Derived>
+                                    ::element_type::RelatedType;
+
+        this->basemodel().template counterCacheVisited<Related>(
+                    relationInstance, *m_relation, *m_column, *m_original,
+                    m_countedBefore, m_countedAfter, m_updates);
+    }
+
+} // namespace Orm::Tiny::Support::Stores
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_RELATIONS_STORES_COUNTERCACHERELATIONSTORE_HPP
@@ -0,0 +1,220 @@
+#pragma once
+#ifndef ORM_TINY_RELATIONS_STORES_DISPATCHRELATIONSTORE_HPP
+#define ORM_TINY_RELATIONS_STORES_DISPATCHRELATIONSTORE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <typeinfo>
+
+#include "orm/macros/threadlocal.hpp"
+#include "orm/tiny/support/stores/baserelationstore.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+namespace Relations
+{
+    class IsPivotRelation;
+
+    template<class Model, class Related>
+    class BelongsTo;
+}
+
+namespace Support::Stores
+{
+
+    /*! Get the PivotType of the belongs-to-many relation (void for other relations). */
+    template<typename Relation>
+    struct PivotTypeOf
+    {
+        /*! The pivot type (has-one, has-many, and belongs-to). */
+        using type = void;
+    };
+
+    /*! Get the PivotType of the belongs-to-many relation. */
+    template<typename Relation>
+    requires std::is_base_of_v<Relations::IsPivotRelation, Relation>
+    struct PivotTypeOf<Relation>
+    {
+        /*! The pivot type (belongs-to-many). */
+        using type = typename Relation::PivotTypeType;
+    };
+
+    /*! Relation operations that only depend on the relation types (Related and
+        PivotType), resolved only once for every relation name. */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    struct RelationDispatch
+    {
+        /*! Alias for the HasRelationships (for shorter name). */
+        using HasRelationships = Concerns::HasRelationships<Derived, AllRelations...>;
+
+        /*! Serialize the relation to the QVariantMap (toMap()). */
+        void (*serializeToMap)(const HasRelationships &model, const QString &relation,
+                               const RelationsType<AllRelations...> &models,
+                               QVariantMap &attributes) = nullptr;
+        /*! Serialize the relation to the QList<AttributeItem> (toList()). */
+        void (*serializeToList)(const HasRelationships &model, const QString &relation,
+                                const RelationsType<AllRelations...> &models,
+                                QList<AttributeItem> &attributes) = nullptr;
+        /*! Push all the relation models (push()). */
+        bool (*push)(RelationsType<AllRelations...> &models) = nullptr;
+        /*! Type of the owner model for the belongs-to relation (nullptr otherwise). */
+        const std::type_info *belongsToOwner = nullptr;
+    };
+
+    /*! The store to resolve the relation operations for the relation name (used by
+        the hot paths like push() and serialization, they don't need the Relation
+        instance, so they call the resolved operations directly). */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    class DispatchRelationStore final :
+            public BaseRelationStore<Derived, AllRelations...>
+    {
+        Q_DISABLE_COPY_MOVE(DispatchRelationStore)
+
+        // To access visitWithResult() and cached()
+        friend Concerns::HasRelationships<Derived, AllRelations...>;
+
+        /*! Alias for the NotNull. */
+        template<typename T>
+        using NotNull = Orm::Utils::NotNull<T>;
+
+        /*! Alias for the BaseRelationStore (for shorter name). */
+        using BaseRelationStore_ = BaseRelationStore<Derived, AllRelations...>;
+        /*! Alias for the HasRelationStore (for shorter name). */
+        using HasRelationStore = Concerns::HasRelationStore<Derived, AllRelations...>;
+        /*! Alias for the RelationDispatch (for shorter name). */
+        using RelationDispatch = Stores::RelationDispatch<Derived, AllRelations...>;
+
+        // To access visited()
+        friend BaseRelationStore_;
+
+    public:
+        /*! Constructor. */
+        explicit DispatchRelationStore(NotNull<HasRelationStore *> hasRelationStore);
+        /*! Default destructor. */
+        ~DispatchRelationStore() = default;
+
+    private:
+        /*! Visit the given relation and return the resolved relation operations. */
+        const RelationDispatch &visitWithResult(const QString &relation);
+
+        /*! Get already resolved relation operations (nullptr if not resolved yet). */
+        static const RelationDispatch *cached(const QString &relation);
+
+        /*! Method called after visitation. */
+        template<RelationshipMethod<Derived> Method>
+        void visited(Method /*unused*/);
+
+        /*! The resolved relation operations cache type (keyed by relation name). */
+        using CacheType = std::unordered_map<QString, RelationDispatch>;
+
+        /*! Get the resolved relation operations cache. */
+        inline static CacheType &cache();
+
+        /*! The resolved relation operations. */
+        RelationDispatch m_result;
+    };
+
+    /* public */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    DispatchRelationStore<Derived, AllRelations...>::DispatchRelationStore(
+            NotNull<HasRelationStore *> hasRelationStore
+    )
+        : BaseRelationStore_(hasRelationStore, RelationStoreType::DISPATCH)
+    {}
+
+    /* private */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const typename DispatchRelationStore<Derived, AllRelations...>::RelationDispatch &
+    DispatchRelationStore<Derived, AllRelations...>::visitWithResult(
+            const QString &relation)
+    {
+        // Skip visitation if the result is already cached
+        if (const auto *const dispatch = cached(relation); dispatch != nullptr)
+            return *dispatch;
+
+        BaseRelationStore_::visit(relation);
+
+        /* Cache the result so it will visit only once for the Derived model and
+           the given relation, references to the std::unordered_map values are
+           stable. */
+        return cache().emplace(relation, m_result).first->second;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const typename DispatchRelationStore<Derived, AllRelations...>::RelationDispatch *
+    DispatchRelationStore<Derived, AllRelations...>::cached(const QString &relation)
+    {
+        const auto &cache = DispatchRelationStore::cache();
+
+        if (const auto it = cache.find(relation); it != cache.cend())
+            return &it->second;
+
+        return nullptr;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<RelationshipMethod<Derived> Method>
+    void DispatchRelationStore<Derived, AllRelations...>::visited(
+            const Method /*unused*/)
+    {
+        using Relation = typename std::invoke_result_t<Method, Derived>::element_type;
+        using Related  = typename Relation::RelatedType;
+
+        /* Here is the last and only one chance where we can obtain the PivotType
+           for the belongs-to-many relation, so we need to pass it down, so that
+           the toMap() or toList() can obtain the correct pivot model type
+           from the m_relations map's std::variant. */
+        using PivotType = typename PivotTypeOf<Relation>::type;
+
+        using HasRelationships = typename RelationDispatch::HasRelationships;
+
+        m_result.serializeToMap = [](
+                const HasRelationships &model, const QString &relation,
+                const RelationsType<AllRelations...> &models, QVariantMap &attributes)
+        {
+            model.template serializeRelationVisited<Related, QVariantMap, PivotType>(
+                        relation, models, attributes);
+        };
+
+        m_result.serializeToList = [](
+                const HasRelationships &model, const QString &relation,
+                const RelationsType<AllRelations...> &models,
+                QList<AttributeItem> &attributes)
+        {
+            model.template serializeRelationVisited<Related, QList<AttributeItem>,
+                                                    PivotType>(
+                        relation, models, attributes);
+        };
+
+        m_result.push = [](RelationsType<AllRelations...> &models)
+        {
+            return HasRelationships::template pushVisited<Related>(models);
+        };
+
+        // Only the child model knows its owner
+        if constexpr (std::is_same_v<Relation, Relations::BelongsTo<Derived, Related>>)
+            m_result.belongsToOwner = &typeid (Related);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    typename DispatchRelationStore<Derived, AllRelations...>::CacheType &
+    DispatchRelationStore<Derived, AllRelations...>::cache()
+    {
+        // The same as for the BelongsToManyRelatedTableStore, no mutex is needed
+        T_THREAD_LOCAL
+        static CacheType cache;
+
+        return cache;
+    }
+
+} // namespace Support::Stores
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_RELATIONS_STORES_DISPATCHRELATIONSTORE_HPP
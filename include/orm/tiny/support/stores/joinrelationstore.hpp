@@ -0,0 +1,102 @@
+#pragma once
+#ifndef ORM_TINY_RELATIONS_STORES_JOINRELATIONSTORE_HPP
+#define ORM_TINY_RELATIONS_STORES_JOINRELATIONSTORE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/tiny/support/stores/baserelationstore.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Support::Stores
+{
+
+    /*! The store for loading relations using the left join. */
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    class JoinRelationStore final : public BaseRelationStore<Derived, AllRelations...>
+    {
+        Q_DISABLE_COPY_MOVE(JoinRelationStore)
+
+        /*! Alias for the NotNull. */
+        template<typename T>
+        using NotNull = Orm::Utils::NotNull<T>;
+
+        /*! Alias for the BaseRelationStore (for shorter name). */
+        using BaseRelationStore_ = BaseRelationStore<Derived, AllRelations...>;
+        /*! Alias for the HasRelationStore (for shorter name). */
+        using HasRelationStore = Concerns::HasRelationStore<Derived, AllRelations...>;
+
+        // To access visited()
+        friend BaseRelationStore_;
+
+    public:
+        /*! Constructor. */
+        JoinRelationStore(
+                NotNull<HasRelationStore *> hasRelationStore,
+                const Tiny::TinyBuilder<Derived> &builder, QueryBuilder &query,
+                QList<JoinLoadItem<Derived>> &joinLoads, const QString &relation);
+        /*! Default destructor. */
+        ~JoinRelationStore() = default;
+
+    private:
+        /*! Method called after visitation. */
+        template<RelationshipMethod<Derived> Method>
+        void visited(Method method) const;
+
+        /*! The Tiny builder instance to which the visited relation will be dispatched. */
+        NotNull<const Tiny::TinyBuilder<Derived> *> m_builder;
+        /*! The query to which the left join will be added. */
+        NotNull<QueryBuilder *> m_query;
+        /*! Join load items used to hydrate the joined relations. */
+        NotNull<QList<JoinLoadItem<Derived>> *> m_joinLoads;
+        /*! The relation name to load using the join. */
+        NotNull<const QString *> m_relation;
+    };
+
+    /* public */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    JoinRelationStore<Derived, AllRelations...>::JoinRelationStore(
+            NotNull<HasRelationStore *> hasRelationStore,
+            const Tiny::TinyBuilder<Derived> &builder, QueryBuilder &query,
+            QList<JoinLoadItem<Derived>> &joinLoads, const QString &relation
+    )
+        : BaseRelationStore_(hasRelationStore, RelationStoreType::JOIN)
+        , m_builder(&builder)
+        , m_query(&query)
+        , m_joinLoads(&joinLoads)
+        , m_relation(&relation)
+    {}
+
+    /* private */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<RelationshipMethod<Derived> Method>
+    void JoinRelationStore<Derived, AllRelations...>::visited(const Method method) const
+    {
+        using Related = typename std::invoke_result_t<Method, Derived>
+                                    ::element_type::RelatedType;
+
+        /* The same as for the eager loading, the dummy model prevents the dangling
+           reference in the Relation::m_parent, the relation creates the default
+           related models during the hydration so the dummy model is shared with it. */
+        auto dummyModel = std::make_shared<Derived>(this->basemodel().newInstance());
+
+        // The relation constraints aren't needed, the join condition is used instead
+        auto relationInstance =
+                Relations::Relation<Derived, Related>::noConstraints(
+                    [&method, &dummyModel]
+        {
+            return std::invoke(method, *dummyModel);
+        });
+
+        m_builder->joinLoadRelationVisited(relationInstance, std::move(dummyModel),
+                                           *m_query, *m_joinLoads, *m_relation);
+    }
+
+} // namespace Orm::Tiny::Support::Stores
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_RELATIONS_STORES_JOINRELATIONSTORE_HPP
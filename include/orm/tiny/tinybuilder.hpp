@@ -8,16 +8,22 @@ TINY_SYSTEM_HEADER
 #include "orm/macros/sqldrivermappings.hpp"
 #include TINY_INCLUDE_TSqlRecord
 
+#include <unordered_set>
+
 #include <range/v3/action/transform.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/macros/likely.hpp"
 #include "orm/utils/helpers.hpp"
 
 #include "orm/tiny/concerns/buildsqueries.hpp"
 #include "orm/tiny/concerns/buildssoftdeletes.hpp"
 #include "orm/tiny/concerns/queriesrelationships.hpp"
 #include "orm/tiny/exceptions/modelnotfounderror.hpp"
+#include "orm/tiny/support/identitymap.hpp"
 #include "orm/tiny/tinybuilderproxies.hpp"
+#include "orm/tiny/types/attributeslayout.hpp"
 
 #ifdef TINYORM_NO_DEBUG
 #  include "orm/utils/query.hpp"
@@ -44,6 +50,8 @@ namespace Orm::Tiny
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
         /*! Alias for the helper utils. */
         using Helpers = Orm::Utils::Helpers;
+        /*! Alias for the IdentityMap. */
+        using IdentityMap = Orm::Tiny::Support::IdentityMap;
         /*! Alias for the query utils. */
         using QueryUtils = Orm::Utils::Query;
         /*! Alias for the type utils. */
@@ -195,6 +203,13 @@ namespace Orm::Tiny
             any previously added eager loading specifications. */
         inline Builder &withOnly(QList<QString> &&relations);
 
+        /*! Set the belongs-to or has-one relationship that should be loaded using
+            the left join. */
+        Builder &withJoin(const QString &relation);
+        /*! Set the belongs-to or has-one relationships that should be loaded using
+            the left join. */
+        Builder &withJoin(const QList<QString> &relations);
+
         /* Insert, Update, Delete */
         /*! Save a new model and return the instance. */
         Model create(const QList<AttributeItem> &attributes = {});
@@ -214,12 +229,25 @@ namespace Orm::Tiny
         /*! Update records in the database. */
         std::tuple<int, TSqlQuery>
         update(const QList<UpdateItem> &values);
+        /*! Update records in the database, every row can have different values
+            (rows are matched by the key column, all rows must have the same columns). */
+        std::tuple<int, std::optional<TSqlQuery>>
+        updateMany(const QString &keyColumn, const QList<QVariantMap> &values);
 
         /*! Delete records from the database. */
         std::tuple<int, TSqlQuery> remove();
         /*! Delete records from the database, alias. */
         inline std::tuple<int, TSqlQuery> deleteModels();
 
+        /*! Update records in chunks walked by the key ranges, every chunk is written
+            by its own statement to avoid the long lock holds. */
+        ChunkedWriteProgress
+        updateInChunks(const QList<UpdateItem> &values,
+                       const ChunkedWriteOptions &options = {});
+        /*! Delete records in chunks walked by the key ranges (soft deletes if
+            the model uses the SoftDeletes). */
+        ChunkedWriteProgress deleteInChunks(const ChunkedWriteOptions &options = {});
+
         /*! Insert new records or update the existing ones. */
         std::tuple<int, std::optional<TSqlQuery>>
         upsert(const QList<QVariantMap> &values, const QStringList &uniqueBy,
@@ -249,6 +277,11 @@ namespace Orm::Tiny
         /*! Get the hydrated models without eager loading. */
         ModelsCollection<Model> getModels(const QList<Column> &columns = {ASTERISK});
 
+        /*! Determine whether the models can be obtained from the identity map (all
+            columns, no constraints except the given number of the key where clauses). */
+        bool canUseIdentityMap(const QList<Column> &columns,
+                               QList<WhereConditionItem>::size_type keyWheres = 0) const;
+
         /*! Eager load the relationships for the models. */
         template<SameDerivedCollectionModel<Model> CollectionModel>
         void eagerLoadRelations(ModelsCollection<CollectionModel> &models) const;
@@ -261,8 +294,38 @@ namespace Orm::Tiny
                 Relation &relation, ModelsCollection<CollectionModel> &models,
                 const WithItem &relationItem) const;
 
+        /*! Add the left join and select columns for the relation loaded using
+            the join. */
+        template<typename Relation>
+        void joinLoadRelationVisited(
+                Relation &relation, std::shared_ptr<Model> &&dummyModel,
+                QueryBuilder &query, QList<JoinLoadItem<Model>> &joinLoads,
+                const QString &relationName) const;
+
         /*! Create a vector of models from the SqlQuery. */
-        ModelsCollection<Model> hydrate(SqlQuery &&result) const; // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+        ModelsCollection<Model>
+        hydrate(SqlQuery &&result, // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+                const QList<JoinLoadItem<Model>> &joinLoads = {}) const;
+        /*! Create a vector of models from the cached result. */
+        ModelsCollection<Model>
+        hydrate(const Query::CachedResult &result,
+                const QList<JoinLoadItem<Model>> &joinLoads = {}) const;
+        /*! Create a new model and its relations loaded using the left join from
+            one row (the value of the given field index is obtained by valueAt). */
+        template<typename ValueAt>
+        static Model
+        hydrateRow(const Model &instance, const QStringList &fieldNames,
+                   const QList<int> &markers, int rowNumberIndex,
+                   const QList<JoinLoadItem<Model>> &joinLoads,
+                   std::optional<Types::AttributesLayout> &layout, ValueAt &&valueAt);
+        /*! Create a new model from the table row, all the models of the same result
+            share the attributes layout of the first model. */
+        static Model
+        newModelFromRow(const Model &instance, QList<AttributeItem> &&row,
+                        std::optional<Types::AttributesLayout> &layout);
+        /*! Get the index of the primary key column used to deduplicate the parent
+            rows of the relations loaded using the join. */
+        int joinLoadKeyIndex(const QStringList &fieldNames, int firstMarker) const;
 
         /*! Get the model instance being queried. */
         inline Model &getModel() noexcept;
@@ -299,6 +362,24 @@ namespace Orm::Tiny
         /*! Get the default key name of the table. */
         inline const QString &defaultKeyName() const;
 
+        /*! Get the hydrated models with the relations loaded using the left join. */
+        ModelsCollection<Model> getModelsWithJoinLoads(const QList<Column> &columns);
+        /*! Determine whether the relations can be loaded using the left join, the
+            limit or offset would count the joined rows of the has-one relations. */
+        bool canUseJoinLoads(const QList<JoinLoadItem<Model>> &joinLoads) const;
+        /*! Get the hydrated models with the relations to load using the left join
+            loaded using the separate queries instead (the same as the with()). */
+        ModelsCollection<Model>
+        getModelsWithEagerJoinLoads(const QList<Column> &columns);
+        /*! Qualify the unqualified columns of the query by the model's table
+            (the relations loaded using the left join). */
+        void qualifyColumnsForJoinLoads(QueryBuilder &query) const;
+        /*! Qualify the unqualified columns of the given where clauses by the model's
+            table. */
+        void qualifyWheresForJoinLoads(QList<WhereConditionItem> &wheres) const;
+        /*! Qualify the given column by the model's table if it's unqualified. */
+        void qualifyColumnForJoinLoads(Column &column) const;
+
         /*! Parse a list of relations into individuals. */
         QList<WithItem> parseWithRelations(const QList<WithItem> &relations);
         /*! Create a constraint to select the given columns for the relation. */
@@ -321,6 +402,10 @@ namespace Orm::Tiny
         QList<UpdateItem>
         addUpdatedAtColumn(QList<UpdateItem> values) const;
 
+        /*! Add the "updated at" column to every row of the updated values. */
+        QList<QVariantMap>
+        addUpdatedAtToUpdateManyValues(const QList<QVariantMap> &values) const;
+
         /*! Add timestamps to the inserted values. */
         QList<QVariantMap>
         addTimestampsToUpsertValues(const QList<QVariantMap> &values) const;
@@ -333,6 +418,10 @@ namespace Orm::Tiny
         /*! Add a generic "order by" clause if the query doesn't already have one. */
         void enforceOrderBy();
 
+        /*! Forget the models affected by the update or delete query in the identity
+            map (only the given models if the query is constrained by keys only). */
+        void evictFromIdentityMap() const;
+
         /*! Apply the given scope on the current builder instance. */
 //        template<typename ...Args>
 //        Builder &callScope(const std::function<void(Builder &, Args ...)> &scope,
@@ -347,6 +436,8 @@ namespace Orm::Tiny
         Model m_model;
         /*! The relationships that should be eager loaded. */
         QList<WithItem> m_eagerLoad;
+        /*! The relationships that should be loaded using the left join. */
+        QList<QString> m_joinLoad;
 
         /*! A replacement for the typical delete function. */
         std::function<std::tuple<int, TSqlQuery>(Builder<Model> &)> m_onDelete = nullptr;
@@ -512,7 +603,22 @@ namespace Orm::Tiny
     std::optional<Model>
     Builder<Model>::find(const QVariant &id, const QList<Column> &columns)
     {
-        return whereKey(id).first(columns);
+        if (!canUseIdentityMap(columns))
+            return whereKey(id).first(columns);
+
+        const auto &connection = m_query->getConnection().getName();
+        const auto &table = m_model.getTable();
+
+        // Already loaded in the identity map scope
+        if (auto model = IdentityMap::get<Model>(connection, table, id); model)
+            return model;
+
+        auto model = whereKey(id).first(columns);
+
+        if (model)
+            IdentityMap::put(connection, table, *model);
+
+        return model;
     }
 
     template<typename Model>
@@ -548,7 +654,35 @@ namespace Orm::Tiny
         if (ids.isEmpty())
             return {};
 
-        return whereKey(ids).get(columns);
+        if (!canUseIdentityMap(columns))
+            return whereKey(ids).get(columns);
+
+        const auto &connection = m_query->getConnection().getName();
+        const auto &table = m_model.getTable();
+
+        ModelsCollection<Model> models;
+        models.reserve(ids.size());
+
+        // Query only the models that weren't loaded in the identity map scope yet
+        QList<QVariant> missingIds;
+
+        for (const auto &id : ids)
+            if (auto model = IdentityMap::get<Model>(connection, table, id); model)
+                models << std::move(*model);
+            else
+                missingIds << id;
+
+        // Nothing to query
+        if (missingIds.isEmpty())
+            return models;
+
+        for (auto &model : whereKey(missingIds).get(columns)) {
+            IdentityMap::put(connection, table, model);
+
+            models << std::move(model);
+        }
+
+        return models;
     }
 
     template<typename Model>
@@ -855,6 +989,28 @@ namespace Orm::Tiny
         return withOnly(WithItem::fromStringVector(std::move(relations)));
     }
 
+    template<typename Model>
+    Builder<Model> &
+    Builder<Model>::withJoin(const QString &relation)
+    {
+        if (!m_joinLoad.contains(relation))
+            m_joinLoad << relation;
+
+        return *this;
+    }
+
+    template<typename Model>
+    Builder<Model> &
+    Builder<Model>::withJoin(const QList<QString> &relations)
+    {
+        m_joinLoad.reserve(m_joinLoad.size() + relations.size());
+
+        for (const auto &relation : relations)
+            withJoin(relation);
+
+        return *this;
+    }
+
     /* Insert, Update, Delete */
 
     template<typename Model>
@@ -892,6 +1048,8 @@ namespace Orm::Tiny
     std::tuple<int, std::optional<TSqlQuery>>
     Builder<Model>::touch(const QString &column)
     {
+        evictFromIdentityMap();
+
         auto time = m_model.freshTimestamp();
 
         if (!column.isEmpty())
@@ -911,9 +1069,21 @@ namespace Orm::Tiny
     std::tuple<int, TSqlQuery>
     Builder<Model>::update(const QList<UpdateItem> &values)
     {
+        evictFromIdentityMap();
+
         return toBase().update(addUpdatedAtColumn(values));
     }
 
+    template<typename Model>
+    std::tuple<int, std::optional<TSqlQuery>>
+    Builder<Model>::updateMany(const QString &keyColumn,
+                               const QList<QVariantMap> &values)
+    {
+        evictFromIdentityMap();
+
+        return toBase().updateMany(keyColumn, addUpdatedAtToUpdateManyValues(values));
+    }
+
     template<typename Model>
     std::tuple<int, TSqlQuery> Builder<Model>::remove()
     {
@@ -921,6 +1091,8 @@ namespace Orm::Tiny
         if (m_onDelete)
             return std::invoke(m_onDelete, *this);
 
+        evictFromIdentityMap();
+
         return toBase().deleteRow();
     }
 
@@ -930,6 +1102,32 @@ namespace Orm::Tiny
         return remove();
     }
 
+    template<typename Model>
+    ChunkedWriteProgress
+    Builder<Model>::updateInChunks(const QList<UpdateItem> &values,
+                                   const ChunkedWriteOptions &options)
+    {
+        evictFromIdentityMap();
+
+        return toBase().updateInChunks(addUpdatedAtColumn(values), options);
+    }
+
+    template<typename Model>
+    ChunkedWriteProgress
+    Builder<Model>::deleteInChunks(const ChunkedWriteOptions &options)
+    {
+        // The same as the onDelete callback registered by the BuildsSoftDeletes
+        if constexpr (m_extendsSoftDeletes)
+            return updateInChunks({{this->getDeletedAtColumn(*this),
+                                    m_model.freshTimestampString()}},
+                                  options);
+        else {
+            evictFromIdentityMap();
+
+            return toBase().deleteInChunks(options);
+        }
+    }
+
     template<typename Model>
     std::tuple<int, std::optional<TSqlQuery>>
     Builder<Model>::upsert(
@@ -947,6 +1145,9 @@ namespace Orm::Tiny
                     "The upsert method doesn't support an empty update argument, please "
                     "use the insert method instead.");
 
+        // The upserted rows are matched by the unique columns instead of the wheres
+        IdentityMap::evictTable(m_query->getConnection().getName(), m_model.getTable());
+
         return toBase().upsert(addTimestampsToUpsertValues(values), uniqueBy,
                                addUpdatedAtToUpsertColumns(update));
     }
@@ -1027,9 +1228,50 @@ namespace Orm::Tiny
     ModelsCollection<Model>
     Builder<Model>::getModels(const QList<Column> &columns)
     {
+        // Relations loaded using the left join need to modify the query
+        if (!m_joinLoad.isEmpty())
+            return getModelsWithJoinLoads(columns);
+
+        // The remembered query is hydrated from the query result cache
+        if (m_query->isRemembering())
+            return hydrate(*m_query->getRemembered(columns));
+
         return hydrate(m_query->get(columns));
     }
 
+    template<typename Model>
+    bool Builder<Model>::canUseIdentityMap(
+            const QList<Column> &columns,
+            const QList<WhereConditionItem>::size_type keyWheres) const
+    {
+        if (!IdentityMap::isEnabled())
+            return false;
+
+        // The remembered models contain all the columns and no relations
+        if (columns != QList<Column> {ASTERISK} || !m_query->getColumns().isEmpty() ||
+            !m_eagerLoad.isEmpty() || !m_joinLoad.isEmpty()
+        )
+            return false;
+
+        // Trashed models are never remembered (only the default soft deletes constraint)
+        if constexpr (m_extendsSoftDeletes)
+            if (!this->m_withSoftDeletes)
+                return false;
+
+        /* Any other constraint could exclude the remembered models, the lock needs
+           the fresh row from the database. */
+        const auto &query = *m_query;
+        const auto &from = query.getFrom();
+
+        return query.getWheres().size() == keyWheres && query.getJoins().isEmpty() &&
+               query.getGroups().isEmpty() && query.getHavings().isEmpty() &&
+               query.getUnions().isEmpty() &&
+               query.getLimit() < 0 && query.getOffset() < 0 &&
+               std::holds_alternative<std::monostate>(query.getLock()) &&
+               std::holds_alternative<QString>(from) &&
+               std::get<QString>(from) == m_model.getTable();
+    }
+
     // TODO docs add similar note for lazy load silverqx
     /* Look also at EagerRelationStore::visited(), where the whole flow begins.
        How this relation flow works:
@@ -1130,9 +1372,14 @@ namespace Orm::Tiny
 
         // Add relation constraints defined in the user callback
         // NOTE api different, Eloquent is passing the Relation reference into the lambda, it would be almost impossible to do it silverqx
-        if (relationItem.constraints)
+        if (relationItem.constraints) {
             std::invoke(relationItem.constraints, relation->getBaseQuery());
 
+            /* The limit defined in the user callback would be applied to all parent
+               models together, limit related models for every parent separately. */
+            relation->addEagerGroupLimit();
+        }
+
         /* Once we have the results, we just match those back up to their parent models
            using the relationship instance. Then we just return the finished vector
            of models which have been eagerly hydrated and are readied for return. */
@@ -1140,33 +1387,265 @@ namespace Orm::Tiny
                         relation->getEager(), relationItem.name);
     }
 
+    template<typename Model>
+    template<typename Relation>
+    void Builder<Model>::joinLoadRelationVisited(
+            Relation &relation, std::shared_ptr<Model> &&dummyModel,
+            QueryBuilder &query, QList<JoinLoadItem<Model>> &joinLoads,
+            const QString &relationName) const
+    {
+        using Related = typename Relation::element_type::RelatedType;
+
+        /* The alias of the joined table and also of the marker column, the marker
+           column separates the related model's columns from other columns. */
+        auto alias = QStringLiteral("tinyorm_join_%1").arg(relationName);
+
+        auto joinKey = relation->addJoinLoadConstraints(query, alias);
+
+        query.addSelect(Expression(QStringLiteral("null as %1")
+                                   .arg(query.getGrammar().wrap(alias))))
+             .addSelect(DOT_IN.arg(alias, ASTERISK));
+
+        const auto matchesMany = relation->joinLoadMatchesMany();
+
+        /* The relation creates the related models during the hydration, it references
+           the dummy parent model, so the dummy model must live as long as it. */
+        std::shared_ptr<const typename Relation::element_type> sharedRelation =
+                std::move(relation);
+
+        auto hydrateRelation = [relationName, joinKey = std::move(joinKey),
+                        relation = std::move(sharedRelation),
+                        parent = std::move(dummyModel),
+                        connection = query.getConnection().getName()]
+                       (Model &model, QList<AttributeItem> &&attributes)
+        {
+            // All the related columns are null if the left join didn't match
+            const auto itKey = std::ranges::find(attributes, joinKey,
+                                                 &AttributeItem::key);
+
+            if (itKey == attributes.cend() || itKey->value.isNull())
+                model.template setRelation<Related>(
+                            relationName, relation->getJoinLoadDefaultFor(model));
+            else
+                model.setRelation(relationName,
+                                  std::make_optional<Related>(
+                                      relation->getRelated().newFromBuilder(
+                                          std::move(attributes), connection)));
+        };
+
+        joinLoads.append({std::move(alias), std::move(hydrateRelation), matchesMany});
+    }
+
     template<typename Model>
     ModelsCollection<Model>
-    Builder<Model>::hydrate(SqlQuery &&result) const // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+    Builder<Model>::hydrate(
+            SqlQuery &&result, // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+            const QList<JoinLoadItem<Model>> &joinLoads) const
     {
         auto instance = newModelInstance();
 
         ModelsCollection<Model> models;
         models.reserve(QueryUtils::queryResultSize(result));
 
+        /* The group limit adds the row number column, it's an internal column so it
+           must not be hydrated into the model attributes (-1 w/o the group limit). */
+        int rowNumberIndex = -1;
+
+        /* Indexes of the join load marker columns, columns of the relation loaded
+           using the join follow after its marker column. */
+        QList<int> markers;
+        markers.reserve(joinLoads.size());
+
+        /* The has-one relation loaded using the join can match more related rows for
+           one parent row, only the first row of every parent model is hydrated. */
+        const auto deduplicate = std::ranges::any_of(joinLoads,
+                                                     &JoinLoadItem<Model>::matchesMany);
+        std::unordered_set<QString> hydratedKeys;
+        int keyIndex = -1;
+
+        /* All rows have the same columns so it's enough to obtain the field names and
+           markers only once. The record() also fetches the values of all fields of
+           the current row from the driver (they would be fetched twice), so it isn't
+           called for every row. The QDateTime preparation and time zone conversion
+           of the SqlQuery::value() were never applied to the record() values. */
+        QStringList fieldNames;
+
+        // All models share the attributes layout of the first model
+        std::optional<Types::AttributesLayout> layout;
+
         while (result.next()) {
-            const auto record = result.record();
-            const auto fieldsCount = record.count();
+            if (fieldNames.isEmpty()) {
+                const auto record = result.record();
+
+                if (m_query->getGroupLimit())
+                    rowNumberIndex = record.indexOf(GroupLimitRow);
+
+                fieldNames.reserve(record.count());
+                for (int i = 0; i < record.count(); ++i)
+                    fieldNames << record.fieldName(i);
+
+                for (const auto &joinLoad : joinLoads)
+                    markers << record.indexOf(joinLoad.marker);
+
+                if (deduplicate)
+                    keyIndex = joinLoadKeyIndex(fieldNames, markers.constFirst());
+            }
+
+            // Skip the parent row that was already hydrated with the first matched row
+            if (deduplicate &&
+                !hydratedKeys.insert(result.value(keyIndex).toString()).second
+            )
+                continue;
+
+            models << hydrateRow(instance, fieldNames, markers, rowNumberIndex,
+                                 joinLoads, layout,
+                                 [&result](const int index)
+            {
+                return result.value(index);
+            });
+        }
+
+        return models;
+    }
+
+    template<typename Model>
+    ModelsCollection<Model>
+    Builder<Model>::hydrate(const Query::CachedResult &result,
+                            const QList<JoinLoadItem<Model>> &joinLoads) const
+    {
+        ModelsCollection<Model> models;
+
+        if (result.rows.isEmpty())
+            return models;
 
-            QList<AttributeItem> row;
-            row.reserve(fieldsCount);
+        models.reserve(result.size());
+
+        auto instance = newModelInstance();
 
-            // Populate model attributes with data from the database (one table row)
-            for (int i = 0; i < fieldsCount; ++i)
-                row.append({record.fieldName(i), result.value(i)});
+        const auto &fieldNames = result.columns;
+        // The internal row number column added by the group limit isn't hydrated
+        const auto rowNumberIndex = m_query->getGroupLimit()
+                                    ? static_cast<int>(fieldNames.indexOf(GroupLimitRow))
+                                    : -1;
+
+        // Columns of the relation loaded using the join follow after its marker column
+        QList<int> markers;
+        markers.reserve(joinLoads.size());
+
+        for (const auto &joinLoad : joinLoads)
+            markers << static_cast<int>(fieldNames.indexOf(joinLoad.marker));
+
+        // Only the first row of every parent model is hydrated (has-one join loads)
+        const auto deduplicate = std::ranges::any_of(joinLoads,
+                                                     &JoinLoadItem<Model>::matchesMany);
+        std::unordered_set<QString> hydratedKeys;
+        const auto keyIndex = deduplicate
+                              ? joinLoadKeyIndex(fieldNames, markers.constFirst())
+                              : -1;
+
+        // All models share the attributes layout of the first model
+        std::optional<Types::AttributesLayout> layout;
+
+        for (const auto &values : result.rows) {
+            if (deduplicate &&
+                !hydratedKeys.insert(values.at(keyIndex).toString()).second
+            )
+                continue;
 
-            // Create a new model instance from the table row
-            models << instance.newFromBuilder(std::move(row));
+            // The cached values are copied, every model can be modified independently
+            models << hydrateRow(instance, fieldNames, markers, rowNumberIndex,
+                                 joinLoads, layout,
+                                 [&values](const int index)
+            {
+                return values.at(index);
+            });
         }
 
         return models;
     }
 
+    template<typename Model>
+    template<typename ValueAt>
+    Model Builder<Model>::hydrateRow(
+            const Model &instance, const QStringList &fieldNames,
+            const QList<int> &markers, const int rowNumberIndex,
+            const QList<JoinLoadItem<Model>> &joinLoads,
+            std::optional<Types::AttributesLayout> &layout, ValueAt &&valueAt)
+    {
+        const auto fieldsCount = static_cast<int>(fieldNames.size());
+
+        // The model's columns end before the first marker column
+        const auto modelFieldsCount = markers.isEmpty() ? fieldsCount
+                                                        : markers.constFirst();
+
+        QList<AttributeItem> row;
+        row.reserve(modelFieldsCount);
+
+        /* Populate model attributes with data from the database (one table row),
+           the field names are implicitly shared between all hydrated models. */
+        for (int i = 0; i < modelFieldsCount; ++i)
+            if (i != rowNumberIndex)
+                row.append({fieldNames.at(i), std::invoke(valueAt, i)});
+
+        // Create a new model instance from the table row
+        auto model = newModelFromRow(instance, std::move(row), layout);
+
+        // Hydrate the relations loaded using the left join
+        for (QList<int>::size_type j = 0; j < markers.size(); ++j) {
+            const auto last = j + 1 < markers.size() ? markers.at(j + 1) : fieldsCount;
+
+            QList<AttributeItem> relatedRow;
+            relatedRow.reserve(last - markers.at(j) - 1);
+
+            for (auto i = markers.at(j) + 1; i < last; ++i)
+                if (i != rowNumberIndex)
+                    relatedRow.append({fieldNames.at(i), std::invoke(valueAt, i)});
+
+            std::invoke(joinLoads.at(j).hydrate, model, std::move(relatedRow));
+        }
+
+        return model;
+    }
+
+    template<typename Model>
+    Model Builder<Model>::newModelFromRow(
+            const Model &instance, QList<AttributeItem> &&row,
+            std::optional<Types::AttributesLayout> &layout)
+    {
+        // All rows of the same result have the same attribute names
+        if (layout)
+            return instance.newFromBuilder(std::move(row), *layout);
+
+        const auto rowSize = row.size();
+
+        auto model = instance.newFromBuilder(std::move(row));
+
+        /* The duplicate attribute names were removed, so the attribute positions
+           of the model aren't the same as the row positions, it isn't shared. */
+        if (model.getAttributes().size() == rowSize)
+            layout = model.shareAttributesLayout();
+
+        return model;
+    }
+
+    template<typename Model>
+    int Builder<Model>::joinLoadKeyIndex(const QStringList &fieldNames,
+                                         const int firstMarker) const
+    {
+        const auto keyIndex = static_cast<int>(fieldNames.indexOf(m_model.getKeyName()));
+
+        // The model's columns end before the first marker column
+        if (keyIndex >= 0 && keyIndex < firstMarker) T_LIKELY
+            return keyIndex;
+
+        throw Orm::Exceptions::LogicError(
+                    QStringLiteral("The '%1' primary key must be selected to load "
+                                   "the has-one relations using the join, more "
+                                   "related rows can match one '%2' model in %3().")
+                    .arg(m_model.getKeyName(), TypeUtils::classPureBasename<Model>(),
+                         __tiny_func__));
+    }
+
     template<typename Model>
     Model &Builder<Model>::getModel() noexcept
     {
@@ -1247,6 +1726,156 @@ namespace Orm::Tiny
         return m_model.getKeyName();
     }
 
+    template<typename Model>
+    ModelsCollection<Model>
+    Builder<Model>::getModelsWithJoinLoads(const QList<Column> &columns)
+    {
+        /* The left joins are added to the copy of the query so this builder instance
+           can be executed more times. */
+        auto query = m_query->clone();
+
+        /* Qualify the asterisk by the model's table, the joined tables can contain
+           the same column names (eg. id) which would overwrite model's attributes. */
+        auto selectColumns = query.getColumns().isEmpty() ? columns : query.getColumns();
+
+        for (auto &column : selectColumns)
+            if (std::holds_alternative<QString>(column) &&
+                std::get<QString>(column) == ASTERISK
+            )
+                column = m_model.qualifyColumn(ASTERISK);
+
+        query.setColumns(std::move(selectColumns));
+
+        QList<JoinLoadItem<Model>> joinLoads;
+        joinLoads.reserve(m_joinLoad.size());
+
+        /* Get the relation instance for the given relation name, have to be done
+           through the visitor pattern which obtains also the Related type.
+           After the visitation the joinLoadRelationVisited() will be called. */
+        for (const auto &relation : std::as_const(m_joinLoad))
+            m_model.joinLoadRelationWithVisitor(relation, *this, query, joinLoads);
+
+        /* The limit or offset would count the joined rows instead of the parent models,
+           the relations are loaded using the separate queries instead. */
+        if (!canUseJoinLoads(joinLoads))
+            return getModelsWithEagerJoinLoads(columns);
+
+        /* The joined tables can contain the same column names, the user's unqualified
+           columns belong to the model's table. */
+        qualifyColumnsForJoinLoads(query);
+
+        // The remembered query is hydrated from the query result cache
+        if (query.isRemembering())
+            return hydrate(*query.getRemembered(), joinLoads);
+
+        return hydrate(query.get(), joinLoads);
+    }
+
+    template<typename Model>
+    bool Builder<Model>::canUseJoinLoads(
+            const QList<JoinLoadItem<Model>> &joinLoads) const
+    {
+        // Every parent row is joined with at most one related row
+        if (std::ranges::none_of(joinLoads, &JoinLoadItem<Model>::matchesMany))
+            return true;
+
+        /* The has-one relation can match more related rows, only the first row
+           of every parent model is hydrated. The first joined row always belongs
+           to the first parent model so the limit of one row (first()) is fine. */
+        const auto limit = m_query->getLimit();
+
+        return (limit < 0 || limit == 1) && m_query->getOffset() < 0 &&
+               !m_query->getGroupLimit();
+    }
+
+    template<typename Model>
+    ModelsCollection<Model>
+    Builder<Model>::getModelsWithEagerJoinLoads(const QList<Column> &columns)
+    {
+        // The remembered query is hydrated from the query result cache
+        auto models = m_query->isRemembering()
+                      ? hydrate(*m_query->getRemembered(columns))
+                      : hydrate(m_query->get(columns));
+
+        // The same as the with(), nothing to load for the empty result
+        if (!models.isEmpty())
+            for (const auto &relation : std::as_const(m_joinLoad))
+                m_model.eagerLoadRelationWithVisitor({relation}, *this, models);
+
+        return models;
+    }
+
+    template<typename Model>
+    void Builder<Model>::qualifyColumnsForJoinLoads(QueryBuilder &query) const
+    {
+        for (auto &column : query.m_columns)
+            qualifyColumnForJoinLoads(column);
+
+        qualifyWheresForJoinLoads(query.m_wheres);
+
+        for (auto &column : query.m_groups)
+            qualifyColumnForJoinLoads(column);
+
+        for (auto &order : query.m_orders)
+            qualifyColumnForJoinLoads(order.column);
+    }
+
+    template<typename Model>
+    void Builder<Model>::qualifyWheresForJoinLoads(
+            QList<WhereConditionItem> &wheres) const
+    {
+        for (auto &where : wheres)
+            switch (where.type) {
+            case WhereType::NESTED:
+                /* The nested query is shared with the original query, it's cloned
+                   so this builder instance stays unchanged. */
+                where.nestedQuery = std::make_shared<QueryBuilder>(
+                                        where.nestedQuery->clone());
+
+                qualifyWheresForJoinLoads(where.nestedQuery->m_wheres);
+                break;
+
+            // The raw SQL and the sub-queries are in the user's hands
+            case WhereType::RAW:
+            case WhereType::EXISTS:
+            case WhereType::NOT_EXISTS:
+                break;
+
+            case WhereType::COLUMN:
+                qualifyColumnForJoinLoads(where.column);
+                qualifyColumnForJoinLoads(where.columnTwo);
+                break;
+
+            case WhereType::ROW_VALUES:
+                for (auto &column : where.columns)
+                    qualifyColumnForJoinLoads(column);
+                break;
+
+            case WhereType::BETWEEN_COLUMNS:
+                qualifyColumnForJoinLoads(where.column);
+                qualifyColumnForJoinLoads(where.betweenColumns.min);
+                qualifyColumnForJoinLoads(where.betweenColumns.max);
+                break;
+
+            default:
+                qualifyColumnForJoinLoads(where.column);
+                break;
+            }
+    }
+
+    template<typename Model>
+    void Builder<Model>::qualifyColumnForJoinLoads(Column &column) const
+    {
+        // Expressions and already qualified columns are left as they are
+        if (!std::holds_alternative<QString>(column))
+            return;
+
+        auto &columnName = std::get<QString>(column);
+
+        if (!columnName.isEmpty() && !columnName.contains(DOT))
+            columnName = m_model.qualifyColumn(columnName);
+    }
+
     template<typename Model>
     QList<WithItem>
     Builder<Model>::parseWithRelations(const QList<WithItem> &relations)
@@ -1478,6 +2107,30 @@ namespace Orm::Tiny
         return values;
     }
 
+    template<typename Model>
+    QList<QVariantMap>
+    Builder<Model>::addUpdatedAtToUpdateManyValues(
+            const QList<QVariantMap> &values) const
+    {
+        const auto &updatedAtColumn = m_model.getUpdatedAtColumn();
+
+        // Nothing to do (model doesn't use timestamps)
+        if (!m_model.usesTimestamps() || updatedAtColumn.isEmpty())
+            return values;
+
+        /* Don't use the qualified column here, the PostgreSQL doesn't allow it
+           in the set clause and it's compiled the same way as other columns. */
+        const auto timestamp = m_model.freshTimestampString();
+        auto valuesCopy = values;
+
+        // All rows must have the same columns, so add it to every row that's missing it
+        for (auto &row : valuesCopy)
+            if (!row.contains(updatedAtColumn))
+                row.insert(updatedAtColumn, timestamp);
+
+        return valuesCopy;
+    }
+
     template<typename Model>
     QList<QVariantMap>
     Builder<Model>::addTimestampsToUpsertValues(const QList<QVariantMap> &values) const
@@ -1565,6 +2218,41 @@ namespace Orm::Tiny
         this->orderBy(m_model.getQualifiedKeyName(), ASC);
     }
 
+    template<typename Model>
+    void Builder<Model>::evictFromIdentityMap() const
+    {
+        // Nothing is remembered outside of the identity map scope
+        if (!IdentityMap::isEnabled())
+            return;
+
+        const auto &connection = m_query->getConnection().getName();
+        const auto &table = m_model.getTable();
+        const auto &wheres = m_query->getWheres();
+
+        /* Forget only the affected models if the query is constrained by the primary
+           key only (eg. the Model::save() or remove()), otherwise the whole table. */
+        if (wheres.size() == 1) {
+            const auto &where = wheres.constFirst();
+            const auto *const column = std::get_if<QString>(&where.column);
+
+            const auto isKey = column != nullptr &&
+                               (*column == m_model.getKeyName() ||
+                                *column == m_model.getQualifiedKeyName());
+
+            if (isKey && where.type == WhereType::BASIC && where.comparison == EQ) {
+                IdentityMap::evict(connection, table, {where.value});
+                return;
+            }
+
+            if (isKey && where.type == WhereType::IN_) {
+                IdentityMap::evict(connection, table, where.values);
+                return;
+            }
+        }
+
+        IdentityMap::evictTable(connection, table);
+    }
+
     // FEATURE scopes, anyway std::apply() do the same, will have to investigate it silverqx
 //    template<typename Model>
 //    template<typename ...Args>
@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include "orm/ormconcepts.hpp"
+#include "orm/tiny/support/identitymap.hpp"
 #include "orm/tiny/utils/attribute.hpp"
 #include "orm/types/sqlquery.hpp"
 
@@ -188,6 +189,17 @@ namespace Tiny
         /*! Force the query to only return distinct results. */
         TinyBuilder<Model> &distinct(QStringList &&columns);
 
+        /* Common table expressions */
+        /*! Add a common table expression to the query (the with clause). */
+        template<SubQuery T>
+        TinyBuilder<Model> &withExpression(const QString &name, T &&query,
+                                           const QStringList &columns = {},
+                                           bool recursive = false);
+        /*! Add a recursive common table expression to the query. */
+        template<SubQuery T>
+        TinyBuilder<Model> &withRecursiveExpression(const QString &name, T &&query,
+                                                    const QStringList &columns = {});
+
         /* Joins */
         /*! Add a join clause to the query. */
         template<JoinTable T>
@@ -657,6 +669,24 @@ namespace Tiny
                        const QString &column = Orm::Constants::ID,
                        bool prependOrder = false);
 
+        /* Unions */
+        /*! Add a union statement to the query. */
+        template<QueryableShared T>
+        TinyBuilder<Model> &union_(T &&query, bool all = false);
+        /*! Add a union all statement to the query. */
+        template<QueryableShared T>
+        TinyBuilder<Model> &unionAll(T &&query);
+
+        /* Index and optimizer hints */
+        /*! Add an index hint to suggest a query index. */
+        TinyBuilder<Model> &useIndex(const QString &index);
+        /*! Add an index hint to force a query index. */
+        TinyBuilder<Model> &forceIndex(const QString &index);
+        /*! Add an index hint to ignore a query index. */
+        TinyBuilder<Model> &ignoreIndex(const QString &index);
+        /*! Add an optimizer hint to the query (eg. MAX_EXECUTION_TIME(1000)). */
+        TinyBuilder<Model> &optimizerHint(const QString &hint);
+
         /* Pessimistic Locking */
         /*! Lock the selected rows in the table for updating. */
         TinyBuilder<Model> &lockForUpdate();
@@ -671,6 +701,13 @@ namespace Tiny
         /*! Lock the selected rows in the table. */
         TinyBuilder<Model> &lock(QString &&value);
 
+        /* Query result cache */
+        /*! Cache the results of the query for the given time. */
+        TinyBuilder<Model> &remember(std::chrono::seconds ttl,
+                                     const QStringList &tags = {});
+        /*! Cache the results of the query until any of the tagged tables is written. */
+        TinyBuilder<Model> &rememberForever(const QStringList &tags = {});
+
         /* Others proxy methods, not added to the Model and Relation */
         /*! Add an "exists" clause to the query. */
         TinyBuilder<Model> &
@@ -833,6 +870,8 @@ namespace Tiny
     BuilderProxies<Model>::increment(
             const QString &column, const T amount, const QList<UpdateItem> &extra)
     {
+        builder().evictFromIdentityMap();
+
         return toBase().increment(column, amount, builder().addUpdatedAtColumn(extra));
     }
 
@@ -842,6 +881,8 @@ namespace Tiny
     BuilderProxies<Model>::decrement(
             const QString &column, const T amount, const QList<UpdateItem> &extra)
     {
+        builder().evictFromIdentityMap();
+
         return toBase().decrement(column, amount, builder().addUpdatedAtColumn(extra));
     }
 
@@ -907,6 +948,8 @@ namespace Tiny
     template<typename Model>
     std::tuple<int, TSqlQuery> BuilderProxies<Model>::forceDelete() const
     {
+        builder().evictFromIdentityMap();
+
         // Skip applying SoftDeletes (getQuery()) to actually delete
         return getQuery().remove();
     }
@@ -914,6 +957,8 @@ namespace Tiny
     template<typename Model>
     std::tuple<int, TSqlQuery> BuilderProxies<Model>::forceRemove() const
     {
+        builder().evictFromIdentityMap();
+
         // Skip applying SoftDeletes (getQuery()) to actually delete
         return getQuery().remove();
     }
@@ -921,6 +966,10 @@ namespace Tiny
     template<typename Model>
     void BuilderProxies<Model>::truncate() const
     {
+        // The truncate ignores the where clauses
+        Support::IdentityMap::evictTable(getQuery().getConnection().getName(),
+                                         builder().m_model.getTable());
+
         getQuery().truncate();
     }
 
@@ -1049,6 +1098,29 @@ namespace Tiny
         return builder();
     }
 
+    /* Common table expressions */
+
+    template<typename Model>
+    template<SubQuery T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::withExpression(
+            const QString &name, T &&query, const QStringList &columns,
+            const bool recursive)
+    {
+        getQuery().withExpression(name, std::forward<T>(query), columns, recursive);
+        return builder();
+    }
+
+    template<typename Model>
+    template<SubQuery T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::withRecursiveExpression(
+            const QString &name, T &&query, const QStringList &columns)
+    {
+        getQuery().withRecursiveExpression(name, std::forward<T>(query), columns);
+        return builder();
+    }
+
     /* Joins */
 
     template<typename Model>
@@ -2200,6 +2272,56 @@ namespace Tiny
         return builder();
     }
 
+    /* Unions */
+
+    template<typename Model>
+    template<QueryableShared T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::union_(T &&query, const bool all)
+    {
+        getQuery().union_(std::forward<T>(query), all);
+        return builder();
+    }
+
+    template<typename Model>
+    template<QueryableShared T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::unionAll(T &&query)
+    {
+        getQuery().unionAll(std::forward<T>(query));
+        return builder();
+    }
+
+    /* Index and optimizer hints */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::useIndex(const QString &index)
+    {
+        getQuery().useIndex(index);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::forceIndex(const QString &index)
+    {
+        getQuery().forceIndex(index);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::ignoreIndex(const QString &index)
+    {
+        getQuery().ignoreIndex(index);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::optimizerHint(const QString &hint)
+    {
+        getQuery().optimizerHint(hint);
+        return builder();
+    }
+
     /* Pessimistic Locking */
 
     template<typename Model>
@@ -2244,6 +2366,25 @@ namespace Tiny
         return builder();
     }
 
+    /* Query result cache */
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::remember(const std::chrono::seconds ttl,
+                                    const QStringList &tags)
+    {
+        getQuery().remember(ttl, tags);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::rememberForever(const QStringList &tags)
+    {
+        getQuery().rememberForever(tags);
+        return builder();
+    }
+
     /* Others proxy methods, not added to the Model and Relation */
 
     template<typename Model>
@@ -9,9 +9,9 @@ TINY_SYSTEM_HEADER
 
 #include "orm/config.hpp" // IWYU pragma: keep
 
-#ifdef TINY_NO_INCOMPLETE_UNORDERED_MAP
-#  include <map>
-#else
+#include <map>
+
+#ifndef TINY_NO_INCOMPLETE_UNORDERED_MAP
 #  include <unordered_map>
 #endif
 
@@ -96,6 +96,54 @@ namespace Types
     [[maybe_unused]]
     TINYORM_EXPORT bool operator==(const WithItem &left, const WithItem &right);
 
+    /*! Join load relation item (relation loaded using the left join). */
+    template<typename Model>
+    struct JoinLoadItem
+    {
+        /*! Alias of the marker column after which the related columns follow. */
+        QString marker;
+        /*! Create the related model from the given attributes and set it on a model. */
+        std::function<void(Model &model, QList<AttributeItem> &&attributes)> hydrate;
+        /*! Indicates whether more related rows can be joined to one parent row. */
+        bool matchesMany = false;
+    };
+
+    /*! The owners' counter cache updates collected during the batch write (every
+        owner's counter is updated only once after the write). */
+    struct TINYORM_EXPORT CounterCacheUpdates
+    {
+        /*! Update the counter cache column of the owner with the given key. */
+        using UpdateCallback = std::function<void(qint64 amount,
+                                                  const QVariant &ownerKey)>;
+
+        /*! The summed amount of one owner. */
+        struct Owner
+        {
+            /*! The owner's key. */
+            QVariant key;
+            /*! The amount to add to the owner's counter. */
+            qint64 amount = 0;
+        };
+
+        /*! The counter cache updates of one belongs-to relation. */
+        struct Relation
+        {
+            /*! Update the owner's counter (references the relation instance). */
+            UpdateCallback update = nullptr;
+            /*! The summed amounts of the owners (by the owner key). */
+            std::map<QString, Owner> owners;
+
+            /*! Add the given amount to the counter of the owner with the given key. */
+            void add(const QVariant &ownerKey, qint64 amount);
+        };
+
+        /*! The counter cache updates (by the relation name). */
+        std::map<QString, Relation> relations;
+
+        /*! Update the counters of all the owners, one update for every owner. */
+        void apply() const;
+    };
+
     /*! Tag for Model::getRelation() family methods to return Related type
         directly ( not container type ). */
     struct One {};
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef ORM_TINY_TYPEDCOLUMNS_HPP
+#define ORM_TINY_TYPEDCOLUMNS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <tuple>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+    /*! Column name known at compile-time (used as the non-type template parameter). */
+    template<std::size_t N>
+    struct ColumnName
+    {
+        /*! Converting constructor from the string literal. */
+        consteval ColumnName(const char (&name)[N]) // NOLINT(google-explicit-constructor, cppcoreguidelines-avoid-c-arrays)
+        {
+            std::ranges::copy(name, value);
+        }
+
+        /*! Get the column name as the std::string_view (without the terminating null). */
+        constexpr std::string_view view() const noexcept
+        {
+            return {value, N - 1};
+        }
+
+        /*! Get the column name as the QString. */
+        QString toString() const
+        {
+            return QString::fromUtf8(value, static_cast<qsizetype>(N - 1));
+        }
+
+        /*! The column name (including the terminating null). */
+        char value[N] {}; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    };
+
+    /*! Column declared at compile-time with its C++ type. */
+    template<ColumnName Name, typename T>
+    struct TypedColumn
+    {
+        /*! The C++ type of the column. */
+        using type = T;
+
+        /*! The column name. */
+        constexpr static auto name = Name;
+    };
+
+    /*! The list of columns declared at compile-time (Derived::Columns type alias). */
+    template<typename ...Columns>
+    struct TypedColumns
+    {
+        /*! Number of declared columns. */
+        constexpr static std::size_t size = sizeof...(Columns);
+
+        /*! Get the index of the given column (size if the column isn't declared),
+            it's also the index of the column's typed slot. */
+        template<ColumnName Name>
+        consteval static std::size_t indexOf()
+        {
+            constexpr std::array<std::string_view, size> names {Columns::name.view()...};
+
+            return static_cast<std::size_t>(
+                        std::ranges::distance(names.cbegin(),
+                                              std::ranges::find(names, Name.view())));
+        }
+
+        /*! Determine whether the given column is declared. */
+        template<ColumnName Name>
+        constexpr static bool contains = indexOf<Name>() < size;
+
+        /*! The C++ type of the given column. */
+        template<ColumnName Name>
+        using TypeOf = std::tuple_element_t<indexOf<Name>(),
+                                            std::tuple<typename Columns::type...>>;
+
+        /*! The typed slots, one slot for every declared column (addressed by index). */
+        using Slots = std::tuple<std::optional<typename Columns::type>...>;
+    };
+
+    /*! Typed attribute slots of one model instance, they hold the values of
+        the declared columns converted to their C++ types (allocated on first use). */
+    class TypedAttributeSlots
+    {
+        /*! Type-erased slots storage (the type is known to the Model only). */
+        struct StorageBase
+        {
+            /*! Virtual destructor. */
+            virtual ~StorageBase() = default;
+
+            /*! Clone the slots storage. */
+            virtual std::unique_ptr<StorageBase> clone() const = 0;
+            /*! Clear all slots. */
+            virtual void clear() noexcept = 0;
+        };
+
+        /*! Slots storage for the given TypedColumns<>::Slots type. */
+        template<typename Slots>
+        struct Storage final : StorageBase
+        {
+            /*! Clone the slots storage. */
+            std::unique_ptr<StorageBase> clone() const final
+            {
+                return std::make_unique<Storage>(*this);
+            }
+
+            /*! Clear all slots. */
+            void clear() noexcept final
+            {
+                std::apply([](auto &...slot) { (slot.reset(), ...); }, slots);
+            }
+
+            /*! The typed slots. */
+            Slots slots;
+        };
+
+    public:
+        /*! Default constructor. */
+        TypedAttributeSlots() = default;
+        /*! Default destructor. */
+        ~TypedAttributeSlots() = default;
+
+        /*! Copy constructor. */
+        TypedAttributeSlots(const TypedAttributeSlots &other)
+            : m_storage(other.m_storage ? other.m_storage->clone() : nullptr)
+        {}
+        /*! Copy assignment operator. */
+        TypedAttributeSlots &operator=(const TypedAttributeSlots &other)
+        {
+            if (this != &other)
+                m_storage = other.m_storage ? other.m_storage->clone() : nullptr;
+
+            return *this;
+        }
+
+        /*! Move constructor. */
+        TypedAttributeSlots(TypedAttributeSlots &&) noexcept = default;
+        /*! Move assignment operator. */
+        TypedAttributeSlots &operator=(TypedAttributeSlots &&) noexcept = default;
+
+        /*! Get the typed slots (the Slots type must be the same for every call). */
+        template<typename Slots>
+        Slots &get()
+        {
+            if (!m_storage)
+                m_storage = std::make_unique<Storage<Slots>>();
+
+            return static_cast<Storage<Slots> &>(*m_storage).slots;
+        }
+
+        /*! Clear all slots, they are filled again on the next typed access. */
+        void clear() noexcept
+        {
+            if (m_storage)
+                m_storage->clear();
+        }
+
+    private:
+        /*! The slots storage (nullptr if the typed access was never used). */
+        std::unique_ptr<StorageBase> m_storage = nullptr;
+    };
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPEDCOLUMNS_HPP
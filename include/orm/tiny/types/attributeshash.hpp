@@ -0,0 +1,41 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
+#define ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <unordered_map>
+
+#include "orm/tiny/types/copyonwrite.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Implicitly shared (copy-on-write) hash of the model's attribute positions.
+        Copies of the same model (eg. one BelongsTo parent set on many children) share
+        one hash until any of them modifies its attributes. */
+    class AttributesHash : public CopyOnWrite<std::unordered_map<QString, qsizetype>>
+    {
+        /*! Alias for the base class. */
+        using Base = CopyOnWrite<std::unordered_map<QString, qsizetype>>;
+
+    public:
+        /*! Attribute position type (the same as the QList<AttributeItem>::size_type). */
+        using SizeType = qsizetype;
+        /*! The underlying hash type. */
+        using HashType = Base::ValueType;
+
+        /*! Inherit constructors. */
+        using Base::Base;
+    };
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
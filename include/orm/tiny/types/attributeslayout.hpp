@@ -0,0 +1,51 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
+#define ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "orm/tiny/tinytypes.hpp"
+#include "orm/tiny/types/attributeshash.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Resolved casts of the model's attributes (indexed by the attribute position). */
+    struct CastPlan
+    {
+        /*! Resolved cast of one attribute. */
+        struct Item
+        {
+            /*! The attribute's cast (std::nullopt if the attribute isn't casted). */
+            std::optional<CastItem> castItem = std::nullopt;
+            /*! Determine whether the attribute is in the model's date columns. */
+            bool isDatesColumn = false;
+        };
+
+        /*! Version of the model's casts and dates the plan was resolved for. */
+        quint64 castsVersion = 0;
+        /*! Resolved casts of all the attributes (indexed by the attribute position). */
+        std::vector<Item> items;
+    };
+
+    /*! Attributes layout shared by all the models hydrated from the same result. */
+    struct AttributesLayout
+    {
+        /*! The attribute positions hash. */
+        AttributesHash attributesHash;
+        /*! The resolved casts of the attributes. */
+        std::shared_ptr<const CastPlan> castPlan = nullptr;
+    };
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
@@ -0,0 +1,176 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_COPYONWRITE_HPP
+#define ORM_TINY_TYPES_COPYONWRITE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <memory>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Implicitly shared (copy-on-write) value of the model's data member.
+        Copies of the same model (eg. one BelongsTo parent set on many children) share
+        one value until any of them modifies it. */
+    template<typename T>
+    class CopyOnWrite
+    {
+    public:
+        /*! The underlying value type. */
+        using ValueType = T;
+
+        /*! Default constructor (empty value, nothing is allocated). */
+        CopyOnWrite() = default;
+        /*! Converting constructor from the value (copies the value). */
+        explicit CopyOnWrite(const T &value);
+        /*! Converting constructor from the value (moves the value). */
+        explicit CopyOnWrite(T &&value);
+        /*! Default destructor. */
+        ~CopyOnWrite() = default;
+
+        /* The moved-from instance is empty, it's the same as for the std containers,
+           so the move operations don't have to be user-defined. */
+        /*! Copy constructor (shallow copy, deep copy of the unsharable value). */
+        CopyOnWrite(const CopyOnWrite &other);
+        /*! Copy assignment operator (shallow copy, deep copy of the unsharable
+            value). */
+        CopyOnWrite &operator=(const CopyOnWrite &other);
+
+        /*! Move constructor. */
+        CopyOnWrite(CopyOnWrite &&) noexcept = default;
+        /*! Move assignment operator. */
+        CopyOnWrite &operator=(CopyOnWrite &&) noexcept = default;
+
+        /*! Get the value for reading (doesn't detach). */
+        inline const T &get() const noexcept;
+        /*! Get the value for modifying, makes a private copy if the value is shared. */
+        T &detach();
+        /*! Get the value for modifying and mark it unsharable, the references into
+            the value stay valid as copies of the model get their own value. */
+        T &detachUnsharable();
+        /*! Clear the value and get it for modifying (doesn't copy a shared value). */
+        T &clear();
+
+        /*! Determine whether the value is shared with another model instance. */
+        inline bool isShared() const noexcept;
+
+        /*! Equality comparison operator for the CopyOnWrite. */
+        inline bool operator==(const CopyOnWrite &other) const;
+
+    private:
+        /*! Get the empty value (used when nothing was allocated yet). */
+        inline static const T &emptyValue() noexcept;
+
+        /*! The shared value (nullptr means empty). */
+        std::shared_ptr<T> m_value = nullptr;
+        /*! Determine whether the value can be shared with the copies (false after
+            the references into the value were obtained). */
+        bool m_sharable = true;
+    };
+
+    /* public */
+
+    template<typename T>
+    CopyOnWrite<T>::CopyOnWrite(const T &value)
+        : m_value(std::make_shared<T>(value))
+    {}
+
+    template<typename T>
+    CopyOnWrite<T>::CopyOnWrite(T &&value)
+        : m_value(std::make_shared<T>(std::move(value)))
+    {}
+
+    template<typename T>
+    CopyOnWrite<T>::CopyOnWrite(const CopyOnWrite &other)
+        : m_value(other.m_sharable || !other.m_value
+                  ? other.m_value : std::make_shared<T>(*other.m_value))
+    {}
+
+    template<typename T>
+    CopyOnWrite<T> &CopyOnWrite<T>::operator=(const CopyOnWrite &other)
+    {
+        if (this == &other)
+            return *this;
+
+        m_value = other.m_sharable || !other.m_value
+                  ? other.m_value : std::make_shared<T>(*other.m_value);
+        m_sharable = true;
+
+        return *this;
+    }
+
+    template<typename T>
+    const T &CopyOnWrite<T>::get() const noexcept
+    {
+        return m_value ? *m_value : emptyValue();
+    }
+
+    template<typename T>
+    T &CopyOnWrite<T>::detach()
+    {
+        if (!m_value)
+            m_value = std::make_shared<T>();
+
+        else if (m_value.use_count() > 1)
+            m_value = std::make_shared<T>(*m_value);
+
+        return *m_value;
+    }
+
+    template<typename T>
+    T &CopyOnWrite<T>::detachUnsharable()
+    {
+        auto &value = detach();
+
+        m_sharable = false;
+
+        return value;
+    }
+
+    template<typename T>
+    T &CopyOnWrite<T>::clear()
+    {
+        // Reuse the allocated memory if not shared
+        if (m_value && m_value.use_count() == 1)
+            m_value->clear();
+        else
+            m_value = std::make_shared<T>();
+
+        // Nothing references into the cleared value
+        m_sharable = true;
+
+        return *m_value;
+    }
+
+    template<typename T>
+    bool CopyOnWrite<T>::isShared() const noexcept
+    {
+        return m_value && m_value.use_count() > 1;
+    }
+
+    template<typename T>
+    bool CopyOnWrite<T>::operator==(const CopyOnWrite &other) const
+    {
+        return m_value == other.m_value || get() == other.get();
+    }
+
+    /* private */
+
+    template<typename T>
+    const T &CopyOnWrite<T>::emptyValue() noexcept
+    {
+        static const T cached;
+
+        return cached;
+    }
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_COPYONWRITE_HPP
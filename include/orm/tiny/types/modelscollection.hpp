@@ -19,6 +19,8 @@ TINY_SYSTEM_HEADER
 
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/tiny/utils/attribute.hpp"
+#include "orm/tiny/utils/cbor.hpp"
+#include "orm/tiny/utils/json.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -74,6 +76,10 @@ namespace Types
     {
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
+        /*! Alias for the CBOR utils. */
+        using CborUtils = Orm::Tiny::Utils::Cbor;
+        /*! Alias for the JSON utils. */
+        using JsonUtils = Orm::Tiny::Utils::Json;
 
     public:
         /*! Inherit constructors. */
@@ -407,6 +413,25 @@ namespace Types
         /*! Load a set of relationships onto the collection. */
         inline ModelsCollection &load(QList<QString> &&relations) &&;
 
+        /* Collection - Persistence related */
+        /*! Save all the models, models with the same dirty attributes are saved
+            using one statement. */
+        template<typename = void>
+        bool saveAll(SaveOptions options = {});
+
+        /*! Delete all the models, one delete statement for every chunk of the keys
+            (performs the soft delete if the model extends SoftDeletes). */
+        template<typename = void>
+        std::size_t deleteAll();
+        /*! Force a hard delete on all the soft deletable models. */
+        template<typename = void>
+        std::size_t forceDeleteAll()
+        requires (ModelRawType::extendsSoftDeletes());
+        /*! Restore all the soft-deleted models. */
+        template<typename = void>
+        bool restoreAll()
+        requires (ModelRawType::extendsSoftDeletes());
+
         /* EnumeratesValues */
         /*! Get the vector of models as a attributes vector with serialized models. */
         template<typename PivotType = void> // PivotType is primarily internal
@@ -434,6 +459,20 @@ namespace Types
         template<typename PivotType = void> // PivotType is primarily internal
         inline QByteArray
         toJson(QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write a collection as JSON to the given device. */
+        template<typename PivotType = void> // PivotType is primarily internal
+        inline bool
+        toJson(QIODevice &device,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+
+        /*! Convert a collection to CBOR (models with their loaded relations). */
+        QByteArray toCbor() const;
+        /*! Write a collection to the CBOR stream. */
+        void toCbor(QCborStreamWriter &writer) const;
+        /*! Restore a collection from CBOR created by the toCbor(). */
+        static ModelsCollection<ModelRawType> fromCbor(const QByteArray &cbor);
+        /*! Read a collection from the CBOR stream. */
+        static ModelsCollection<ModelRawType> fromCbor(QCborStreamReader &reader);
 
         /*! Create a collection of all models that do not pass a given truth test. */
         ModelsCollection<ModelRawType *>
@@ -1765,6 +1804,38 @@ namespace Types
         return load(WithItem::fromStringVector(std::move(relations)));
     }
 
+    /* Collection - Persistence related */
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    bool ModelsCollection<Model>::saveAll(const SaveOptions options)
+    {
+        return ModelRawType::saveMany(toPointersCollection(), options);
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    std::size_t ModelsCollection<Model>::deleteAll()
+    {
+        return ModelRawType::removeMany(toPointersCollection());
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    std::size_t ModelsCollection<Model>::forceDeleteAll()
+    requires (ModelRawType::extendsSoftDeletes())
+    {
+        return ModelRawType::forceDeleteMany(toPointersCollection());
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    bool ModelsCollection<Model>::restoreAll()
+    requires (ModelRawType::extendsSoftDeletes())
+    {
+        return ModelRawType::restoreMany(toPointersCollection());
+    }
+
     /* EnumeratesValues */
 
     template<DerivedCollectionModel Model>
@@ -1833,7 +1904,70 @@ namespace Types
     QByteArray
     ModelsCollection<Model>::toJson(const QJsonDocument::JsonFormat format) const
     {
-        return toJsonDocument<PivotType>().toJson(format);
+        // Write the JSON directly, no QJsonArray/QJsonDocument copies are needed
+        return JsonUtils::toJson(toMapVariantList<PivotType>(), format);
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename PivotType>
+    bool
+    ModelsCollection<Model>::toJson(
+            QIODevice &device, const QJsonDocument::JsonFormat format) const
+    {
+        return JsonUtils::toJson(device, toMapVariantList<PivotType>(), format);
+    }
+
+    template<DerivedCollectionModel Model>
+    QByteArray ModelsCollection<Model>::toCbor() const
+    {
+        QByteArray cbor;
+        QCborStreamWriter writer(&cbor);
+
+        toCbor(writer);
+
+        return cbor;
+    }
+
+    template<DerivedCollectionModel Model>
+    void ModelsCollection<Model>::toCbor(QCborStreamWriter &writer) const
+    {
+        writer.startArray(static_cast<quint64>(this->size()));
+
+        for (ConstModelLoopType model : *this)
+            // Don't handle the nullptr
+            toPointer(model)->toCbor(writer);
+
+        writer.endArray();
+    }
+
+    template<DerivedCollectionModel Model>
+    ModelsCollection<typename ModelsCollection<Model>::ModelRawType>
+    ModelsCollection<Model>::fromCbor(const QByteArray &cbor)
+    {
+        QCborStreamReader reader(cbor);
+
+        return fromCbor(reader);
+    }
+
+    template<DerivedCollectionModel Model>
+    ModelsCollection<typename ModelsCollection<Model>::ModelRawType>
+    ModelsCollection<Model>::fromCbor(QCborStreamReader &reader)
+    {
+        ModelsCollection<ModelRawType> models;
+
+        CborUtils::throwIfInvalid(reader, reader.isArray(), __tiny_func__);
+
+        if (reader.isLengthKnown())
+            models.reserve(static_cast<size_type>(reader.length()));
+
+        reader.enterContainer();
+
+        while (reader.hasNext())
+            models << ModelRawType::fromCbor(reader);
+
+        CborUtils::leaveContainer(reader);
+
+        return models;
     }
 
     template<DerivedCollectionModel Model>
@@ -0,0 +1,393 @@
+#pragma once
+#ifndef ORM_TINY_UNITOFWORK_HPP
+#define ORM_TINY_UNITOFWORK_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <functional>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "orm/databaseconnection.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/macros/likely.hpp"
+#include "orm/tiny/tinyconcepts.hpp"
+#include "orm/tiny/types/modelscollection.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+    /*! Statistics of the UnitOfWork::flush(). */
+    struct UnitOfWorkStatistics
+    {
+        /*! Number of the flushed models (one statement every model w/o the unit
+            of work). */
+        qsizetype models = 0;
+        /*! Number of the executed statements (w/o the transactional statements). */
+        qsizetype statements = 0;
+        /*! Indicates whether all the models were saved. */
+        bool saved = true;
+
+        /*! Get the number of the statements saved by batching. */
+        inline qsizetype statementsSaved() const noexcept;
+    };
+
+    /*! Opt-in unit of work, registers the new, dirty, and deleted models and writes
+        them at once in the flush(), inside one transaction and using the multi-row
+        statements for every model type (one instance for one connection and thread,
+        the registered models must outlive the flush()). */
+    class TINYORM_EXPORT UnitOfWork
+    {
+        Q_DISABLE_COPY_MOVE(UnitOfWork)
+
+    public:
+        /*! Constructor. */
+        explicit UnitOfWork(QString connection = "");
+        /*! Default destructor (unflushed models are discarded). */
+        ~UnitOfWork() = default;
+
+        /*! Register the new or dirty model to save. */
+        template<ModelConcept Model>
+        UnitOfWork &save(Model &model);
+        /*! Register the model to delete. */
+        template<ModelConcept Model>
+        UnitOfWork &remove(Model &model);
+        /*! Register the new or dirty model to save and associate it with the parent
+            model during the flush() (after the parent is saved). */
+        template<ModelConcept Model, typename Method, ModelConcept Related>
+        UnitOfWork &associate(Model &model, Method relation, Related &parent);
+
+        /*! Write all the registered models in one transaction (the models are
+            restored and stay registered if it fails). */
+        UnitOfWorkStatistics flush();
+        /*! Discard all the registered models. */
+        void clear() noexcept;
+
+        /*! Get the number of the registered models. */
+        qsizetype size() const noexcept;
+        /*! Determine whether no model is registered. */
+        inline bool isEmpty() const noexcept;
+
+        /*! Get the connection name of the unit of work. */
+        inline const QString &getConnectionName() const noexcept;
+
+    private:
+        /*! State of the model that is restored after the failed flush(). */
+        struct ModelState
+        {
+            /*! Indicates if the model exists. */
+            bool exists;
+            /*! The model's attributes. */
+            QList<AttributeItem> attributes;
+            /*! The model attribute's original state. */
+            QList<AttributeItem> original;
+            /*! The changed model attributes. */
+            QList<AttributeItem> changes;
+        };
+
+        /*! Registered models of one model type (type-erased). */
+        class ModelBatch
+        {
+            Q_DISABLE_COPY_MOVE(ModelBatch)
+
+        public:
+            /*! Default constructor. */
+            ModelBatch() = default;
+            /*! Virtual destructor. */
+            virtual ~ModelBatch() = default;
+
+            /*! Save the registered models (the multi-row insert and update). */
+            virtual bool flushSaves() = 0;
+            /*! Delete the registered models (one delete for every chunk of keys). */
+            virtual void flushRemoves() = 0;
+            /*! Get the number of the registered models. */
+            virtual qsizetype size() const noexcept = 0;
+
+            /*! Get the types of the owner models (they have to be saved first). */
+            virtual std::vector<std::type_index> ownerTypes() const = 0;
+
+            /*! Save the state of the registered models before the flush(). */
+            virtual void snapshot() = 0;
+            /*! Restore the state of the registered models after the failed flush(). */
+            virtual void restore() = 0;
+        };
+
+        /*! Registered models of the Model type. */
+        template<ModelConcept Model>
+        class ModelBatchFor final : public ModelBatch
+        {
+            Q_DISABLE_COPY_MOVE(ModelBatchFor)
+
+        public:
+            /*! Default constructor. */
+            ModelBatchFor() = default;
+            /*! Default destructor. */
+            ~ModelBatchFor() final = default;
+
+            /*! Save the registered models (the multi-row insert and update). */
+            bool flushSaves() final;
+            /*! Delete the registered models (one delete for every chunk of keys). */
+            void flushRemoves() final;
+            /*! Get the number of the registered models. */
+            qsizetype size() const noexcept final;
+
+            /*! Get the types of the owner models (they have to be saved first). */
+            std::vector<std::type_index> ownerTypes() const final;
+
+            /*! Save the state of the registered models before the flush(). */
+            void snapshot() final;
+            /*! Restore the state of the registered models after the failed flush(). */
+            void restore() final;
+
+            /*! Register the model, the last registration of the same model wins. */
+            void add(Model &model, bool remove);
+            /*! Register the association with the parent model of the given type. */
+            void addAssociation(std::function<void()> &&association,
+                                std::type_index parentType);
+
+        private:
+            /*! Get the registered models to save or delete in the registration order. */
+            ModelsCollection<Model *> registered(bool remove) const;
+
+            /*! Models in the order of their first registration. */
+            std::vector<Model *> m_models;
+            /*! Registered models, whether to delete the model (save otherwise). */
+            std::unordered_map<Model *, bool> m_removes;
+            /*! Associations with the parent models, invoked before the saves. */
+            std::vector<std::function<void()>> m_associations;
+            /*! Types of the associated parent models. */
+            std::vector<std::type_index> m_parentTypes;
+            /*! States of the models (in the m_models order) before the flush(). */
+            std::vector<ModelState> m_states;
+        };
+
+        /*! Get the batch for the given model type, create it if it doesn't exist. */
+        template<ModelConcept Model>
+        ModelBatchFor<Model> &batchFor(const Model &model);
+
+        /*! Restore the state of the model (the model's friend). */
+        template<ModelConcept Model>
+        static void restoreModel(Model &model, ModelState &&state);
+
+        /*! Get the database connection of the unit of work. */
+        DatabaseConnection &connection() const;
+        /*! Write all the batches, saves in the owners first order and deletes
+            in the reverse order. */
+        bool flushBatches();
+        /*! Get the batches sorted by the owner types, owners before their children
+            (in the registration order otherwise). */
+        std::vector<ModelBatch *> sortedBatches() const;
+
+        /*! The connection name (empty for the default connection). */
+        QString m_connection;
+        /*! Batches in the order of the first registration of the model type. */
+        std::vector<std::unique_ptr<ModelBatch>> m_batches;
+        /*! Batches keyed by the model type. */
+        std::unordered_map<std::type_index, ModelBatch *> m_batchesHash;
+    };
+
+    /* UnitOfWorkStatistics */
+
+    qsizetype UnitOfWorkStatistics::statementsSaved() const noexcept
+    {
+        return std::max<qsizetype>(0, models - statements);
+    }
+
+    /* UnitOfWork */
+
+    /* public */
+
+    template<ModelConcept Model>
+    UnitOfWork &UnitOfWork::save(Model &model)
+    {
+        batchFor(model).add(model, false);
+
+        return *this;
+    }
+
+    template<ModelConcept Model>
+    UnitOfWork &UnitOfWork::remove(Model &model)
+    {
+        batchFor(model).add(model, true);
+
+        return *this;
+    }
+
+    template<ModelConcept Model, typename Method, ModelConcept Related>
+    UnitOfWork &
+    UnitOfWork::associate(Model &model, Method relation, Related &parent)
+    {
+        auto &batch = batchFor(model);
+
+        batch.add(model, false);
+
+        batch.addAssociation([&model, relation, &parent]
+        {
+            // The parent's key is known only after the parent is saved
+            if (!parent.exists) T_UNLIKELY
+                throw Orm::Exceptions::LogicError(
+                        QStringLiteral(
+                            "The '%1' parent model must be saved before the '%2' "
+                            "model is associated with it in %3().")
+                        .arg(Orm::Utils::Type::classPureBasename<Related>(),
+                             Orm::Utils::Type::classPureBasename<Model>(),
+                             __tiny_func__));
+
+            std::invoke(relation, model)->associate(parent);
+        },
+            std::type_index(typeid (Related)));
+
+        return *this;
+    }
+
+    bool UnitOfWork::isEmpty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    const QString &UnitOfWork::getConnectionName() const noexcept
+    {
+        return m_connection;
+    }
+
+    /* private */
+
+    template<ModelConcept Model>
+    UnitOfWork::ModelBatchFor<Model> &UnitOfWork::batchFor(const Model &model)
+    {
+        // All models are written inside the transaction of the unit of work
+        if (const auto &connectionName = model.getConnection().getName();
+            connectionName != connection().getName()
+        ) T_UNLIKELY
+            throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' model's connection '%2' is different from "
+                                   "the unit of work connection '%3' in %4().")
+                    .arg(Orm::Utils::Type::classPureBasename<Model>(), connectionName,
+                         connection().getName(), __tiny_func__));
+
+        auto &batch = m_batchesHash[std::type_index(typeid (Model))];
+
+        if (batch == nullptr)
+            batch = m_batches.emplace_back(std::make_unique<ModelBatchFor<Model>>())
+                    .get();
+
+        return static_cast<ModelBatchFor<Model> &>(*batch);
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::restoreModel(Model &model, ModelState &&state)
+    {
+        model.exists = state.exists;
+
+        model.restoreAttributes(std::move(state.attributes), std::move(state.original),
+                                std::move(state.changes));
+    }
+
+    /* UnitOfWork::ModelBatchFor */
+
+    template<ModelConcept Model>
+    bool UnitOfWork::ModelBatchFor<Model>::flushSaves()
+    {
+        // The parents are already saved, so their keys are known
+        for (const auto &association : m_associations)
+            association();
+
+        const auto saves = registered(false);
+
+        return saves.isEmpty() || Model::saveMany(saves);
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::ModelBatchFor<Model>::flushRemoves()
+    {
+        if (const auto removes = registered(true); !removes.isEmpty())
+            Model::removeMany(removes);
+    }
+
+    template<ModelConcept Model>
+    qsizetype UnitOfWork::ModelBatchFor<Model>::size() const noexcept
+    {
+        return static_cast<qsizetype>(m_models.size());
+    }
+
+    template<ModelConcept Model>
+    std::vector<std::type_index> UnitOfWork::ModelBatchFor<Model>::ownerTypes() const
+    {
+        // The belongs-to relations are the same for all models of the Model type
+        auto ownerTypes = m_models.front()->getOwnerTypes();
+
+        ownerTypes.insert(ownerTypes.end(), m_parentTypes.cbegin(),
+                          m_parentTypes.cend());
+
+        return ownerTypes;
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::ModelBatchFor<Model>::snapshot()
+    {
+        m_states.clear();
+        m_states.reserve(m_models.size());
+
+        for (const auto *const model : m_models)
+            m_states.push_back({model->exists, model->getRawAttributes(),
+                                model->getRawOriginals(), model->getChanges()});
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::ModelBatchFor<Model>::restore()
+    {
+        for (std::size_t index = 0; index < m_states.size(); ++index)
+            restoreModel(*m_models[index], std::move(m_states[index]));
+
+        m_states.clear();
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::ModelBatchFor<Model>::add(Model &model, const bool remove)
+    {
+        // The saved model can be removed later and vice versa
+        if (const auto [itModel, inserted] = m_removes.try_emplace(&model, remove);
+            inserted
+        )
+            m_models.push_back(&model);
+        else
+            itModel->second = remove;
+    }
+
+    template<ModelConcept Model>
+    void UnitOfWork::ModelBatchFor<Model>::addAssociation(
+            std::function<void()> &&association, const std::type_index parentType)
+    {
+        m_associations.push_back(std::move(association));
+
+        m_parentTypes.push_back(parentType);
+    }
+
+    /* private */
+
+    template<ModelConcept Model>
+    ModelsCollection<Model *>
+    UnitOfWork::ModelBatchFor<Model>::registered(const bool remove) const
+    {
+        ModelsCollection<Model *> models;
+        models.reserve(static_cast<qsizetype>(m_models.size()));
+
+        for (auto *const model : m_models)
+            if (m_removes.at(model) == remove)
+                models << model;
+
+        return models;
+    }
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_UNITOFWORK_HPP
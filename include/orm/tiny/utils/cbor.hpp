@@ -0,0 +1,73 @@
+#pragma once
+#ifndef ORM_TINY_UTILS_CBOR_HPP
+#define ORM_TINY_UTILS_CBOR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+
+#include "orm/tiny/tinytypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Utils
+{
+
+    /*! Library class for the binary CBOR serialization of models, it preserves
+        the QVariant types (used by the toCbor() and fromCbor() methods). */
+    class TINYORM_EXPORT Cbor
+    {
+        Q_DISABLE_COPY_MOVE(Cbor)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        Cbor() = delete;
+        /*! Deleted destructor. */
+        ~Cbor() = delete;
+
+        /* Writing */
+        /*! Write the QVariant value including its type. */
+        static void writeValue(QCborStreamWriter &writer, const QVariant &value);
+        /*! Write the attributes vector (keys order is preserved). */
+        static void writeAttributes(QCborStreamWriter &writer,
+                                    const QList<AttributeItem> &attributes);
+
+        /* Reading */
+        /*! Read the QVariant value written by the writeValue(). */
+        static QVariant readValue(QCborStreamReader &reader);
+        /*! Read the attributes vector written by the writeAttributes(). */
+        static QList<AttributeItem> readAttributes(QCborStreamReader &reader);
+
+        /*! Read the text string. */
+        static QString readString(QCborStreamReader &reader);
+        /*! Read the type id of the value (by the type name for the user types). */
+        static int readTypeId(QCborStreamReader &reader);
+        /*! Read the unsigned integer. */
+        static quint64 readUnsignedInteger(QCborStreamReader &reader);
+        /*! Read the boolean. */
+        static bool readBool(QCborStreamReader &reader);
+        /*! Read the null value if it's the next one, returns true if it was read. */
+        static bool readNull(QCborStreamReader &reader);
+
+        /*! Enter the array, throw if the next value isn't the array. */
+        static void enterArray(QCborStreamReader &reader);
+        /*! Enter the map, throw if the next value isn't the map. */
+        static void enterMap(QCborStreamReader &reader);
+        /*! Leave the current array or map. */
+        static void leaveContainer(QCborStreamReader &reader);
+
+        /*! Throw if the given type can't be serialized using the QDataStream. */
+        static void throwIfNotStreamable(QMetaType metaType,
+                                         const QString &functionName);
+        /*! Throw if the given condition is false or if the reader is in error state. */
+        static void throwIfInvalid(const QCborStreamReader &reader, bool condition,
+                                   const QString &functionName);
+    };
+
+} // namespace Orm::Tiny::Utils
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_UTILS_CBOR_HPP
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef ORM_TINY_UTILS_JSON_HPP
+#define ORM_TINY_UTILS_JSON_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QJsonDocument>
+#include <QVariant>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+class QIODevice;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Utils
+{
+
+    /*! Library class for the JSON serialization, writes serialized models straight
+        to the UTF-8 output (w/o the QJsonObject/QJsonArray/QJsonDocument copies). */
+    class TINYORM_EXPORT Json
+    {
+        Q_DISABLE_COPY_MOVE(Json)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        Json() = delete;
+        /*! Deleted destructor. */
+        ~Json() = delete;
+
+        /*! Convert the serialized model to JSON (the same output as QJsonDocument). */
+        static QByteArray
+        toJson(const QVariantMap &attributes,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+        /*! Convert the serialized models to JSON (the same output as QJsonDocument). */
+        static QByteArray
+        toJson(const QVariantList &attributesList,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+
+        /*! Write the serialized model as JSON to the given device (false on error). */
+        static bool
+        toJson(QIODevice &device, const QVariantMap &attributes,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+        /*! Write the serialized models as JSON to the given device (false on error). */
+        static bool
+        toJson(QIODevice &device, const QVariantList &attributesList,
+               QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+    };
+
+} // namespace Orm::Tiny::Utils
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_UTILS_JSON_HPP
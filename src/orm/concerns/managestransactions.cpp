@@ -6,7 +6,9 @@
 
 #include "orm/concerns/countsqueries.hpp"
 #include "orm/databaseconnection.hpp"
+#include "orm/query/querycache.hpp"
 #include "orm/support/databaseconfiguration.hpp"
+#include "orm/support/deferredtouches.hpp"
 
 #include TINY_INCLUDE_TSqlTransactionError
 
@@ -126,6 +128,14 @@ bool ManagesTransactions::commit()
                                                e.databaseText());
     }
 
+    /* The written tables are visible to other connections from now on, forget their
+       results that were cached between the write statement and the commit. */
+    for (const auto &tag : std::as_const(m_queryCacheTags))
+        Query::QueryCache::invalidateTag(tag);
+
+    // The committed writes touch their owners at the end of the deferred touches scope
+    Support::DeferredTouches::commitTransaction(connection.getName());
+
     resetTransactions();
 
     // Queries execution time counter / Query statements counter
@@ -354,8 +364,13 @@ void ManagesTransactions::throwSqlTransactionError(const QString &functionName,
 
 DatabaseConnection &ManagesTransactions::resetTransactions()
 {
+    // The writes of the rolled back (or lost) transaction don't touch their owners
+    if (m_inTransaction)
+        Support::DeferredTouches::discardTransaction(databaseConnection().getName());
+
     m_savepoints = 0;
     m_inTransaction = false;
+    m_queryCacheTags.clear();
 
     return databaseConnection();
 }
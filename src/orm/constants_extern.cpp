@@ -177,6 +177,7 @@ namespace Orm::Constants
     // Others
     const QString NotImplemented    = QStringLiteral("Not implemented :/.");
     const QString dummy_NONEXISTENT = QStringLiteral("dummy-NON_EXISTENT");
+    const QString GroupLimitRow     = QStringLiteral("tinyorm_row");
 
 } // namespace Orm::Constants
 
@@ -9,6 +9,7 @@
 #include "orm/exceptions/lostconnectionerror.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
 #include "orm/query/querybuilder.hpp"
+#include "orm/query/querycache.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/helpers.hpp"
 #include "orm/utils/type.hpp"
@@ -185,6 +186,9 @@ DatabaseConnection::statement(const QString &queryString, QList<QVariant> bindin
 
             recordsHaveBeenModified();
 
+            // Forget the cached results of the written table
+            invalidateQueryCache(queryString_);
+
             return query;
         }
 
@@ -236,6 +240,9 @@ DatabaseConnection::affectingStatement(const QString &queryString,
 
             recordsHaveBeenModified(numRowsAffected > 0);
 
+            // Forget the cached results of the written table
+            invalidateQueryCache(queryString_);
+
             return {numRowsAffected, std::move(query)};
         }
 
@@ -276,6 +283,9 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
 
             recordsHaveBeenModified();
 
+            // Forget the cached results of the written table
+            invalidateQueryCache(queryString_);
+
             return query;
         }
 
@@ -427,6 +437,11 @@ bool DatabaseConnection::pingDatabase()
                 .arg(driverName()));
 }
 
+bool DatabaseConnection::hasConsecutiveInsertIds()
+{
+    return true;
+}
+
 /* See the note near the DatabaseManager/SqlQuery::driver() method about
    driver() vs driverWeak(). */
 
@@ -661,6 +676,27 @@ QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
     return Helpers::convertTimeZone(binding, m_qtTimeZone);
 }
 
+void DatabaseConnection::invalidateQueryCache(const QString &queryString)
+{
+    if (!inTransaction()) {
+        Query::QueryCache::invalidate(queryString, m_tablePrefix);
+        return;
+    }
+
+    auto tag = Query::QueryCache::writtenTag(queryString, m_tablePrefix);
+
+    // Not the write statement (eg. savepoint or set)
+    if (!tag)
+        return;
+
+    Query::QueryCache::invalidateTag(*tag);
+
+    /* Other connections can still read and cache the data before this write until
+       the transaction is committed, the table is invalidated again after the commit. */
+    if (!m_queryCacheTags.contains(*tag))
+        m_queryCacheTags << std::move(*tag);
+}
+
 void DatabaseConnection::logConnected()
 {
 #ifdef TINYORM_MYSQL_PING
@@ -1,5 +1,7 @@
 #include "orm/db.hpp"
 
+#include "orm/support/deferredtouches.hpp"
+
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 namespace Orm
@@ -404,6 +406,13 @@ DB::pretend(const std::function<void(DatabaseConnection &)> &callback,
     return manager().connection(connection).pretend(callback);
 }
 
+/* Deferred touches */
+
+void DB::withDeferredTouches(const std::function<void()> &callback)
+{
+    Support::DeferredTouches::withDeferredTouches(callback);
+}
+
 /* Records were modified */
 
 bool DB::getRecordsHaveBeenModified(const QString &connection)
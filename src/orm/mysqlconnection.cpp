@@ -251,6 +251,30 @@ bool MySqlConnection::pingDatabase()
 #endif
 }
 
+bool MySqlConnection::hasConsecutiveInsertIds()
+{
+    // Nothing is inserted while pretending
+    if (m_pretending)
+        return true;
+
+    // Return the cached value
+    if (m_hasConsecutiveInsertIds)
+        return *m_hasConsecutiveInsertIds;
+
+    /* The LAST_INSERT_ID() returns the first ID of the multi-rows insert, the other IDs
+       are consecutive only if the auto_increment_increment is 1 and the InnoDB
+       doesn't use the interleaved lock mode (2 is the default in MySQL 8), in this
+       lock mode the IDs of concurrent inserts can interleave. */
+    auto query = selectOne(QStringLiteral(
+                     "select @@auto_increment_increment, @@innodb_autoinc_lock_mode"));
+
+    // Cache the value
+    m_hasConsecutiveInsertIds = query.value(0).value<qint64>() == 1 &&
+                                query.value(1).value<qint64>() != 2;
+
+    return *m_hasConsecutiveInsertIds;
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> MySqlConnection::getDefaultQueryGrammar() const
@@ -1,8 +1,13 @@
 #include "orm/query/concerns/buildsqueries.hpp"
 
+#include <thread>
+
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/multiplerecordsfounderror.hpp"
 #include "orm/exceptions/recordsnotfounderror.hpp"
+#include "orm/macros/likely.hpp"
 #include "orm/query/querybuilder.hpp"
 #include "orm/utils/type.hpp"
 
@@ -171,6 +176,24 @@ bool BuildsQueries::eachById(
     }, column, alias);
 }
 
+ChunkedWriteProgress
+BuildsQueries::updateInChunks(const QList<UpdateItem> &values,
+                              const ChunkedWriteOptions &options)
+{
+    return writeInChunks(options, [&values](Builder &chunk)
+    {
+        return std::get<0>(chunk.update(values));
+    }, __tiny_func__);
+}
+
+ChunkedWriteProgress BuildsQueries::deleteInChunks(const ChunkedWriteOptions &options)
+{
+    return writeInChunks(options, [](Builder &chunk)
+    {
+        return std::get<0>(chunk.deleteRow());
+    }, __tiny_func__);
+}
+
 SqlQuery BuildsQueries::sole(const QList<Column> &columns)
 {
     auto query = builder().take(2).get(columns);
@@ -213,6 +236,70 @@ const Builder &BuildsQueries::builder() const noexcept
     return static_cast<const Builder &>(*this);
 }
 
+ChunkedWriteProgress
+BuildsQueries::writeInChunks(const ChunkedWriteOptions &options,
+                             const WriteChunkCallback &callback,
+                             const QString &functionName)
+{
+    if (options.chunkSize <= 0) T_UNLIKELY
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The chunk size must be greater than 0, %1 given "
+                               "in %2().")
+                .arg(options.chunkSize).arg(functionName));
+
+    /* The chunks are walked by the key ranges, the limit and offset would be silently
+       replaced by the chunkById() and the write of every chunk would be limited. */
+    if (builder().getLimit() >= 0 || builder().getOffset() > 0) T_UNLIKELY
+        throw Exceptions::LogicError(
+                QStringLiteral("The limit and offset clauses are not supported "
+                               "in %1().")
+                .arg(functionName));
+
+    const auto column = options.column.isEmpty() ? builder().defaultKeyName()
+                                                 : options.column;
+    // The qualified column (table.column) is returned w/o the table name
+    const auto alias = column.section(DOT, -1);
+
+    // Select only the keys, the written records aren't needed
+    auto keys = builder().clone();
+    keys.select(column);
+
+    ChunkedWriteProgress progress;
+
+    progress.completed = keys.chunkById(options.chunkSize,
+                                        [this, &options, &callback, &progress,
+                                         &column, &alias]
+                                        (SqlQuery &results, const qint64 /*unused*/)
+    {
+        QList<QVariant> ids;
+        ids.reserve(options.chunkSize);
+
+        while (results.next())
+            ids << results.value(alias);
+
+        /* The chunk is constrained by the original where clauses too, so the records
+           changed in the meantime aren't written. The chunk is a single statement, so
+           it's committed alone if the connection isn't inside the transaction. */
+        auto chunk = builder().clone();
+        chunk.reorder().whereIn(column, ids);
+
+        ++progress.chunks;
+        progress.rows += ids.size();
+        progress.affected += std::invoke(callback, chunk);
+
+        if (options.progress && !std::invoke(options.progress, progress))
+            return false;
+
+        // Throttle only if another chunk can follow
+        if (options.sleep.count() > 0 && ids.size() == options.chunkSize)
+            std::this_thread::sleep_for(options.sleep);
+
+        return true;
+    }, column, alias);
+
+    return progress;
+}
+
 } // namespace Orm::Query::Concerns
 
 TINYORM_END_COMMON_NAMESPACE
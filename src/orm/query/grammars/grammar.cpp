@@ -17,6 +17,16 @@ namespace Orm::Query::Grammars
 
 QString Grammar::compileSelect(QueryBuilder &query) const
 {
+    /* If the query has unions and an aggregate, the aggregate has to be computed
+       on the result of the whole union query, so we need to wrap it as a sub-select. */
+    if (!query.getUnions().isEmpty() && query.getAggregate()) T_UNLIKELY
+        return compileUnionAggregate(query);
+
+    /* The group limit is compiled using the row_number() window function into
+       the sub-select, the main query then only filters the row numbers. */
+    if (query.getGroupLimit()) T_UNLIKELY
+        return compileGroupLimit(query);
+
     /* If the query does not have any columns set, we'll set the columns to the
        * character to just get all of the columns from the database. Then we
        can build the query and concatenate all the pieces together as one. */
@@ -30,10 +40,18 @@ QString Grammar::compileSelect(QueryBuilder &query) const
        function for the component which is responsible for making the SQL. */
     auto sql = concatenate(compileComponents(query));
 
+    /* Every query is wrapped into parentheses (or sub-select on SQLite) so each of
+       them can contain its own order by and limit clauses, the union order by and
+       limit clauses are appended after all union queries. */
+    if (!query.getUnions().isEmpty()) T_UNLIKELY
+        sql = SPACE_IN.arg(wrapUnion(sql), compileUnions(query));
+
     // Restore original columns value
     query.setColumns(std::move(original));
 
-    return sql;
+    /* The with clause has to be the first, it can't be a part of the first union
+       query as it's shared by all union queries. */
+    return prependExpressions(query, std::move(sql));
 }
 
 QString Grammar::compileExists(QueryBuilder &query) const
@@ -73,9 +91,10 @@ QString Grammar::compileUpdate(QueryBuilder &query,
     const auto columns = compileUpdateColumns(values);
     const auto wheres  = compileWheres(query);
 
-    return query.getJoins().isEmpty()
-            ? compileUpdateWithoutJoins(query, table, columns, wheres)
-            : compileUpdateWithJoins(query, table, columns, wheres);
+    return prependExpressions(
+                query, query.getJoins().isEmpty()
+                       ? compileUpdateWithoutJoins(query, table, columns, wheres)
+                       : compileUpdateWithJoins(query, table, columns, wheres));
 }
 
 QList<QVariant>
@@ -91,17 +110,21 @@ Grammar::prepareBindingsForUpdate(const BindingsMap &bindings,
 #  pragma GCC diagnostic ignored "-Wdangling-reference"
 #endif
     const auto &joinBindings = bindings.find(BindingType::JOIN).value();
+    const auto &expressionBindings = bindings.find(BindingType::EXPRESSIONS).value();
 #if defined(__GNUG__) && !defined(__clang__)
 #  pragma GCC diagnostic pop
 #endif
 
     QList<QVariant> preparedBindings;
     preparedBindings.reserve(
-                joinBindings.size() + values.size() +
+                expressionBindings.size() + joinBindings.size() + values.size() +
                 // Rest of the bindings
-                computeReserveForBindingsMap(bindings, {BindingType::SELECT,
+                computeReserveForBindingsMap(bindings, {BindingType::EXPRESSIONS,
+                                                        BindingType::SELECT,
                                                         BindingType::JOIN}));
 
+    // The with clause is prepended before the update keyword
+    preparedBindings << expressionBindings;
     // Join bindings have to go first, I don't remember why 🫤
     preparedBindings << joinBindings;
 
@@ -114,7 +137,70 @@ Grammar::prepareBindingsForUpdate(const BindingsMap &bindings,
 
     /* Flatten bindings map and exclude select and join bindings and than merge
        all remaining bindings from flatten bindings map. */
-    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::SELECT,
+    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::EXPRESSIONS,
+                                                                BindingType::SELECT,
+                                                                BindingType::JOIN});
+
+    // std::copy() is ok, 'flatten' contains vector of references
+    std::copy(flatten.cbegin(), flatten.cend(), std::back_inserter(preparedBindings));
+
+    return preparedBindings;
+}
+
+QString Grammar::compileUpdateMany(QueryBuilder &query, const QString &keyColumn,
+                                   const QStringList &columns,
+                                   const QList<QVariantMap> &values) const
+{
+    const auto key = wrap(keyColumn);
+
+    QStringList compiledAssignments;
+    compiledAssignments.reserve(columns.size());
+
+    for (const auto &column : columns) {
+        QString cases;
+        cases.reserve(values.size() * 16);
+
+        for (const auto &row : values)
+            cases += QStringLiteral("when %1 then %2 ")
+                     .arg(parameter(row.value(keyColumn)), parameter(row.value(column)));
+
+        /* The else branch keeps the current value, it also gives the case expression
+           the column type (the PostgreSQL grammar uses the values list instead). */
+        compiledAssignments << QStringLiteral("%1 = case %2 %3else %1 end")
+                               .arg(wrap(column), key, cases);
+    }
+
+    return prependExpressions(
+                query, compileUpdateWithoutJoins(
+                           query, wrapTable(query.getFrom()),
+                           columnizeWithoutWrap(compiledAssignments),
+                           compileWheres(query)));
+}
+
+QList<QVariant>
+Grammar::prepareBindingsForUpdateMany(const BindingsMap &bindings,
+                                      const QString &keyColumn,
+                                      const QStringList &columns,
+                                      const QList<QVariantMap> &values) const
+{
+    const auto &expressionBindings = *bindings.constFind(BindingType::EXPRESSIONS);
+
+    QList<QVariant> preparedBindings;
+    preparedBindings.reserve(
+                expressionBindings.size() + (columns.size() * values.size() * 2) +
+                // Rest of the bindings
+                computeReserveForBindingsMap(bindings, {BindingType::EXPRESSIONS,
+                                                        BindingType::SELECT,
+                                                        BindingType::JOIN}));
+
+    // The with clause is prepended before the update keyword
+    preparedBindings << expressionBindings;
+
+    preparedBindings << flatValuesForUpdateMany(keyColumn, columns, values);
+
+    // Joins are not supported, see the Builder::updateMany()
+    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::EXPRESSIONS,
+                                                                BindingType::SELECT,
                                                                 BindingType::JOIN});
 
     // std::copy() is ok, 'flatten' contains vector of references
@@ -135,8 +221,10 @@ QString Grammar::compileDelete(QueryBuilder &query) const
     const auto table  = wrapTable(query.getFrom());
     const auto wheres = compileWheres(query);
 
-    return query.getJoins().isEmpty() ? compileDeleteWithoutJoins(query, table, wheres)
-                                      : compileDeleteWithJoins(query, table, wheres);
+    return prependExpressions(
+                query, query.getJoins().isEmpty()
+                       ? compileDeleteWithoutJoins(query, table, wheres)
+                       : compileDeleteWithJoins(query, table, wheres));
 }
 
 QList<QVariant> Grammar::prepareBindingsForDelete(const BindingsMap &bindings)
@@ -217,6 +305,44 @@ QStringList Grammar::compileComponents(const QueryBuilder &query) const
     return sql;
 }
 
+QString Grammar::compileExpressions(const QueryBuilder &query) const
+{
+    const auto &expressions = query.getExpressions();
+
+    /* The recursive keyword is defined for the whole with clause, all three supported
+       databases allow to mix recursive and non-recursive expressions in it. */
+    const auto recursive = std::ranges::any_of(expressions,
+                                               [](const auto &expression)
+    {
+        return expression.recursive;
+    });
+
+    QStringList compiledExpressions;
+    compiledExpressions.reserve(expressions.size());
+
+    for (const auto &expression : expressions)
+        compiledExpressions << QStringLiteral("%1%2 as (%3)")
+                               .arg(wrap(expression.name),
+                                    expression.columns.isEmpty()
+                                    ? EMPTY
+                                    : QStringLiteral(" (%1)")
+                                      .arg(columnize(expression.columns)),
+                                    expression.query);
+
+    return QStringLiteral("with %1%2").arg(recursive ? QStringLiteral("recursive ")
+                                                     : EMPTY,
+                                           compiledExpressions.join(COMMA));
+}
+
+QString Grammar::prependExpressions(const QueryBuilder &query, QString &&sql) const
+{
+    if (query.getExpressions().isEmpty()) T_LIKELY
+        return std::move(sql);
+
+    else T_UNLIKELY
+        return SPACE_IN.arg(compileExpressions(query), sql);
+}
+
 QString Grammar::compileAggregate(const QueryBuilder &query) const
 {
     /* Whether the aggregate contains a value is checked earlier by
@@ -238,8 +364,9 @@ QString Grammar::compileAggregate(const QueryBuilder &query) const
         column = QStringLiteral("distinct %1")
                  .arg(columnize(std::get<QStringList>(distinct)));
 
-    return QStringLiteral("select %1(%2) as %3").arg(function, column,
-                                                     wrap(QStringLiteral("aggregate")));
+    return QStringLiteral("select %1%2(%3) as %4")
+            .arg(compileOptimizerHints(query), function, column,
+                 wrap(QStringLiteral("aggregate")));
 }
 
 QString Grammar::compileColumns(const QueryBuilder &query) const
@@ -255,16 +382,37 @@ QString Grammar::compileColumns(const QueryBuilder &query) const
                 .arg(query.getConnection().getName()));
 
     if (std::get<bool>(distinct))
-        select = QStringLiteral("select distinct %1");
+        select = QStringLiteral("select %1distinct %2");
     else
-        select = QStringLiteral("select %1");
+        select = QStringLiteral("select %1%2");
+
+    return select.arg(compileOptimizerHints(query), columnize(query.getColumns()));
+}
 
-    return select.arg(columnize(query.getColumns()));
+QString Grammar::compileOptimizerHints(const QueryBuilder &/*unused*/) const
+{
+    return EMPTY;
 }
 
 QString Grammar::compileFrom(const QueryBuilder &query) const
 {
-    return QStringLiteral("from %1").arg(wrapTable(query.getFrom()));
+    auto from = QStringLiteral("from %1").arg(wrapTable(query.getFrom()));
+
+    if (!query.getIndexHint())
+        return from;
+
+    // Not all grammars support all index hints, an empty string means unsupported
+    auto indexHint = compileIndexHint(query);
+
+    if (indexHint.isEmpty())
+        return from;
+
+    return SPACE_IN.arg(from, indexHint);
+}
+
+QString Grammar::compileIndexHint(const QueryBuilder &/*unused*/) const
+{
+    return EMPTY;
 }
 
 QString Grammar::compileWheres(const QueryBuilder &query) const
@@ -374,13 +522,11 @@ QString Grammar::compileOrders(const QueryBuilder &query) const
         return QLatin1String("");
 
     return QStringLiteral("order by %1")
-            .arg(columnizeWithoutWrap(compileOrdersToVector(query)));
+            .arg(columnizeWithoutWrap(compileOrdersToVector(query.getOrders())));
 }
 
-QStringList Grammar::compileOrdersToVector(const QueryBuilder &query) const
+QStringList Grammar::compileOrdersToVector(const QList<OrderByItem> &orders) const
 {
-    const auto &orders = query.getOrders();
-
     QStringList compiledOrders;
     compiledOrders.reserve(orders.size());
 
@@ -404,6 +550,95 @@ QString Grammar::compileOffset(const QueryBuilder &query) const // NOLINT(readab
     return QStringLiteral("offset %1").arg(query.getOffset());
 }
 
+QString Grammar::compileGroupLimit(const QueryBuilder &query) const
+{
+    const auto &[limit, column] = *query.getGroupLimit();
+    const auto offset = query.getOffset();
+
+    /* The order by clause is moved to the row_number() window function and
+       the offset is applied using the row number, the with clause can't be
+       a part of the sub-select. */
+    auto groupQuery = query.cloneWithout({QueryBuilder::PropertyType::EXPRESSIONS,
+                                          QueryBuilder::PropertyType::GROUP_LIMIT,
+                                          QueryBuilder::PropertyType::ORDERS,
+                                          QueryBuilder::PropertyType::OFFSET});
+
+    if (groupQuery.getColumns().isEmpty())
+        groupQuery.setColumns({ASTERISK});
+
+    groupQuery.addSelect(Expression(compileRowNumber(column, query)));
+
+    const auto row = wrap(GroupLimitRow);
+
+    auto sql = QStringLiteral("select * from (%1) as %2 where %3 <= %4")
+               .arg(compileSelect(groupQuery),
+                    wrapTable(QStringLiteral("tinyorm_table")), row)
+               .arg(limit + std::max<qint64>(0, offset));
+
+    if (offset > 0)
+        sql += QStringLiteral(" and %1 > %2").arg(row).arg(offset);
+
+    sql += QStringLiteral(" order by %1").arg(row);
+
+    return prependExpressions(query, std::move(sql));
+}
+
+QString Grammar::compileRowNumber(const QString &partition,
+                                  const QueryBuilder &query) const
+{
+    auto over = QStringLiteral("partition by %1").arg(wrap(partition));
+
+    if (!query.getOrders().isEmpty())
+        over = SPACE_IN.arg(over, compileOrders(query));
+
+    return QStringLiteral("row_number() over (%1) as %2")
+            .arg(over, wrap(GroupLimitRow));
+}
+
+QString Grammar::compileUnions(const QueryBuilder &query) const
+{
+    const auto &unions = query.getUnions();
+    const auto &unionOrders = query.getUnionOrders();
+
+    QStringList sql;
+    sql.reserve(unions.size() + 3);
+
+    for (const auto &[unionQuery, all] : unions)
+        sql << SPACE_IN.arg(all ? QStringLiteral("union all") : QStringLiteral("union"),
+                            wrapUnion(unionQuery->toSql()));
+
+    if (!unionOrders.isEmpty())
+        sql << QStringLiteral("order by %1")
+               .arg(columnizeWithoutWrap(compileOrdersToVector(unionOrders)));
+
+    if (const auto unionLimit = query.getUnionLimit(); unionLimit > -1)
+        sql << QStringLiteral("limit %1").arg(unionLimit);
+
+    if (const auto unionOffset = query.getUnionOffset(); unionOffset > -1)
+        sql << QStringLiteral("offset %1").arg(unionOffset);
+
+    return sql.join(SPACE);
+}
+
+QString Grammar::wrapUnion(const QString &sql) const
+{
+    return PARENTH_ONE.arg(sql);
+}
+
+QString Grammar::compileUnionAggregate(const QueryBuilder &query) const
+{
+    /* The with clause must be compiled before the aggregate, it can't be a part of
+       the sub-select. */
+    auto unionQuery = query.cloneWithout({QueryBuilder::PropertyType::AGGREGATE,
+                                          QueryBuilder::PropertyType::EXPRESSIONS});
+
+    return prependExpressions(
+                query,
+                QStringLiteral("%1 from (%2) as %3")
+                .arg(compileAggregate(query), compileSelect(unionQuery),
+                     wrapTable(QStringLiteral("temp_table"))));
+}
+
 QString Grammar::compileLock(const QueryBuilder &query) const
 {
     const auto &lock = query.getLock();
@@ -577,6 +812,21 @@ Grammar::compileInsertToVector(const QList<QVariantMap> &values) const
     return compiledParameters;
 }
 
+QList<QVariant>
+Grammar::flatValuesForUpdateMany(const QString &keyColumn, const QStringList &columns,
+                                 const QList<QVariantMap> &values) const
+{
+    QList<QVariant> flattenValues;
+    flattenValues.reserve(columns.size() * values.size() * 2);
+
+    // The same order as in the compileUpdateMany(), the key and value for every row
+    for (const auto &column : columns)
+        for (const auto &row : values)
+            flattenValues << row.value(keyColumn) << row.value(column);
+
+    return flattenValues;
+}
+
 QString
 Grammar::compileUpdateColumns(const QList<UpdateItem> &values) const
 {
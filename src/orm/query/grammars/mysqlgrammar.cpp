@@ -241,6 +241,25 @@ MySqlGrammar::compileDeleteWithoutJoins(const QueryBuilder &query, const QString
     return sql;
 }
 
+QString MySqlGrammar::compileOptimizerHints(const QueryBuilder &query) const
+{
+    const auto &optimizerHints = query.getOptimizerHints();
+
+    if (optimizerHints.isEmpty())
+        return EMPTY;
+
+    // All optimizer hints must be in the one comment right after the select keyword
+    return QStringLiteral("/*+ %1 */ ").arg(optimizerHints.join(SPACE));
+}
+
+QString MySqlGrammar::compileIndexHint(const QueryBuilder &query) const
+{
+    // Whether the index hint contains a value is checked earlier in the compileFrom()
+    const auto &[type, index] = *query.getIndexHint(); // NOLINT(bugprone-unchecked-optional-access)
+
+    return QStringLiteral("%1 index (%2)").arg(type, index);
+}
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
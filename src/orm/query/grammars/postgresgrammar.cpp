@@ -33,6 +33,76 @@ QString PostgresGrammar::compileUpdate(QueryBuilder &query,
     return Grammar::compileUpdate(query, values);
 }
 
+QString PostgresGrammar::compileUpdateMany(
+            QueryBuilder &query, const QString &keyColumn, const QStringList &columns,
+            const QList<QVariantMap> &values) const
+{
+    const auto table = std::get<QString>(query.getFrom());
+
+    const auto tableWrapped = wrapTable(table);
+
+    const auto alias = getAliasFromFrom(table);
+
+    /* Columns of the values list are renamed, so they can't be ambiguous with columns
+       of the updated table in the where clause. */
+    const auto valuesAlias = wrapValue(QStringLiteral("tinyorm_update_values"));
+    const auto valuesKey   = wrapValue(QStringLiteral("tinyorm_key"));
+
+    QStringList assignments;
+    assignments.reserve(columns.size());
+
+    QStringList valuesColumns {valuesKey};
+    valuesColumns.reserve(columns.size() + 1);
+
+    for (qsizetype index = 0; index < columns.size(); ++index) {
+        auto valuesColumn = wrapValue(QStringLiteral("tinyorm_value_%1").arg(index));
+
+        assignments << QStringLiteral("%1 = %2")
+                       .arg(wrap(columns.at(index)),
+                            DOT_IN.arg(valuesAlias, valuesColumn));
+
+        valuesColumns << std::move(valuesColumn);
+    }
+
+    QStringList rows;
+    rows.reserve(values.size());
+
+    for (const auto &row : values) {
+        QStringList parameters {parameter(row.value(keyColumn))};
+        parameters.reserve(columns.size() + 1);
+
+        for (const auto &column : columns)
+            parameters << parameter(row.value(column));
+
+        rows << PARENTH_ONE.arg(columnizeWithoutWrap(parameters));
+    }
+
+    auto selectColumns = columns;
+    selectColumns.prepend(keyColumn);
+
+    // The updated rows are matched by the key, other where clauses are still applied
+    auto wheres = QStringLiteral("where %1 = %2")
+                  .arg(wrap(DOT_IN.arg(alias, keyColumn)),
+                       DOT_IN.arg(valuesAlias, valuesKey));
+
+    if (const auto compiledWheres = compileWheresToVector(query);
+        !compiledWheres.isEmpty()
+    )
+        wheres += QStringLiteral(" and (%1)")
+                  .arg(removeLeadingBoolean(compiledWheres.join(SPACE)));
+
+    /* The first empty select of the union gives the values list the column types,
+       PostgreSQL would resolve untyped parameters as text otherwise. */
+    return prependExpressions(
+                query,
+                QStringLiteral("update %1 set %2 "
+                               "from ((select %3 from %1 limit 0) union all values %4) "
+                               "as %5 (%6) %7")
+                .arg(tableWrapped, columnizeWithoutWrap(assignments),
+                     columnize(selectColumns), rows.join(COMMA), valuesAlias,
+                     columnizeWithoutWrap(valuesColumns), wheres));
+}
+
 QString PostgresGrammar::compileUpsert(
             QueryBuilder &query, const QList<QVariantMap> &values,
             const QStringList &uniqueBy, const QStringList &update) const
@@ -250,6 +320,25 @@ QString PostgresGrammar::dateBasedWhere(const QString &type,
                                                            parameter(where.value));
 }
 
+QList<QVariant>
+PostgresGrammar::flatValuesForUpdateMany(
+            const QString &keyColumn, const QStringList &columns,
+            const QList<QVariantMap> &values) const
+{
+    QList<QVariant> flattenValues;
+    flattenValues.reserve((columns.size() + 1) * values.size());
+
+    // The same order as in the compileUpdateMany(), the key and values for every row
+    for (const auto &row : values) {
+        flattenValues << row.value(keyColumn);
+
+        for (const auto &column : columns)
+            flattenValues << row.value(column);
+    }
+
+    return flattenValues;
+}
+
 QString PostgresGrammar::compileUpdateColumns(const QList<UpdateItem> &values) const
 {
     QStringList compiledAssignments;
@@ -276,11 +365,17 @@ QString PostgresGrammar::compileUpdateWithJoinsOrLimit(
 
     const auto alias = getAliasFromFrom(table);
 
+    /* The with clause has to be prepended before the update keyword so the bindings
+       order matches, so compile the sub-select without common table expressions. */
+    auto selectQuery = query.cloneWithout({QueryBuilder::PropertyType::EXPRESSIONS});
+
     const auto selectSql = compileSelect(
-                               query.select(QStringLiteral("%1.ctid").arg(alias)));
+                               selectQuery.select(QStringLiteral("%1.ctid").arg(alias)));
 
-    return QStringLiteral("update %1 set %2 where %3 in (%4)")
-            .arg(tableWrapped, columns, wrap(QStringLiteral("ctid")), selectSql);
+    return prependExpressions(
+                query,
+                QStringLiteral("update %1 set %2 where %3 in (%4)")
+                .arg(tableWrapped, columns, wrap(QStringLiteral("ctid")), selectSql));
 }
 
 QString PostgresGrammar::compileDeleteWithJoinsOrLimit(QueryBuilder &query) const
@@ -291,11 +386,16 @@ QString PostgresGrammar::compileDeleteWithJoinsOrLimit(QueryBuilder &query) cons
 
     const auto alias = getAliasFromFrom(table);
 
+    // Compile the sub-select without common table expressions, they are prepended
+    auto selectQuery = query.cloneWithout({QueryBuilder::PropertyType::EXPRESSIONS});
+
     const auto selectSql = compileSelect(
-                               query.select(QStringLiteral("%1.ctid").arg(alias)));
+                               selectQuery.select(QStringLiteral("%1.ctid").arg(alias)));
 
-    return QStringLiteral("delete from %1 where %2 in (%3)")
-            .arg(tableWrapped, wrap(QStringLiteral("ctid")), selectSql);
+    return prependExpressions(
+                query,
+                QStringLiteral("delete from %1 where %2 in (%3)")
+                .arg(tableWrapped, wrap(QStringLiteral("ctid")), selectSql));
 }
 
 } // namespace Orm::Query::Grammars
@@ -260,6 +260,26 @@ QString SQLiteGrammar::compileUpdateColumns(const QList<UpdateItem> &values) con
     return columnizeWithoutWrap(compiledAssignments);
 }
 
+QString SQLiteGrammar::wrapUnion(const QString &sql) const
+{
+    /* SQLite doesn't support parenthesized compound select statements, so every
+       union query has to be wrapped in the sub-select. */
+    return QStringLiteral("select * from (%1)").arg(sql);
+}
+
+QString SQLiteGrammar::compileIndexHint(const QueryBuilder &query) const
+{
+    // Whether the index hint contains a value is checked earlier in the compileFrom()
+    const auto &[type, index] = *query.getIndexHint(); // NOLINT(bugprone-unchecked-optional-access)
+
+    /* SQLite only supports the INDEXED BY clause which fails if the given index can't
+       be used, this is the same behavior as the force index, other hints are ignored. */
+    if (type != QStringLiteral("force"))
+        return EMPTY;
+
+    return QStringLiteral("indexed by %1").arg(index);
+}
+
 /* private */
 
 QString
@@ -274,11 +294,17 @@ SQLiteGrammar::compileUpdateWithJoinsOrLimit(QueryBuilder &query,
 
     const auto alias = getAliasFromFrom(table);
 
+    /* The with clause has to be prepended before the update keyword so the bindings
+       order matches, so compile the sub-select without common table expressions. */
+    auto selectQuery = query.cloneWithout({QueryBuilder::PropertyType::EXPRESSIONS});
+
     const auto selectSql = compileSelect(
-                               query.select(QStringLiteral("%1.rowid").arg(alias)));
+                               selectQuery.select(QStringLiteral("%1.rowid").arg(alias)));
 
-    return QStringLiteral("update %1 set %2 where %3 in (%4)")
-            .arg(tableWrapped, columns, wrap(QStringLiteral("rowid")), selectSql);
+    return prependExpressions(
+                query,
+                QStringLiteral("update %1 set %2 where %3 in (%4)")
+                .arg(tableWrapped, columns, wrap(QStringLiteral("rowid")), selectSql));
 }
 
 QString SQLiteGrammar::compileDeleteWithJoinsOrLimit(QueryBuilder &query) const
@@ -289,11 +315,16 @@ QString SQLiteGrammar::compileDeleteWithJoinsOrLimit(QueryBuilder &query) const
 
     const auto alias = getAliasFromFrom(table);
 
+    // Compile the sub-select without common table expressions, they are prepended
+    auto selectQuery = query.cloneWithout({QueryBuilder::PropertyType::EXPRESSIONS});
+
     const auto selectSql = compileSelect(
-                               query.select(QStringLiteral("%1.rowid").arg(alias)));
+                               selectQuery.select(QStringLiteral("%1.rowid").arg(alias)));
 
-    return QStringLiteral("delete from %1 where %2 in (%3)")
-            .arg(tableWrapped, wrap(QStringLiteral("rowid")), selectSql);
+    return prependExpressions(
+                query,
+                QStringLiteral("delete from %1 where %2 in (%3)")
+                .arg(tableWrapped, wrap(QStringLiteral("rowid")), selectSql));
 }
 
 } // namespace Orm::Query::Grammars
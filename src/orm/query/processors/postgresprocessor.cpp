@@ -0,0 +1,25 @@
+#include "orm/query/processors/postgresprocessor.hpp"
+
+#include "orm/types/sqlquery.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Query::Processors
+{
+
+QList<quint64>
+PostgresProcessor::processInsertGetIds(SqlQuery &query, const qsizetype count) const
+{
+    // The returning clause returns IDs in the same order as the inserted rows
+    QList<quint64> ids;
+    ids.reserve(count);
+
+    while (query.next())
+        ids << query.value(0).value<quint64>();
+
+    return ids;
+}
+
+} // namespace Orm::Query::Processors
+
+TINYORM_END_COMMON_NAMESPACE
@@ -21,6 +21,28 @@ QStringList Processor::processColumnListing(SqlQuery &query) const
     return columns;
 }
 
+QList<quint64>
+Processor::processInsertGetIds(SqlQuery &query, const qsizetype count) const
+{
+    /* The MySQL's LAST_INSERT_ID() returns the ID of the first row inserted by
+       the multi-rows insert, the IDs of all rows inserted by one statement are
+       consecutive, the Builder::insertGetIds() checks the auto-increment settings
+       using the DatabaseConnection::hasConsecutiveInsertIds() before. */
+    const auto firstId = query.lastInsertId().value<quint64>();
+
+    // QSqlQuery returns an invalid QVariant if can't obtain last inserted id
+    if (firstId == 0)
+        return {};
+
+    QList<quint64> ids;
+    ids.reserve(count);
+
+    for (qsizetype index = 0; index < count; ++index)
+        ids << firstId + static_cast<quint64>(index);
+
+    return ids;
+}
+
 } // namespace Orm::Query::Processors
 
 TINYORM_END_COMMON_NAMESPACE
@@ -21,6 +21,30 @@ QStringList SQLiteProcessor::processColumnListing(SqlQuery &query) const
     return columns;
 }
 
+QList<quint64>
+SQLiteProcessor::processInsertGetIds(SqlQuery &query, const qsizetype count) const
+{
+    /* The last_insert_rowid() returns the rowid of the last row inserted by
+       the multi-rows insert, SQLite holds the write lock for the whole statement,
+       so all the rowids are consecutive (the inserted rows never contain
+       the primary key, the Builder::insertGetIds() throws in this case). */
+    const auto lastId = query.lastInsertId().value<quint64>();
+
+    // QSqlQuery returns an invalid QVariant if can't obtain last inserted id
+    if (lastId == 0 || lastId < static_cast<quint64>(count))
+        return {};
+
+    QList<quint64> ids;
+    ids.reserve(count);
+
+    const auto firstId = lastId - static_cast<quint64>(count) + 1;
+
+    for (qsizetype index = 0; index < count; ++index)
+        ids << firstId + static_cast<quint64>(index);
+
+    return ids;
+}
+
 } // namespace Orm::Query::Processors
 
 TINYORM_END_COMMON_NAMESPACE
@@ -7,6 +7,7 @@
 
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/macros/likely.hpp"
 #include "orm/query/joinclause.hpp"
 #include "orm/utils/type.hpp"
@@ -33,6 +34,14 @@ Builder::Builder(std::shared_ptr<DatabaseConnection> connection,
 
 SqlQuery Builder::get(const QList<Column> &columns)
 {
+    /* The SqlQuery can't be created from the cached result, the remembered query
+       would be silently executed every time. */
+    if (m_remember) T_UNLIKELY
+        throw Exceptions::LogicError(
+                QStringLiteral("The remembered query can't return the SqlQuery, use "
+                               "the getRemembered() method instead in %1().")
+                .arg(__tiny_func__));
+
     return onceWithColumns(columns, [this]
     {
         return runSelect();
@@ -83,6 +92,10 @@ QVariant Builder::value(const Column &column)
     else
         column_ = std::get<QString>(column);
 
+    // The value of the remembered query is obtained from the query result cache
+    if (m_remember)
+        return take(1).getRemembered({column})->value(0, column_);
+
     const auto query = first({column});
 
     if (m_connection->pretending())
@@ -114,6 +127,9 @@ QList<QVariant> Builder::pluck(const Column &column)
     /* First, we will need to select the results of the query accounting for the
        given column. Once we have the results, we will be able to take the results
        and get the exact data that was requested for the query. */
+    if (m_remember)
+        return pluckRemembered(column);
+
     auto query = get({column});
 
     const auto size = QueryUtils::queryResultSize(query);
@@ -218,6 +234,43 @@ quint64 Builder::insertGetId(const QVariantMap &values, const QString &sequence)
     return query.lastInsertId().value<quint64>();
 }
 
+QList<quint64>
+Builder::insertGetIds(const QList<QVariantMap> &values, const QString &sequence)
+{
+    if (values.isEmpty())
+        return {};
+
+    /* The IDs are computed from the last inserted ID on some databases, this is
+       only possible if all the IDs were generated by the database. */
+    if (const auto &keyName = sequence.isEmpty() ? ID : sequence;
+        values.constFirst().contains(keyName)
+    ) T_UNLIKELY
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The inserted rows can't contain the '%1' primary key "
+                               "column, the generated IDs can't be obtained for them "
+                               "in %2().")
+                .arg(keyName, __tiny_func__));
+
+    // The IDs of the multi-rows insert can't be computed, insert rows one by one
+    if (!m_connection->hasConsecutiveInsertIds()) {
+        QList<quint64> ids;
+        ids.reserve(values.size());
+
+        for (const auto &row : values)
+            ids << insertGetId(row, sequence);
+
+        return ids;
+    }
+
+    auto query = m_connection->insert(
+                     m_grammar->compileInsertGetId(*this, values, sequence),
+                     cleanBindings(flatValuesForInsert(values)));
+
+    /* Every database returns the primary keys of the multi-rows insert differently,
+       the post processor knows how to obtain them. */
+    return m_connection->getPostProcessor().processInsertGetIds(query, values.size());
+}
+
 std::tuple<int, std::optional<TSqlQuery>>
 Builder::insertOrIgnore(const QList<QVariantMap> &values)
 {
@@ -251,6 +304,74 @@ Builder::update(const QList<UpdateItem> &values)
                                                                      values)));
 }
 
+std::tuple<int, std::optional<TSqlQuery>>
+Builder::updateMany(const QString &keyColumn, const QList<QVariantMap> &values)
+{
+    // Nothing to do, no values to update
+    if (values.isEmpty())
+        return {0, std::nullopt};
+
+    /* The update statement is compiled as the case expression for every column or as
+       the update from the values list, joins and limit can't be used with them. */
+    if (!m_joins.isEmpty() || m_limit > -1)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The 'updateMany' method doesn't support joins "
+                               "and limit in %1().")
+                .arg(__tiny_func__));
+
+    // Columns are obtained only from a first QMap
+    auto columns = values.constFirst().keys();
+    columns.removeOne(keyColumn);
+
+    if (columns.isEmpty())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The 'updateMany' method needs at least one column "
+                               "to update except the '%1' key column in %2().")
+                .arg(keyColumn, __tiny_func__));
+
+    /* Keep the number of bindings under the limit of all supported databases, every
+       row has at most the key and value bindings for every column and the key
+       binding for the where in clause. */
+    const auto chunkSize = std::max<qsizetype>(1, MaxBindings /
+                                                  ((columns.size() * 2) + 1));
+
+    /* All rows fit into one statement, the where in clause is added to the copy
+       of the query so this builder instance stays unchanged. */
+    if (values.size() <= chunkSize) T_LIKELY
+        return clone().runUpdateMany(keyColumn, columns, values);
+
+    int affectedTotal = 0;
+    std::optional<TSqlQuery> lastQuery;
+
+    // All chunks are updated or none of them, don't begin the nested transaction
+    const auto inTransaction = m_connection->inTransaction();
+
+    if (!inTransaction)
+        m_connection->beginTransaction();
+
+    try {
+        for (qsizetype offset = 0; offset < values.size(); offset += chunkSize) {
+            // Every chunk needs its own where in clause
+            auto [affected, query] = clone().runUpdateMany(
+                                         keyColumn, columns,
+                                         values.mid(offset, chunkSize));
+            affectedTotal += affected;
+            lastQuery.emplace(std::move(query));
+        }
+
+        if (!inTransaction)
+            m_connection->commit();
+
+    } catch (...) {
+        if (!inTransaction)
+            m_connection->rollBack();
+
+        throw;
+    }
+
+    return {affectedTotal, std::move(lastQuery)};
+}
+
 namespace
 {
     /*! Merge attributes and values for the updateOrInsert() method. */
@@ -355,10 +476,16 @@ void Builder::truncate()
 QVariant Builder::aggregate(const QString &function,
                             const QList<Column> &columns) const
 {
-    auto resultsQuery = cloneWithout({PropertyType::COLUMNS})
-                        .cloneWithoutBindings({BindingType::SELECT})
-                        .setAggregate(function, columns)
-                        .get(columns);
+    auto query = cloneWithout({PropertyType::COLUMNS})
+                 .cloneWithoutBindings({BindingType::SELECT});
+
+    query.setAggregate(function, columns);
+
+    // The aggregate of the remembered query is obtained from the query result cache
+    if (query.m_remember)
+        return query.getRemembered(columns)->value(0, QStringLiteral("aggregate"));
+
+    auto resultsQuery = query.get(columns);
 
     // Empty result
     if (!resultsQuery.first())
@@ -1013,7 +1140,8 @@ Builder &Builder::orderBy(const Column &column, const QString &direction)
                     "in %1().)")
                 .arg(__tiny_func__));
 
-    m_orders.append({column, directionLower});
+    // The union query has own orders
+    (m_unions.isEmpty() ? m_orders : m_unionOrders).append({column, directionLower});
 
     return *this;
 }
@@ -1030,9 +1158,16 @@ Builder &Builder::inRandomOrder(const QString &seed)
 
 Builder &Builder::orderByRaw(const QString &sql, const QList<QVariant> &bindings)
 {
-    m_orders.append({.sql = sql});
+    if (m_unions.isEmpty()) {
+        m_orders.append({.sql = sql});
+
+        addBinding(bindings, BindingType::ORDER);
+    }
+    else {
+        m_unionOrders.append({.sql = sql});
 
-    addBinding(bindings, BindingType::ORDER);
+        addBinding(bindings, BindingType::UNIONORDER);
+    }
 
     return *this;
 }
@@ -1053,8 +1188,10 @@ Builder &Builder::oldest(const Column &column)
 Builder &Builder::reorder()
 {
     m_orders.clear();
+    m_unionOrders.clear();
 
     m_bindings[BindingType::ORDER].clear();
+    m_bindings[BindingType::UNIONORDER].clear();
 
     return *this;
 }
@@ -1075,7 +1212,7 @@ Builder &Builder::limit(const qint64 value)
     Q_ASSERT(value >= 0);
 
     if (value >= 0)
-        m_limit = value;
+        (m_unions.isEmpty() ? m_limit : m_unionLimit) = value;
 
     return *this;
 }
@@ -1089,7 +1226,8 @@ Builder &Builder::offset(const qint64 value)
 {
     Q_ASSERT(value >= 0);
 
-    m_offset = std::max<decltype (value)>(0, value);
+    (m_unions.isEmpty() ? m_offset : m_unionOffset) =
+            std::max<decltype (value)>(0, value);
 
     return *this;
 }
@@ -1104,6 +1242,21 @@ Builder &Builder::forPage(const qint64 page, const qint64 perPage)
     return offset((page - 1) * perPage).limit(perPage);
 }
 
+Builder &Builder::groupLimit(const qint64 value, const QString &column)
+{
+    Q_ASSERT(value >= 0);
+
+    if (value < 0)
+        return *this;
+
+    m_groupLimit = {value, column};
+
+    // The group limit replaces the global limit
+    m_limit = -1;
+
+    return *this;
+}
+
 // NOTE api little different, added bool prependOrder parameter silverqx
 Builder &Builder::forPageBeforeId(const qint64 perPage, const QVariant &lastId,
                                   const QString &column, const bool prependOrder)
@@ -1138,6 +1291,36 @@ Builder &Builder::forPageAfterId(const qint64 perPage, const QVariant &lastId,
     return limit(perPage);
 }
 
+/* Index and optimizer hints */
+
+Builder &Builder::useIndex(const QString &index)
+{
+    m_indexHint = {QStringLiteral("use"), index};
+
+    return *this;
+}
+
+Builder &Builder::forceIndex(const QString &index)
+{
+    m_indexHint = {QStringLiteral("force"), index};
+
+    return *this;
+}
+
+Builder &Builder::ignoreIndex(const QString &index)
+{
+    m_indexHint = {QStringLiteral("ignore"), index};
+
+    return *this;
+}
+
+Builder &Builder::optimizerHint(const QString &hint)
+{
+    m_optimizerHints << hint;
+
+    return *this;
+}
+
 /* Pessimistic Locking */
 
 Builder &Builder::lockForUpdate()
@@ -1185,6 +1368,44 @@ Builder &Builder::lock(QString &&value)
     return *this;
 }
 
+/* Query result cache */
+
+Builder &Builder::remember(const std::chrono::seconds ttl, const QStringList &tags)
+{
+    if (ttl <= std::chrono::seconds::zero()) T_UNLIKELY
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The time to live must be greater than zero, "
+                               "the %1s was given in %2().")
+                .arg(ttl.count()).arg(__tiny_func__));
+
+    m_remember = RememberItem {ttl, tags};
+
+    return *this;
+}
+
+Builder &Builder::rememberForever(const QStringList &tags)
+{
+    m_remember = RememberItem {std::nullopt, tags};
+
+    return *this;
+}
+
+std::shared_ptr<const CachedResult> Builder::getRemembered(const QList<Column> &columns)
+{
+    // Save orignal columns, the same as the onceWithColumns()
+    auto original = m_columns;
+
+    if (original.isEmpty())
+        m_columns = columns;
+
+    auto result = runSelectRemembered();
+
+    // After running the query, the columns are reset to the original value
+    m_columns = std::move(original);
+
+    return result;
+}
+
 /* Debugging */
 
 // NOTE api different, added the replaceBindings and simpleBindings parameters silverqx
@@ -1232,6 +1453,27 @@ QList<QVariant> Builder::getBindings() const
         return bindings.size();
     }));
 
+    /* The order by clause is compiled into the row_number() window function
+       in the select clause if the group limit is set, so the order bindings have
+       to follow the select bindings. */
+    if (m_groupLimit) T_UNLIKELY {
+        for (auto itBindings = m_bindings.constBegin();
+             itBindings != m_bindings.constEnd(); ++itBindings
+        ) {
+            const auto type = itBindings.key();
+
+            if (type == BindingType::ORDER)
+                continue;
+
+            flattenBindings << itBindings.value();
+
+            if (type == BindingType::SELECT)
+                flattenBindings << m_bindings.value(BindingType::ORDER);
+        }
+
+        return flattenBindings;
+    }
+
     for (const auto &bindings : m_bindings)
         for (const auto &binding : bindings)
             flattenBindings << binding;
@@ -1430,6 +1672,28 @@ Builder Builder::cloneWithout(const std::unordered_set<PropertyType> &properties
             copy.m_columns.clear();
             break;
 
+        case PropertyType::EXPRESSIONS:
+            copy.m_expressions.clear();
+            copy.m_bindings[BindingType::EXPRESSIONS].clear();
+            break;
+
+        case PropertyType::AGGREGATE:
+            copy.m_aggregate.reset();
+            break;
+
+        case PropertyType::ORDERS:
+            copy.m_orders.clear();
+            copy.m_bindings[BindingType::ORDER].clear();
+            break;
+
+        case PropertyType::OFFSET:
+            copy.m_offset = -1;
+            break;
+
+        case PropertyType::GROUP_LIMIT:
+            copy.m_groupLimit.reset();
+            break;
+
         T_UNLIKELY
         default:
 #ifndef TINYORM_DEBUG
@@ -1725,6 +1989,127 @@ SqlQuery Builder::runSelect()
     return m_connection->select(toSql(), getBindings());
 }
 
+std::shared_ptr<const CachedResult> Builder::runSelectRemembered()
+{
+    auto sql = toSql();
+    auto bindings = getBindings();
+
+    /* The locked rows must be always read from the database and nothing can be cached
+       in the pretend mode, the result is only materialized in these cases. */
+    if (!m_remember || !std::holds_alternative<std::monostate>(m_lock) ||
+        m_connection->pretending()
+    ) {
+        auto query = m_connection->select(sql, std::move(bindings));
+
+        return std::make_shared<const CachedResult>(CachedResult::fromQuery(query));
+    }
+
+    auto key = QueryCache::key(m_connection->getName(), sql, bindings);
+
+    if (auto result = QueryCache::get(key); result)
+        return result;
+
+    /* Obtained before the select, the result isn't cached if any of the tagged tables
+       is written while the result is being read. */
+    const auto generation = QueryCache::generation();
+
+    auto query = m_connection->select(sql, std::move(bindings));
+    auto result = CachedResult::fromQuery(query);
+
+    /* The result read inside the transaction can see the uncommitted writes that can
+       be rolled back, so it's returned but not cached. */
+    if (m_connection->inTransaction())
+        return std::make_shared<const CachedResult>(std::move(result));
+
+    return QueryCache::put(key, std::move(result), m_remember->ttl, rememberTags(),
+                           generation);
+}
+
+QStringList Builder::rememberTags() const
+{
+    auto tags = m_remember ? m_remember->tags : QStringList();
+
+    appendTableTags(tags);
+
+    // The nested where queries have the same table as their parent query
+    tags.removeDuplicates();
+
+    return tags;
+}
+
+void Builder::appendTableTags(QStringList &tags) const
+{
+    /* The tables of the raw expressions (eg. fromSub() or joinSub()) and common table
+       expressions are unknown, these results are forgotten by every write. */
+    if (!m_expressions.isEmpty())
+        tags << QueryCache::anyTableTag();
+
+    if (std::holds_alternative<QString>(m_from))
+        tags << QueryCache::tableTag(std::get<QString>(m_from));
+    else if (std::holds_alternative<Expression>(m_from))
+        tags << QueryCache::anyTableTag();
+
+    for (const auto &join : m_joins) {
+        if (const auto &table = join->getTable(); std::holds_alternative<QString>(table))
+            tags << QueryCache::tableTag(std::get<QString>(table));
+        else if (std::holds_alternative<Expression>(table))
+            tags << QueryCache::anyTableTag();
+
+        // The nested and exists queries in the join constraints
+        for (const auto &where : join->getWheres())
+            if (where.nestedQuery)
+                where.nestedQuery->appendTableTags(tags);
+    }
+
+    /* The nested and exists queries, the where and select sub-selects are compiled
+       to raw expressions so their tables can only be tagged by the user tags. */
+    for (const auto &where : m_wheres)
+        if (where.nestedQuery)
+            where.nestedQuery->appendTableTags(tags);
+
+    // The unioned queries read their own tables
+    for (const auto &unionItem : m_unions)
+        unionItem.query->appendTableTags(tags);
+}
+
+QList<QVariant> Builder::pluckRemembered(const Column &column)
+{
+    const auto result = getRemembered({column});
+
+    // Empty result
+    if (result->isEmpty())
+        return {};
+
+    const auto index = result->columns.indexOf(stripTableForPluck(column));
+
+    QList<QVariant> values;
+    values.reserve(result->size());
+
+    for (const auto &row : result->rows)
+        values << (index < 0 ? QVariant() : row.at(index));
+
+    return values;
+}
+
+std::tuple<int, TSqlQuery>
+Builder::runUpdateMany(const QString &keyColumn, const QStringList &columns,
+                       const QList<QVariantMap> &values)
+{
+    QList<QVariant> keys;
+    keys.reserve(values.size());
+
+    for (const auto &row : values)
+        keys << row.value(keyColumn);
+
+    // Constrain the updated rows, also allows the database to use the index
+    whereIn(keyColumn, keys);
+
+    return m_connection->update(
+                m_grammar->compileUpdateMany(*this, keyColumn, columns, values),
+                cleanBindings(m_grammar->prepareBindingsForUpdateMany(
+                                  getRawBindings(), keyColumn, columns, values)));
+}
+
 Builder &Builder::joinInternal(
         std::shared_ptr<JoinClause> &&join, const QString &first,
         const QString &comparison, const QVariant &second, const bool where)
@@ -1788,6 +2173,15 @@ Builder &Builder::joinSubInternal(
                 callback, type);
 }
 
+Builder &Builder::unionInternal(std::shared_ptr<Builder> &&query, const bool all)
+{
+    addBinding(query->getBindings(), BindingType::UNION);
+
+    m_unions.append({std::move(query), all});
+
+    return *this;
+}
+
 Builder &Builder::whereInternal(
         const Column &column, const QString &comparison, QVariant value,
         const QString &condition, const WhereType type)
@@ -1806,12 +2200,12 @@ Builder &Builder::whereInternal(
 }
 
 /*! Type for binding type names array, used to map BindingType to its name. */
-using BindingNamesMapType = const std::array<const char *, 9>;
+using BindingNamesMapType = const std::array<const char *, 10>;
 
 /*! Map BindingType enum to the pretty names. */
 Q_GLOBAL_STATIC_WITH_ARGS(BindingNamesMapType, BindingNamesMap, // NOLINT(misc-use-anonymous-namespace, cppcoreguidelines-avoid-non-const-global-variables)
-                          ({"SELECT", "FROM", "JOIN", "WHERE", "GROUPBY", "HAVING",
-                            "ORDER", "UNION", "UNIONORDER"}))
+                          ({"EXPRESSIONS", "SELECT", "FROM", "JOIN", "WHERE", "GROUPBY",
+                            "HAVING", "ORDER", "UNION", "UNIONORDER"}))
 
 void Builder::checkBindingType(const BindingType type) const
 {
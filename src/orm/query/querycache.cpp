@@ -0,0 +1,541 @@
+#include "orm/query/querycache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "orm/macros/likely.hpp"
+#include "orm/types/sqlquery.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Query
+{
+
+namespace
+{
+    /*! Get the approximate size of the given value in bytes (the implicitly shared
+        data are counted for every value). */
+    std::size_t valueMemoryUsage(const QVariant &value)
+    {
+        switch (value.typeId()) {
+        case QMetaType::QString:
+            return sizeof (QVariant) +
+                    (static_cast<std::size_t>(value.toString().size()) * sizeof (QChar));
+
+        case QMetaType::QByteArray:
+            return sizeof (QVariant) +
+                    static_cast<std::size_t>(value.toByteArray().size());
+
+        default:
+            return sizeof (QVariant);
+        }
+    }
+
+    /*! Get the first words of the given SQL statement (the opening parenthesis also
+        ends the word, eg. insert into "table"("column")). */
+    QList<QStringView> leadingWords(const QString &statement, const qsizetype count)
+    {
+        QList<QStringView> words;
+        words.reserve(count);
+
+        const QStringView statementView(statement);
+        qsizetype begin = -1;
+
+        for (qsizetype i = 0; i < statementView.size() && words.size() < count; ++i) {
+            const auto ch = statementView.at(i);
+
+            if (ch.isSpace() || ch == QLatin1Char('(')) {
+                if (begin >= 0)
+                    words << statementView.sliced(begin, i - begin);
+
+                // The parenthesis ends the interesting part of the statement
+                if (ch == QLatin1Char('('))
+                    break;
+
+                begin = -1;
+            }
+            else if (begin < 0)
+                begin = i;
+        }
+
+        if (begin >= 0 && words.size() < count)
+            words << statementView.sliced(begin);
+
+        return words;
+    }
+
+    /*! Determine whether the given word is any of the given keywords. */
+    bool isKeyword(const QStringView word,
+                   const std::initializer_list<QStringView> keywords)
+    {
+        return std::ranges::any_of(keywords, [word](const QStringView keyword)
+        {
+            return word.compare(keyword, Qt::CaseInsensitive) == 0;
+        });
+    }
+} // namespace
+
+/* CachedResult */
+
+/* public */
+
+CachedResult CachedResult::fromQuery(Types::SqlQuery &query)
+{
+    CachedResult result;
+
+    int columnsCount = 0;
+
+    while (query.next()) {
+        // All rows have the same columns, obtain the field names only once
+        if (result.columns.isEmpty()) {
+            const auto record = query.record();
+            columnsCount = record.count();
+
+            result.columns.reserve(columnsCount);
+            for (int i = 0; i < columnsCount; ++i)
+                result.columns << record.fieldName(i);
+        }
+
+        QList<QVariant> row;
+        row.reserve(columnsCount);
+
+        for (int i = 0; i < columnsCount; ++i)
+            row << query.value(i);
+
+        result.rows << std::move(row);
+    }
+
+    return result;
+}
+
+QVariant CachedResult::value(const QList<QList<QVariant>>::size_type row,
+                             const QString &column) const
+{
+    const auto index = columns.indexOf(column);
+
+    if (index < 0 || row < 0 || row >= rows.size()) T_UNLIKELY
+        return {};
+
+    return rows.at(row).at(index);
+}
+
+std::size_t CachedResult::memoryUsage() const
+{
+    auto memory = sizeof (CachedResult);
+
+    for (const auto &column : columns)
+        memory += static_cast<std::size_t>(column.size()) * sizeof (QChar);
+
+    for (const auto &row : rows)
+        for (const auto &value : row)
+            memory += valueMemoryUsage(value);
+
+    return memory;
+}
+
+/* QueryCache */
+
+/*! Cached entries and limits. */
+struct QueryCache::Storage
+{
+    /*! Guards all the members below (the cache is shared by all threads). */
+    std::mutex mutex;
+    /*! Cached entries, the most recently used first. */
+    std::list<Entry> entries;
+    /*! Cached entries keyed by the cache key. */
+    std::unordered_map<QString, std::list<Entry>::iterator> entriesHash;
+    /*! Approximate memory usage of all entries in bytes. */
+    std::size_t memory = 0;
+    /*! Number of entries. */
+    std::atomic<std::size_t> size = 0;
+    /*! Whether any result was read using the cache, to skip the invalidation w/o
+        parsing the executed statements until the cache is used. */
+    std::atomic<bool> used = false;
+
+    /*! Incremented on every invalidation. */
+    std::atomic<quint64> generation = 0;
+    /*! The generation of the last invalidation of the tags. */
+    std::unordered_map<QString, quint64> tagGenerations;
+    /*! The generation of the last flush of all entries. */
+    quint64 flushGeneration = 0;
+
+    /*! Maximum number of entries. */
+    std::size_t maxEntries = 1000;
+    /*! Maximum memory usage of all entries in bytes (64MiB). */
+    std::size_t memoryBudget = 64 * 1024 * 1024;
+};
+
+/* public */
+
+QString QueryCache::key(const QString &connection, const QString &query,
+                        const QList<QVariant> &bindings)
+{
+    // The unit separator can't be a part of the connection name or query
+    static const auto separator = QChar(0x1F);
+
+    QString key;
+    key.reserve(connection.size() + query.size() + (bindings.size() * 8) + 2);
+
+    key += connection;
+    key += separator;
+    key += query;
+
+    // The type is a part of the key, the 1 and '1' are different bindings
+    for (const auto &binding : bindings) {
+        key += separator;
+        key += QLatin1String(binding.typeName());
+        key += binding.isNull() ? QStringLiteral("!") : QStringLiteral(":");
+        key += binding.toString();
+    }
+
+    return key;
+}
+
+std::shared_ptr<const CachedResult> QueryCache::get(const QString &key)
+{
+    auto &storage = QueryCache::storage();
+
+    // Nothing to do
+    if (storage.size == 0)
+        return nullptr;
+
+    const std::scoped_lock lock(storage.mutex);
+
+    const auto itHash = storage.entriesHash.find(key);
+
+    if (itHash == storage.entriesHash.end())
+        return nullptr;
+
+    const auto entry = itHash->second;
+
+    // The expired entry is forgotten
+    if (entry->expiresAt && *entry->expiresAt <= std::chrono::steady_clock::now()) {
+        erase(storage, entry);
+        return nullptr;
+    }
+
+    // Move the entry to the front as the most recently used
+    storage.entries.splice(storage.entries.begin(), storage.entries, entry);
+
+    return entry->result;
+}
+
+quint64 QueryCache::generation()
+{
+    auto &storage = QueryCache::storage();
+
+    // From now on, the executed statements must be parsed and invalidate the cache
+    storage.used = true;
+
+    return storage.generation;
+}
+
+std::shared_ptr<const CachedResult>
+QueryCache::put(const QString &key, CachedResult &&result,
+                const std::optional<std::chrono::seconds> ttl, const QStringList &tags,
+                const quint64 generation)
+{
+    const auto memory = result.memoryUsage();
+
+    auto sharedResult = std::make_shared<const CachedResult>(std::move(result));
+
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    // The result larger than the whole budget isn't cached at all
+    if (memory > storage.memoryBudget || storage.maxEntries == 0)
+        return sharedResult;
+
+    /* The tagged table was written while the result was being read, the result
+       can contain the data before this write so it's returned but not cached. */
+    if (isStale(storage, tags, generation))
+        return sharedResult;
+
+    // Replace the entry cached by another thread in the meantime
+    if (const auto itHash = storage.entriesHash.find(key);
+        itHash != storage.entriesHash.end()
+    )
+        erase(storage, itHash->second);
+
+    std::optional<std::chrono::steady_clock::time_point> expiresAt;
+    if (ttl)
+        expiresAt = std::chrono::steady_clock::now() + *ttl;
+
+    storage.entries.push_front({key, sharedResult, expiresAt, tags, memory});
+    storage.entriesHash.emplace(key, storage.entries.begin());
+    storage.memory += memory;
+    ++storage.size;
+
+    evictOverLimits(storage);
+
+    return sharedResult;
+}
+
+void QueryCache::flushTags(const QStringList &tags)
+{
+    auto &storage = QueryCache::storage();
+
+    // Nothing to do
+    if (!storage.used || tags.isEmpty())
+        return;
+
+    const std::scoped_lock lock(storage.mutex);
+
+    // Reject the results of these tags that are being read at the same time
+    const auto generation = ++storage.generation;
+
+    for (const auto &tag : tags)
+        storage.tagGenerations[tag] = generation;
+
+    for (auto it = storage.entries.begin(); it != storage.entries.end();) {
+        const auto entry = it++;
+
+        if (std::ranges::any_of(tags, [&entry](const QString &tag)
+        {
+            return entry->tags.contains(tag);
+        }))
+            erase(storage, entry);
+    }
+}
+
+void QueryCache::flush()
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    // Reject all the results that are being read at the same time
+    storage.flushGeneration = ++storage.generation;
+    // Older than the flush generation, the tag generations aren't needed anymore
+    storage.tagGenerations.clear();
+
+    storage.entriesHash.clear();
+    storage.entries.clear();
+    storage.memory = 0;
+    storage.size = 0;
+}
+
+void QueryCache::invalidate(const QString &statement, const QString &tablePrefix)
+{
+    // Nothing to do, don't parse every executed statement if the cache isn't used
+    if (!storage().used)
+        return;
+
+    // Not the write statement (eg. savepoint or set)
+    if (const auto tag = writtenTag(statement, tablePrefix); tag)
+        invalidateTag(*tag);
+}
+
+void QueryCache::invalidateTag(const QString &tag)
+{
+    // Nothing to do
+    if (!storage().used)
+        return;
+
+    // Unknown table, any cached result can be stale
+    if (tag.isEmpty())
+        flush();
+    // Also the results that read the unknown tables
+    else
+        flushTags({tag, anyTableTag()});
+}
+
+std::optional<QString>
+QueryCache::writtenTag(const QString &statement, const QString &tablePrefix)
+{
+    auto table = writtenTable(statement);
+
+    // Not the write statement or unknown table
+    if (!table || table->isEmpty())
+        return table;
+
+    return tableTag(*table, tablePrefix);
+}
+
+QString QueryCache::tableTag(const QString &table, const QString &tablePrefix)
+{
+    // Remove the alias (table as alias)
+    auto tag = table.trimmed().section(QLatin1Char(' '), 0, 0);
+
+    // Remove the quotes of all the supported databases
+    tag.remove(QLatin1Char('"')).remove(QLatin1Char('`'))
+       .remove(QLatin1Char('[')).remove(QLatin1Char(']'));
+
+    // Remove the schema or database name
+    if (const auto dot = tag.lastIndexOf(QLatin1Char('.')); dot >= 0)
+        tag = tag.sliced(dot + 1);
+
+    if (!tablePrefix.isEmpty() && tag.startsWith(tablePrefix))
+        tag = tag.sliced(tablePrefix.size());
+
+    return tag;
+}
+
+std::size_t QueryCache::maxEntries()
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    return storage.maxEntries;
+}
+
+void QueryCache::setMaxEntries(const std::size_t maxEntries)
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    storage.maxEntries = maxEntries;
+
+    evictOverLimits(storage);
+}
+
+std::size_t QueryCache::memoryBudget()
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    return storage.memoryBudget;
+}
+
+void QueryCache::setMemoryBudget(const std::size_t memoryBudget)
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    storage.memoryBudget = memoryBudget;
+
+    evictOverLimits(storage);
+}
+
+std::size_t QueryCache::size()
+{
+    return storage().size;
+}
+
+std::size_t QueryCache::memoryUsage()
+{
+    auto &storage = QueryCache::storage();
+
+    const std::scoped_lock lock(storage.mutex);
+
+    return storage.memory;
+}
+
+/* private */
+
+QueryCache::Storage &QueryCache::storage()
+{
+    static Storage cached;
+
+    return cached;
+}
+
+void QueryCache::evictOverLimits(Storage &storage)
+{
+    // The least recently used entries are at the back
+    while (!storage.entries.empty() &&
+           (storage.entries.size() > storage.maxEntries ||
+            storage.memory > storage.memoryBudget)
+    )
+        erase(storage, std::prev(storage.entries.end()));
+}
+
+void QueryCache::erase(Storage &storage, const std::list<Entry>::iterator entry)
+{
+    storage.memory -= entry->memory;
+    --storage.size;
+
+    storage.entriesHash.erase(entry->key);
+    storage.entries.erase(entry);
+}
+
+bool QueryCache::isStale(const Storage &storage, const QStringList &tags,
+                         const quint64 generation)
+{
+    if (storage.flushGeneration > generation)
+        return true;
+
+    return std::ranges::any_of(tags, [&storage, generation](const QString &tag)
+    {
+        const auto itTag = storage.tagGenerations.find(tag);
+
+        return itTag != storage.tagGenerations.end() && itTag->second > generation;
+    });
+}
+
+std::optional<QString> QueryCache::writtenTable(const QString &statement)
+{
+    // The table name is always among the first words of the statement
+    const auto words = leadingWords(statement, 8);
+
+    if (words.isEmpty())
+        return std::nullopt;
+
+    const auto command = words.constFirst();
+    QList<QStringView>::size_type i = 1;
+
+    // Skip the modifiers between the command and the table name
+    const auto tableAfter = [&words, &i](
+                                const std::initializer_list<QStringView> keywords)
+    {
+        while (i < words.size() && isKeyword(words.at(i), keywords))
+            ++i;
+
+        // Unknown table if the statement is cut before the table name
+        return i < words.size() ? words.at(i).toString() : QString("");
+    };
+
+    if (isKeyword(command, {u"insert", u"replace"}))
+        return tableAfter({u"or", u"ignore", u"replace", u"abort", u"fail",
+                           u"rollback", u"low_priority", u"delayed", u"high_priority",
+                           u"into"});
+
+    if (isKeyword(command, {u"update"}))
+        return tableAfter({u"or", u"ignore", u"replace", u"abort", u"fail",
+                           u"rollback", u"low_priority", u"only"});
+
+    if (isKeyword(command, {u"delete"})) {
+        auto table = tableAfter({u"low_priority", u"quick", u"ignore", u"from",
+                                 u"only"});
+
+        // The MySQL multi-table delete (delete t1, t2 from ...), unknown table
+        if (table.endsWith(QLatin1Char(',')))
+            return QString("");
+
+        /* The MySQL delete with joins has the alias of the deleted table before
+           the from keyword (delete alias from table as alias ...), the alias isn't
+           the table name so the table after the from keyword is returned. */
+        if (i + 1 < words.size() && isKeyword(words.at(i + 1), {u"from"})) {
+            i += 2;
+            return tableAfter({});
+        }
+
+        return table;
+    }
+
+    if (isKeyword(command, {u"truncate"}))
+        return tableAfter({u"table", u"only"});
+
+    // Other DDL statements (eg. create table or drop index) can't make results stale
+    if (isKeyword(command, {u"drop", u"alter"}))
+        return words.size() > 1 && isKeyword(words.at(1), {u"table"})
+                ? std::make_optional(tableAfter({u"table", u"if", u"exists", u"only"}))
+                : std::nullopt;
+
+    // The writes with the complex syntax, the table isn't parsed
+    if (isKeyword(command, {u"with", u"merge", u"call", u"exec", u"execute"}))
+        return QString("");
+
+    return std::nullopt;
+}
+
+} // namespace Orm::Query
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,177 @@
+#include "orm/support/deferredtouches.hpp"
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/map.hpp>
+
+#include "orm/db.hpp"
+#include "orm/macros/likely.hpp"
+#include "orm/macros/threadlocal.hpp"
+#include "orm/query/querybuilder.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+void DeferredTouches::withDeferredTouches(const std::function<void()> &callback)
+{
+    ++level();
+
+    try {
+        std::invoke(callback);
+
+    } catch (...) {
+        /* The writes outside of the transaction and the committed writes are already
+           persisted, so their owners are touched also if the outermost scope failed,
+           the touches of the rolled back transactions were already discarded. */
+        if (--level() == 0) {
+            try {
+                flush();
+            } catch (...) { // NOLINT(bugprone-empty-catch)
+                // The original exception is more important than the failed touch
+            }
+        }
+
+        throw;
+    }
+
+    // Touch only at the end of the outermost scope
+    if (--level() == 0)
+        flush();
+}
+
+bool DeferredTouches::isDeferring() noexcept
+{
+    return level() > 0;
+}
+
+void DeferredTouches::defer(
+        const QString &connection, const QString &table, const QString &keyName,
+        const QString &updatedAtColumn, const QList<QVariant> &ids,
+        const QVariant &timestamp)
+{
+    // The connection name is empty for the default connection
+    const auto &databaseConnection = DB::connection(connection);
+
+    /* The touches of the writes in the active transaction are kept aside until
+       the commit, they are discarded if the transaction is rolled back. */
+    auto &recordedTouches = databaseConnection.inTransaction() ? transactionTouches()
+                                                               : touches();
+
+    auto &tableTouches = recordedTouches[{databaseConnection.getName(), table, keyName,
+                                          updatedAtColumn}];
+
+    tableTouches.timestamp = timestamp;
+
+    for (const auto &id : ids)
+        // Nothing to touch for the null foreign key
+        if (id.isValid() && !id.isNull()) T_LIKELY
+            tableTouches.ids.try_emplace(id.toString(), id);
+}
+
+void DeferredTouches::commitTransaction(const QString &connection)
+{
+    auto &pendingTouches = transactionTouches();
+
+    // Nothing to do
+    if (pendingTouches.empty()) T_LIKELY
+        return;
+
+    for (auto it = pendingTouches.begin(); it != pendingTouches.end();) {
+        auto &[key, tableTouches] = *it;
+
+        if (std::get<0>(key) != connection) {
+            ++it;
+            continue;
+        }
+
+        merge(touches(), key, tableTouches);
+
+        it = pendingTouches.erase(it);
+    }
+}
+
+void DeferredTouches::discardTransaction(const QString &connection)
+{
+    auto &pendingTouches = transactionTouches();
+
+    // Nothing to do
+    if (pendingTouches.empty()) T_LIKELY
+        return;
+
+    std::erase_if(pendingTouches, [&connection](const auto &item)
+    {
+        return std::get<0>(item.first) == connection;
+    });
+}
+
+/* private */
+
+void DeferredTouches::flush()
+{
+    // Take the recorded touches so they are cleared also if any query fails
+    auto touches = std::exchange(DeferredTouches::touches(), {});
+
+    /* The touches of the still active transactions are executed in these transactions,
+       they are rolled back together if the transaction fails later. */
+    auto pendingTouches = std::exchange(transactionTouches(), {});
+
+    for (auto &[key, tableTouches] : pendingTouches)
+        merge(touches, key, tableTouches);
+
+    // One binding is used by the timestamp
+    constexpr auto chunkSize = QueryBuilder::MaxBindings - 1;
+
+    for (const auto &[key, tableTouches] : touches) {
+        const auto &[connection, table, keyName, updatedAtColumn] = key;
+
+        const auto ids = tableTouches.ids | ranges::views::values |
+                         ranges::to<QList<QVariant>>();
+
+        for (QList<QVariant>::size_type i = 0; i < ids.size(); i += chunkSize)
+            DB::table(table, connection)
+                    ->whereIn(keyName, ids.mid(i, chunkSize))
+                    .update({{updatedAtColumn, tableTouches.timestamp}});
+    }
+}
+
+void DeferredTouches::merge(TouchesType &touches, const TouchesKey &key,
+                            TableTouches &tableTouches)
+{
+    auto &recordedTableTouches = touches[key];
+
+    // The merged touches are the most recent ones
+    recordedTableTouches.timestamp = std::move(tableTouches.timestamp);
+    // The already recorded IDs are left in the source
+    recordedTableTouches.ids.merge(tableTouches.ids);
+}
+
+DeferredTouches::TouchesType &DeferredTouches::touches() noexcept
+{
+    T_THREAD_LOCAL
+    static TouchesType cached;
+
+    return cached;
+}
+
+DeferredTouches::TouchesType &DeferredTouches::transactionTouches() noexcept
+{
+    T_THREAD_LOCAL
+    static TouchesType cached;
+
+    return cached;
+}
+
+std::size_t &DeferredTouches::level() noexcept
+{
+    T_THREAD_LOCAL
+    static std::size_t cached = 0;
+
+    return cached;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
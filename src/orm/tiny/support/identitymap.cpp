@@ -0,0 +1,93 @@
+#include "orm/tiny/support/identitymap.hpp"
+
+#include "orm/macros/threadlocal.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Support
+{
+
+/* public */
+
+void IdentityMap::withIdentityMap(const std::function<void()> &callback)
+{
+    ++level();
+
+    try {
+        std::invoke(callback);
+
+    } catch (...) {
+        // The remembered models live only inside the outermost scope
+        if (--level() == 0)
+            clear();
+
+        throw;
+    }
+
+    if (--level() == 0)
+        clear();
+}
+
+bool IdentityMap::isEnabled() noexcept
+{
+    return level() > 0;
+}
+
+void IdentityMap::clear() noexcept
+{
+    models().clear();
+}
+
+void IdentityMap::evict(const QString &connection, const QString &table,
+                        const QList<QVariant> &ids)
+{
+    auto &models = IdentityMap::models();
+
+    // Nothing to do
+    if (models.empty())
+        return;
+
+    for (const auto &id : ids)
+        if (!isNullKey(id))
+            models.erase(KeyType {connection, table, id.toString()});
+}
+
+void IdentityMap::evictTable(const QString &connection, const QString &table)
+{
+    auto &models = IdentityMap::models();
+
+    // The empty QString is the lowest primary key of the table
+    auto it = models.lower_bound(KeyType {connection, table, {}});
+
+    while (it != models.end() && std::get<0>(it->first) == connection &&
+           std::get<1>(it->first) == table
+    )
+        it = models.erase(it);
+}
+
+std::size_t IdentityMap::size() noexcept
+{
+    return models().size();
+}
+
+/* private */
+
+IdentityMap::ModelsType &IdentityMap::models() noexcept
+{
+    T_THREAD_LOCAL
+    static ModelsType cached;
+
+    return cached;
+}
+
+std::size_t &IdentityMap::level() noexcept
+{
+    T_THREAD_LOCAL
+    static std::size_t cached = 0;
+
+    return cached;
+}
+
+} // namespace Orm::Tiny::Support
+
+TINYORM_END_COMMON_NAMESPACE
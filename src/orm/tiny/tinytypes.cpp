@@ -52,6 +52,33 @@ bool operator==(const WithItem &left, const WithItem &right)
     return left.name == right.name;
 }
 
+/* CounterCacheUpdates */
+
+/* public */
+
+void CounterCacheUpdates::Relation::add(const QVariant &ownerKey, const qint64 amount)
+{
+    // Nothing to do, the child model isn't associated with any owner
+    if (amount == 0 || !ownerKey.isValid() || ownerKey.isNull())
+        return;
+
+    auto &owner = owners[ownerKey.toString()];
+
+    if (!owner.key.isValid())
+        owner.key = ownerKey;
+
+    owner.amount += amount;
+}
+
+void CounterCacheUpdates::apply() const
+{
+    for (const auto &[relationName, relation] : relations)
+        for (const auto &[ownerKey, owner] : relation.owners)
+            // The incremented and decremented amounts of the same owner can cancel out
+            if (owner.amount != 0)
+                std::invoke(relation.update, owner.amount, owner.key);
+}
+
 } // namespace Orm::Tiny
 
 TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,168 @@
+#include "orm/tiny/unitofwork.hpp"
+
+#include <unordered_set>
+
+#include <range/v3/view/reverse.hpp>
+
+#include "orm/db.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+namespace
+{
+    /*! Get the number of the executed statements w/o the transactional statements
+        (the insert statements are counted as the normal statements). */
+    qsizetype statementsCount(const DatabaseConnection &connection)
+    {
+        const auto &counter = connection.getStatementsCounter();
+
+        return counter.normal + counter.affecting;
+    }
+} // namespace
+
+/* public */
+
+UnitOfWork::UnitOfWork(QString connection)
+    : m_connection(std::move(connection))
+{}
+
+UnitOfWorkStatistics UnitOfWork::flush()
+{
+    UnitOfWorkStatistics statistics {.models = size()};
+
+    // Nothing to do
+    if (statistics.models == 0)
+        return statistics;
+
+    auto &connection = this->connection();
+
+    /* The statements are counted using the connection's statements counter, if
+       the counter is already enabled then the user's counts are preserved. */
+    const auto wasCounting = connection.countingStatements();
+    const auto statementsBefore = wasCounting ? statementsCount(connection) : 0;
+    if (!wasCounting)
+        connection.enableStatementsCounter();
+
+    // Don't begin the nested transaction if the user already started one
+    const auto inTransaction = connection.inTransaction();
+
+    // The models are restored if the flush fails, so it can be retried
+    for (const auto &batch : m_batches)
+        batch->snapshot();
+
+    try {
+        if (!inTransaction)
+            connection.beginTransaction();
+
+        statistics.saved = flushBatches();
+
+        if (!inTransaction)
+            connection.commit();
+
+    } catch (...) {
+        if (!inTransaction)
+            connection.rollBack();
+
+        /* The inserted models would have the keys and the exists flags of the rolled
+           back rows, the registrations are kept. */
+        for (const auto &batch : m_batches)
+            batch->restore();
+
+        if (!wasCounting)
+            connection.disableStatementsCounter();
+
+        throw;
+    }
+
+    statistics.statements = statementsCount(connection) - statementsBefore;
+
+    if (!wasCounting)
+        connection.disableStatementsCounter();
+
+    clear();
+
+    return statistics;
+}
+
+void UnitOfWork::clear() noexcept
+{
+    m_batchesHash.clear();
+    m_batches.clear();
+}
+
+qsizetype UnitOfWork::size() const noexcept
+{
+    qsizetype size = 0;
+
+    for (const auto &batch : m_batches)
+        size += batch->size();
+
+    return size;
+}
+
+/* private */
+
+DatabaseConnection &UnitOfWork::connection() const
+{
+    return DB::connection(m_connection);
+}
+
+bool UnitOfWork::flushBatches()
+{
+    auto saved = true;
+
+    const auto batches = sortedBatches();
+
+    /* The inserts and updates of the owner models are executed before their children
+       and deletes in the reverse order (children first). Touching the owners is
+       deferred, so every owner is touched only once. */
+    DB::withDeferredTouches([&batches, &saved]
+    {
+        for (auto *const batch : batches)
+            saved = batch->flushSaves() && saved;
+
+        for (auto *const batch : batches | ranges::views::reverse)
+            batch->flushRemoves();
+    });
+
+    return saved;
+}
+
+std::vector<UnitOfWork::ModelBatch *> UnitOfWork::sortedBatches() const
+{
+    std::vector<ModelBatch *> sorted;
+    sorted.reserve(m_batches.size());
+
+    std::unordered_set<const ModelBatch *> visited;
+    visited.reserve(m_batches.size());
+
+    /* Depth-first post-order, the owners of the batch are placed before it. The self
+       references and the cycles are ignored (the cycle keeps the registration order),
+       the owners that aren't registered are ignored too. */
+    const auto visit = [this, &sorted, &visited](const auto &self,
+                                                 ModelBatch *const batch) -> void
+    {
+        if (!visited.insert(batch).second)
+            return;
+
+        for (const auto &ownerType : batch->ownerTypes())
+            if (const auto owner = m_batchesHash.find(ownerType);
+                owner != m_batchesHash.cend() && owner->second != batch
+            )
+                self(self, owner->second);
+
+        sorted.push_back(batch);
+    };
+
+    for (const auto &batch : m_batches)
+        visit(visit, batch.get());
+
+    return sorted;
+}
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
@@ -108,6 +108,11 @@ Attribute::removeDuplicateKeys(const QList<AttributeItem> &attributes)
         dedupedAttributesReversed << std::cref(attribute);
     }
 
+    /* Nothing to remove (the most common case), return the implicitly shared copy,
+       no attribute is copied in this case. */
+    if (dedupedAttributesReversed.size() == size)
+        return attributes;
+
     // Materialize the vector of references in reverse order
     return dedupedAttributesReversed
             | ranges::views::reverse
@@ -138,6 +143,10 @@ Attribute::removeDuplicateKeys(QList<AttributeItem> &&attributes) // NOLINT(cppc
         dedupedAttributesReversed << std::ref(attribute);
     }
 
+    // Nothing to remove (the most common case)
+    if (dedupedAttributesReversed.size() == size)
+        return std::move(attributes);
+
     // Materialize the vector of references in reverse order
     QList<AttributeItem> dedupedAttributes;
     dedupedAttributes.reserve(dedupedAttributesReversed.size());
@@ -0,0 +1,363 @@
+#include "orm/tiny/utils/cbor.hpp"
+
+#include <QDataStream>
+
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/macros/likely.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Utils
+{
+
+namespace
+{
+    /*! The QDataStream version used for less common types, don't change it, it would
+        break already serialized data. */
+    constexpr auto DataStreamVersion = QDataStream::Qt_6_2;
+
+    /*! Determine whether the given type is serialized as the CBOR signed integer. */
+    constexpr bool isSignedIntegerType(const int typeId) noexcept
+    {
+        switch (typeId) {
+        case QMetaType::Short:
+        case QMetaType::Int:
+        case QMetaType::Long:
+        case QMetaType::LongLong:
+        case QMetaType::SChar:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /*! Determine whether the given type is serialized as the CBOR unsigned integer. */
+    constexpr bool isUnsignedIntegerType(const int typeId) noexcept
+    {
+        switch (typeId) {
+        case QMetaType::UShort:
+        case QMetaType::UInt:
+        case QMetaType::ULong:
+        case QMetaType::ULongLong:
+        case QMetaType::UChar:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /*! Read the integer and convert it to the given type. */
+    QVariant readIntegerAs(QCborStreamReader &reader, const int typeId)
+    {
+        QVariant value;
+
+        if (reader.isUnsignedInteger())
+            value = static_cast<quint64>(reader.toUnsignedInteger());
+        else if (reader.isNegativeInteger())
+            value = static_cast<qint64>(reader.toInteger());
+        else T_UNLIKELY
+            Cbor::throwIfInvalid(reader, false, __tiny_func__);
+
+        reader.next();
+
+        value.convert(QMetaType(typeId));
+
+        return value;
+    }
+} // namespace
+
+/* public */
+
+/* Writing */
+
+void Cbor::writeValue(QCborStreamWriter &writer, const QVariant &value)
+{
+    const auto typeId = value.typeId();
+
+    /* The value is written as the [typeId, value] array, so the exact QVariant type
+       can be restored, also the null QVariant-s keep their type. The ids of the user
+       types depend on the registration order, so their type names are written. */
+    writer.startArray(2);
+
+    if (typeId >= QMetaType::User)
+        writer.append(QString::fromLatin1(value.metaType().name()));
+    else
+        writer.append(static_cast<qint64>(typeId));
+
+    if (value.isNull())
+        writer.appendNull();
+
+    else if (typeId == QMetaType::QString) T_LIKELY
+        writer.append(QStringView(*static_cast<const QString *>(value.constData())));
+
+    else if (isSignedIntegerType(typeId))
+        writer.append(value.toLongLong());
+
+    else if (isUnsignedIntegerType(typeId))
+        writer.append(value.toULongLong());
+
+    else if (typeId == QMetaType::Bool)
+        writer.append(value.toBool());
+
+    else if (typeId == QMetaType::Double)
+        writer.append(value.toDouble());
+
+    else if (typeId == QMetaType::Float)
+        writer.append(value.toFloat());
+
+    else if (typeId == QMetaType::QByteArray)
+        writer.append(*static_cast<const QByteArray *>(value.constData()));
+
+    // Less common types (QDateTime, QDate, QTime, ...), let the QDataStream do it
+    else {
+        throwIfNotStreamable(value.metaType(), __tiny_func__);
+
+        QByteArray bytes;
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream.setVersion(DataStreamVersion);
+
+        stream << value;
+
+        if (stream.status() != QDataStream::Ok) T_UNLIKELY
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("Failed to serialize the '%1' type using "
+                                   "the QDataStream (status %2) in %3().")
+                    .arg(QString::fromLatin1(value.metaType().name()))
+                    .arg(static_cast<int>(stream.status()))
+                    .arg(__tiny_func__));
+
+        writer.append(bytes);
+    }
+
+    writer.endArray();
+}
+
+void Cbor::writeAttributes(QCborStreamWriter &writer,
+                           const QList<AttributeItem> &attributes)
+{
+    // Flat array of the key and value pairs
+    writer.startArray(static_cast<quint64>(attributes.size()) * 2);
+
+    for (const auto &[key, value] : attributes) {
+        writer.append(QStringView(key));
+        writeValue(writer, value);
+    }
+
+    writer.endArray();
+}
+
+/* Reading */
+
+QVariant Cbor::readValue(QCborStreamReader &reader)
+{
+    enterArray(reader);
+
+    const auto typeId = readTypeId(reader);
+
+    QVariant value;
+
+    if (readNull(reader))
+        value = QVariant(QMetaType(typeId));
+
+    else if (typeId == QMetaType::QString) T_LIKELY
+        value = readString(reader);
+
+    else if (isSignedIntegerType(typeId) || isUnsignedIntegerType(typeId))
+        value = readIntegerAs(reader, typeId);
+
+    else if (typeId == QMetaType::Bool)
+        value = readBool(reader);
+
+    else if (typeId == QMetaType::Double || typeId == QMetaType::Float) {
+        throwIfInvalid(reader, reader.isFloatingPoint(), __tiny_func__);
+
+        if (reader.isFloat())
+            value = reader.toFloat();
+        else
+            value = reader.toDouble();
+
+        reader.next();
+    }
+    else {
+        throwIfInvalid(reader, reader.isByteArray(), __tiny_func__);
+
+        QByteArray bytes;
+        auto chunk = reader.readByteArray();
+
+        while (chunk.status == QCborStreamReader::Ok) {
+            bytes += chunk.data;
+            chunk = reader.readByteArray();
+        }
+
+        throwIfInvalid(reader, chunk.status == QCborStreamReader::EndOfString,
+                       __tiny_func__);
+
+        if (typeId == QMetaType::QByteArray)
+            value = std::move(bytes);
+
+        // Less common types serialized using the QDataStream
+        else {
+            QDataStream stream(bytes);
+            stream.setVersion(DataStreamVersion);
+
+            stream >> value;
+
+            throwIfInvalid(reader, stream.status() == QDataStream::Ok &&
+                                   value.typeId() == typeId,
+                           __tiny_func__);
+        }
+    }
+
+    leaveContainer(reader);
+
+    return value;
+}
+
+QList<AttributeItem> Cbor::readAttributes(QCborStreamReader &reader)
+{
+    QList<AttributeItem> attributes;
+
+    throwIfInvalid(reader, reader.isArray(), __tiny_func__);
+
+    if (reader.isLengthKnown())
+        attributes.reserve(static_cast<QList<AttributeItem>::size_type>(
+                               reader.length() / 2));
+
+    reader.enterContainer();
+
+    while (reader.hasNext()) {
+        auto key = readString(reader);
+        attributes.emplaceBack(std::move(key), readValue(reader));
+    }
+
+    leaveContainer(reader);
+
+    return attributes;
+}
+
+QString Cbor::readString(QCborStreamReader &reader)
+{
+    throwIfInvalid(reader, reader.isString(), __tiny_func__);
+
+    QString result;
+    auto chunk = reader.readString();
+
+    while (chunk.status == QCborStreamReader::Ok) {
+        result += chunk.data;
+        chunk = reader.readString();
+    }
+
+    throwIfInvalid(reader, chunk.status == QCborStreamReader::EndOfString,
+                   __tiny_func__);
+
+    return result;
+}
+
+int Cbor::readTypeId(QCborStreamReader &reader)
+{
+    if (!reader.isString())
+        return static_cast<int>(readUnsignedInteger(reader));
+
+    // The user type is written by its type name
+    const auto typeName = readString(reader);
+    const auto metaType = QMetaType::fromName(typeName.toLatin1());
+
+    if (!metaType.isValid()) T_UNLIKELY
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' type isn't registered in the Qt's meta-type "
+                               "system, it can't be deserialized in %2().")
+                .arg(typeName, __tiny_func__));
+
+    return metaType.id();
+}
+
+quint64 Cbor::readUnsignedInteger(QCborStreamReader &reader)
+{
+    throwIfInvalid(reader, reader.isUnsignedInteger(), __tiny_func__);
+
+    const auto result = reader.toUnsignedInteger();
+
+    reader.next();
+
+    return result;
+}
+
+bool Cbor::readBool(QCborStreamReader &reader)
+{
+    throwIfInvalid(reader, reader.isBool(), __tiny_func__);
+
+    const auto result = reader.toBool();
+
+    reader.next();
+
+    return result;
+}
+
+bool Cbor::readNull(QCborStreamReader &reader)
+{
+    if (!reader.isNull())
+        return false;
+
+    reader.next();
+
+    return true;
+}
+
+void Cbor::enterArray(QCborStreamReader &reader)
+{
+    throwIfInvalid(reader, reader.isArray(), __tiny_func__);
+
+    reader.enterContainer();
+}
+
+void Cbor::enterMap(QCborStreamReader &reader)
+{
+    throwIfInvalid(reader, reader.isMap(), __tiny_func__);
+
+    reader.enterContainer();
+}
+
+void Cbor::leaveContainer(QCborStreamReader &reader)
+{
+    // Skip values that aren't known to this version (forward compatibility)
+    while (reader.hasNext())
+        reader.next();
+
+    reader.leaveContainer();
+}
+
+void Cbor::throwIfNotStreamable(const QMetaType metaType, const QString &functionName)
+{
+    /* The built-in types are always streamable, the QVariant asserts if it doesn't
+       have the QDataStream operators. */
+    if (metaType.id() < QMetaType::User ||
+        metaType.hasRegisteredDataStreamOperators()
+    ) T_LIKELY
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' type doesn't have the QDataStream operators, "
+                               "it can't be serialized in %2().")
+                .arg(QString::fromLatin1(metaType.name()), functionName));
+}
+
+void Cbor::throwIfInvalid(const QCborStreamReader &reader, const bool condition,
+                          const QString &functionName)
+{
+    if (condition && reader.lastError() == QCborError::NoError) T_LIKELY
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("Invalid CBOR data for the model serialization "
+                               "(offset %1): %2, in %3().")
+                .arg(reader.currentOffset())
+                .arg(reader.lastError() == QCborError::NoError
+                     ? QStringLiteral("unexpected value type")
+                     : reader.lastError().toString(),
+                     functionName));
+}
+
+} // namespace Orm::Tiny::Utils
+
+TINYORM_END_COMMON_NAMESPACE
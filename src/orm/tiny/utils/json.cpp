@@ -0,0 +1,480 @@
+#include "orm/tiny/utils/json.hpp"
+
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QLocale>
+
+#include <cmath>
+#include <limits>
+
+#include "orm/macros/likely.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Utils
+{
+
+namespace
+{
+    /*! Streaming JSON writer, produces the same output as the QJsonDocument::toJson()
+        but walks the QVariant tree directly. */
+    class JsonWriter
+    {
+        Q_DISABLE_COPY_MOVE(JsonWriter)
+
+    public:
+        /*! Constructor. */
+        inline explicit JsonWriter(QJsonDocument::JsonFormat format,
+                                   QIODevice *device = nullptr);
+        /*! Default destructor. */
+        ~JsonWriter() = default;
+
+        /*! Write the top-level JSON object. */
+        void writeDocument(const QVariantMap &attributes);
+        /*! Write the top-level JSON array. */
+        void writeDocument(const QVariantList &attributesList);
+
+        /*! Get the written JSON (only the not yet flushed part if writing to device). */
+        inline QByteArray &json() noexcept;
+        /*! Write the buffered JSON to the device, returns false on failure. */
+        bool flush();
+
+    private:
+        /*! Write the JSON object. */
+        void writeObject(const QVariantMap &attributes, qsizetype indent);
+        /*! Write the JSON array. */
+        void writeArray(const QVariantList &attributesList, qsizetype indent);
+        /*! Write the JSON value. */
+        void writeValue(const QVariant &value, qsizetype indent);
+
+        /*! Write the QJsonValue (used for less common types). */
+        void writeJsonValue(const QJsonValue &value, qsizetype indent);
+        /*! Write the QJsonObject (used for less common types). */
+        void writeJsonObject(const QJsonObject &object, qsizetype indent);
+        /*! Write the QJsonArray (used for less common types). */
+        void writeJsonArray(const QJsonArray &array, qsizetype indent);
+
+        /*! Write the opening bracket of a container. */
+        inline void writeOpening(char bracket);
+        /*! Write the closing bracket of a container. */
+        inline void writeClosing(char bracket, qsizetype indent);
+        /*! Write the object key. */
+        inline void writeKey(const QString &key, qsizetype indent);
+        /*! Write the separator after a container item. */
+        inline void writeSeparator(bool last);
+        /*! Write the indentation. */
+        inline void writeIndent(qsizetype indent);
+
+        /*! Write the integral number. */
+        inline void writeInteger(qint64 value);
+        /*! Write the floating-point number. */
+        inline void writeDouble(double value);
+        /*! Write the quoted and escaped string. */
+        void writeString(const QString &value);
+
+        /*! Flush the buffer to the device if it is big enough. */
+        inline void flushIfNeeded();
+
+        /*! Buffer size after which the JSON is written to the device. */
+        constexpr static qsizetype FlushSize = 16384;
+
+        /*! The written JSON. */
+        QByteArray m_json;
+        /*! Device to which the JSON will be written (nullptr to write to m_json). */
+        QIODevice *m_device;
+        /*! Determine whether the compact format is used. */
+        bool m_compact;
+        /*! Determine whether all writes to the device succeeded. */
+        bool m_ok = true;
+    };
+
+    /* public */
+
+    JsonWriter::JsonWriter(const QJsonDocument::JsonFormat format,
+                           QIODevice *const device)
+        : m_device(device)
+        , m_compact(format == QJsonDocument::Compact)
+    {}
+
+    void JsonWriter::writeDocument(const QVariantMap &attributes)
+    {
+        writeObject(attributes, 0);
+
+        if (!m_compact)
+            m_json += '\n';
+    }
+
+    void JsonWriter::writeDocument(const QVariantList &attributesList)
+    {
+        writeArray(attributesList, 0);
+
+        if (!m_compact)
+            m_json += '\n';
+    }
+
+    QByteArray &JsonWriter::json() noexcept
+    {
+        return m_json;
+    }
+
+    bool JsonWriter::flush()
+    {
+        if (m_device == nullptr || m_json.isEmpty())
+            return m_ok;
+
+        if (m_device->write(m_json) != m_json.size())
+            m_ok = false;
+
+        m_json.clear();
+
+        return m_ok;
+    }
+
+    /* private */
+
+    void JsonWriter::writeObject(const QVariantMap &attributes, // NOLINT(misc-no-recursion)
+                                 const qsizetype indent)
+    {
+        writeOpening('{');
+
+        for (auto it = attributes.constBegin(); it != attributes.constEnd(); ++it) {
+            writeKey(it.key(), indent + 1);
+            writeValue(it.value(), indent + 1);
+            writeSeparator(std::next(it) == attributes.constEnd());
+        }
+
+        writeClosing('}', indent);
+
+        flushIfNeeded();
+    }
+
+    void JsonWriter::writeArray(const QVariantList &attributesList, // NOLINT(misc-no-recursion)
+                                const qsizetype indent)
+    {
+        writeOpening('[');
+
+        const auto size = attributesList.size();
+
+        for (qsizetype i = 0; i < size; ++i) {
+            writeIndent(indent + 1);
+            writeValue(attributesList.at(i), indent + 1);
+            writeSeparator(i == size - 1);
+        }
+
+        writeClosing(']', indent);
+    }
+
+    void JsonWriter::writeValue(const QVariant &value, const qsizetype indent) // NOLINT(misc-no-recursion)
+    {
+        // The same as the AttributeUtils::fixQtNullVariantBug() does
+        if (value.isNull()) T_UNLIKELY {
+            m_json += "null";
+            return;
+        }
+
+        switch (value.typeId()) {
+        case QMetaType::QVariantMap:
+            writeObject(*static_cast<const QVariantMap *>(value.constData()), indent);
+            break;
+
+        case QMetaType::QVariantList:
+            writeArray(*static_cast<const QVariantList *>(value.constData()), indent);
+            break;
+
+        case QMetaType::QString:
+            writeString(*static_cast<const QString *>(value.constData()));
+            break;
+
+        case QMetaType::Bool:
+            m_json += value.toBool() ? "true" : "false";
+            break;
+
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::LongLong:
+            writeInteger(value.toLongLong());
+            break;
+
+        // The same as the QJsonValue::fromVariant() does
+        case QMetaType::ULongLong:
+            if (const auto number = value.toULongLong();
+                number <= static_cast<quint64>(std::numeric_limits<qint64>::max())
+            ) T_LIKELY
+                writeInteger(static_cast<qint64>(number));
+            else T_UNLIKELY
+                writeDouble(value.toDouble());
+            break;
+
+        case QMetaType::Float:
+        case QMetaType::Double:
+            writeDouble(value.toDouble());
+            break;
+
+        // Less common types (QDateTime, QByteArray, ...), let Qt do the conversion
+        default:
+            writeJsonValue(QJsonValue::fromVariant(value), indent);
+            break;
+        }
+    }
+
+    void JsonWriter::writeJsonValue(const QJsonValue &value, const qsizetype indent) // NOLINT(misc-no-recursion)
+    {
+        switch (value.type()) {
+        case QJsonValue::Bool:
+            m_json += value.toBool() ? "true" : "false";
+            break;
+
+        case QJsonValue::Double:
+            // The QJsonValue internally distinguishes integers and doubles
+            if (value.toVariant().typeId() == QMetaType::LongLong)
+                writeInteger(value.toInteger());
+            else
+                writeDouble(value.toDouble());
+            break;
+
+        case QJsonValue::String:
+            writeString(value.toString());
+            break;
+
+        case QJsonValue::Array:
+            writeJsonArray(value.toArray(), indent);
+            break;
+
+        case QJsonValue::Object:
+            writeJsonObject(value.toObject(), indent);
+            break;
+
+        default:
+            m_json += "null";
+            break;
+        }
+    }
+
+    void JsonWriter::writeJsonObject(const QJsonObject &object, // NOLINT(misc-no-recursion)
+                                     const qsizetype indent)
+    {
+        writeOpening('{');
+
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it) {
+            writeKey(it.key(), indent + 1);
+            writeJsonValue(it.value(), indent + 1);
+            writeSeparator(std::next(it) == object.constEnd());
+        }
+
+        writeClosing('}', indent);
+    }
+
+    void JsonWriter::writeJsonArray(const QJsonArray &array, // NOLINT(misc-no-recursion)
+                                    const qsizetype indent)
+    {
+        writeOpening('[');
+
+        const auto size = array.size();
+
+        for (qsizetype i = 0; i < size; ++i) {
+            writeIndent(indent + 1);
+            writeJsonValue(array.at(i), indent + 1);
+            writeSeparator(i == size - 1);
+        }
+
+        writeClosing(']', indent);
+    }
+
+    void JsonWriter::writeOpening(const char bracket)
+    {
+        m_json += bracket;
+
+        if (!m_compact)
+            m_json += '\n';
+    }
+
+    void JsonWriter::writeClosing(const char bracket, const qsizetype indent)
+    {
+        writeIndent(indent);
+
+        m_json += bracket;
+    }
+
+    void JsonWriter::writeKey(const QString &key, const qsizetype indent)
+    {
+        writeIndent(indent);
+        writeString(key);
+
+        m_json += m_compact ? ":" : ": ";
+    }
+
+    void JsonWriter::writeSeparator(const bool last)
+    {
+        if (!last)
+            m_json += ',';
+
+        if (!m_compact)
+            m_json += '\n';
+    }
+
+    void JsonWriter::writeIndent(const qsizetype indent)
+    {
+        if (!m_compact && indent > 0)
+            m_json.append(indent * 4, ' ');
+    }
+
+    void JsonWriter::writeInteger(const qint64 value)
+    {
+        m_json += QByteArray::number(value);
+    }
+
+    void JsonWriter::writeDouble(const double value)
+    {
+        // +INF || -INF || NaN (see RFC4627#section2.4)
+        if (std::isfinite(value)) T_LIKELY
+            m_json += QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+        else T_UNLIKELY
+            m_json += "null";
+    }
+
+    void JsonWriter::writeString(const QString &value)
+    {
+        constexpr static auto hexDigit = [](const uint digit) -> char
+        {
+            return static_cast<char>(digit < 0xa ? '0' + digit : 'a' + digit - 0xa);
+        };
+
+        const auto writeUnicodeEscape = [this](const char16_t unit)
+        {
+            m_json += "\\u";
+            m_json += hexDigit((unit >> 12U) & 0xfU);
+            m_json += hexDigit((unit >> 8U) & 0xfU);
+            m_json += hexDigit((unit >> 4U) & 0xfU);
+            m_json += hexDigit(unit & 0xfU);
+        };
+
+        m_json += '"';
+
+        const auto *source = value.utf16();
+        const auto *const end = source + value.size(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        while (source != end) {
+            const auto unit = *source++; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            // ASCII
+            if (unit < 0x80) T_LIKELY {
+                if (unit >= 0x20 && unit != '"' && unit != '\\') T_LIKELY {
+                    m_json += static_cast<char>(unit);
+                    continue;
+                }
+
+                switch (unit) {
+                case '"':
+                    m_json += "\\\"";
+                    break;
+                case '\\':
+                    m_json += "\\\\";
+                    break;
+                case '\b':
+                    m_json += "\\b";
+                    break;
+                case '\f':
+                    m_json += "\\f";
+                    break;
+                case '\n':
+                    m_json += "\\n";
+                    break;
+                case '\r':
+                    m_json += "\\r";
+                    break;
+                case '\t':
+                    m_json += "\\t";
+                    break;
+                default:
+                    writeUnicodeEscape(unit);
+                    break;
+                }
+            }
+            // 2 bytes UTF-8
+            else if (unit < 0x800) {
+                m_json += static_cast<char>(0xc0U | (unit >> 6U));
+                m_json += static_cast<char>(0x80U | (unit & 0x3fU));
+            }
+            // 3 bytes UTF-8
+            else if (!QChar::isSurrogate(unit)) {
+                m_json += static_cast<char>(0xe0U | (unit >> 12U));
+                m_json += static_cast<char>(0x80U | ((unit >> 6U) & 0x3fU));
+                m_json += static_cast<char>(0x80U | (unit & 0x3fU));
+            }
+            // 4 bytes UTF-8 (surrogate pair)
+            else if (QChar::isHighSurrogate(unit) && source != end &&
+                     QChar::isLowSurrogate(*source)
+            ) {
+                const auto codePoint = QChar::surrogateToUcs4(unit, *source++); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+                m_json += static_cast<char>(0xf0U | (codePoint >> 18U));
+                m_json += static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3fU));
+                m_json += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3fU));
+                m_json += static_cast<char>(0x80U | (codePoint & 0x3fU));
+            }
+            // Unpaired surrogate, the same as the QJsonDocument does
+            else T_UNLIKELY
+                writeUnicodeEscape(unit);
+        }
+
+        m_json += '"';
+    }
+
+    void JsonWriter::flushIfNeeded()
+    {
+        if (m_device != nullptr && m_json.size() >= FlushSize)
+            flush();
+    }
+
+    /*! Write the serialized model/s to the given device. */
+    const auto writeJsonToDevice = [](QIODevice &device, const auto &attributes,
+                                      const QJsonDocument::JsonFormat format)
+    {
+        JsonWriter writer(format, &device);
+
+        writer.writeDocument(attributes);
+
+        return writer.flush();
+    };
+} // namespace
+
+/* public */
+
+QByteArray Json::toJson(const QVariantMap &attributes,
+                        const QJsonDocument::JsonFormat format)
+{
+    JsonWriter writer(format);
+
+    writer.writeDocument(attributes);
+
+    return std::move(writer.json());
+}
+
+QByteArray Json::toJson(const QVariantList &attributesList,
+                        const QJsonDocument::JsonFormat format)
+{
+    JsonWriter writer(format);
+
+    writer.writeDocument(attributesList);
+
+    return std::move(writer.json());
+}
+
+bool Json::toJson(QIODevice &device, const QVariantMap &attributes,
+                  const QJsonDocument::JsonFormat format)
+{
+    return writeJsonToDevice(device, attributes, format);
+}
+
+bool Json::toJson(QIODevice &device, const QVariantList &attributesList,
+                  const QJsonDocument::JsonFormat format)
+{
+    return writeJsonToDevice(device, attributesList, format);
+}
+
+} // namespace Orm::Tiny::Utils
+
+TINYORM_END_COMMON_NAMESPACE
@@ -96,6 +96,11 @@ SqlQuery::prepareDateTime(const QVariant &value) const
 
     const auto valueString = value.value<QString>();
 
+    /* All QString values are prepared for SQLite, so quickly skip values that can't be
+       a date or datetime (names, hashes, notes, ...) to avoid the expensive parsing. */
+    if (valueString.isEmpty() || !valueString.front().isDigit())
+        return std::nullopt;
+
     /* If the value is in the so-called simple format (year-month-day), then we will
        instantiate the QDate instances from this format. This is only done for date
        fields/columns, while still supporting QDateTime conversion. */
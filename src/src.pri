@@ -45,9 +45,11 @@ sourcesList += \
     $$PWD/orm/query/grammars/postgresgrammar.cpp \
     $$PWD/orm/query/grammars/sqlitegrammar.cpp \
     $$PWD/orm/query/joinclause.cpp \
+    $$PWD/orm/query/processors/postgresprocessor.cpp \
     $$PWD/orm/query/processors/processor.cpp \
     $$PWD/orm/query/processors/sqliteprocessor.cpp \
     $$PWD/orm/query/querybuilder.cpp \
+    $$PWD/orm/query/querycache.cpp \
     $$PWD/orm/schema.cpp \
     $$PWD/orm/schema/blueprint.cpp \
     $$PWD/orm/schema/foreignidcolumndefinitionreference.cpp \
@@ -62,6 +64,7 @@ sourcesList += \
     $$PWD/orm/schema/schemabuilder.cpp \
     $$PWD/orm/schema/sqliteschemabuilder.cpp \
     $$PWD/orm/sqliteconnection.cpp \
+    $$PWD/orm/support/deferredtouches.cpp \
     $$PWD/orm/types/sqlquery.cpp \
     $$PWD/orm/utils/configuration.cpp \
     $$PWD/orm/utils/fs.cpp \
@@ -78,8 +81,12 @@ sourcesList += \
         $$PWD/orm/tiny/exceptions/modelnotfounderror.cpp \
         $$PWD/orm/tiny/exceptions/relationmappingnotfounderror.cpp \
         $$PWD/orm/tiny/exceptions/relationnotloadederror.cpp \
+        $$PWD/orm/tiny/support/identitymap.cpp \
         $$PWD/orm/tiny/tinytypes.cpp \
+        $$PWD/orm/tiny/unitofwork.cpp \
         $$PWD/orm/tiny/utils/attribute.cpp \
+        $$PWD/orm/tiny/utils/cbor.cpp \
+        $$PWD/orm/tiny/utils/json.cpp \
 
 SOURCES += $$sorted(sourcesList)
 
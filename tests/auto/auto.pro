@@ -1,5 +1,6 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+    benchmarks \
     functional \
     unit \
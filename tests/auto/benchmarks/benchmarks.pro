@@ -0,0 +1,7 @@
+TEMPLATE = subdirs
+
+SUBDIRS = \
+    castattributes \
+    eagerloading \
+    hydration \
+    serialization \
@@ -0,0 +1,231 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#include "orm/db.hpp"
+#include "orm/schema.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+#include "macros.hpp"
+
+using Orm::Constants::ID;
+
+using Orm::DB;
+using Orm::Schema;
+using Orm::SchemaNs::Blueprint;
+
+using TypeUtils = Orm::Utils::Type;
+
+using Orm::Tiny::CastItem;
+using Orm::Tiny::CastType;
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Model;
+using Orm::Tiny::Types::ModelsCollection;
+
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Table name used by the benchmark. */
+    const auto BenchmarkTable = sl("benchmark_castattributes");
+
+    /*! Number of the casted columns. */
+    constexpr auto CastedColumnsCount = 20;
+
+    /*! Get the names of the casted columns. */
+    const QStringList &castedColumns()
+    {
+        static const auto cached = []
+        {
+            QStringList columns;
+            columns.reserve(CastedColumnsCount);
+
+            for (auto i = 1; i <= CastedColumnsCount; ++i)
+                columns << sl("column_%1").arg(i);
+
+            return columns;
+        }();
+
+        return cached;
+    }
+
+    /*! Get the cast type of the casted column (integer and double columns
+        alternate). */
+    constexpr QMetaType::Type castedType(const qsizetype index) noexcept
+    {
+        return index % 2 == 0 ? QMetaType::Int : QMetaType::Double;
+    }
+
+    class BenchmarkCasts final : public Model<BenchmarkCasts> // NOLINT(bugprone-exception-escape, misc-no-recursion)
+    {
+        friend Model;
+        using Model::Model;
+
+        /*! Get the casts of all the casted columns. */
+        static std::unordered_map<QString, CastItem> casts()
+        {
+            const auto &columns = castedColumns();
+
+            std::unordered_map<QString, CastItem> result;
+            result.reserve(static_cast<std::size_t>(columns.size()));
+
+            for (qsizetype i = 0; i < columns.size(); ++i)
+                result.emplace(columns.at(i), castedType(i) == QMetaType::Int
+                                              ? CastType::Integer : CastType::Double);
+
+            return result;
+        }
+
+        /*! The table associated with the model (created by the benchmark). */
+        QString u_table {BenchmarkTable};
+
+        /*! Indicates whether the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! The attributes that should be cast. */
+        inline static std::unordered_map<QString, CastItem> u_casts = casts();
+    };
+} // namespace
+
+class tst_Benchmark_CastAttributes : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void getAttribute_WithoutCastPlan() const;
+    void getAttribute_Hydrated() const;
+
+    void attributesToMap_WithoutCastPlan() const;
+    void attributesToMap_Hydrated() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Cast all the attributes of all the given models. */
+    static void castAll(const ModelsCollection<BenchmarkCasts> &models);
+
+    /*! Number of the rows in the benchmark table. */
+    constexpr static qsizetype RowsCount = 500;
+
+    /*! Connection name used in this benchmark. */
+    QString m_connection;
+    /*! The hydrated models, all of them share the resolved casts of the result. */
+    ModelsCollection<BenchmarkCasts> m_hydrated;
+    /*! The same models created one by one, the casts are resolved on every access. */
+    ModelsCollection<BenchmarkCasts> m_withoutCastPlan;
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Benchmark_CastAttributes::initTestCase()
+{
+    m_connection = Databases::createConnection(Databases::SQLITE);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    ConnectionOverride::connection = m_connection;
+
+    Schema::dropIfExists(BenchmarkTable, m_connection);
+    Schema::create(BenchmarkTable, [](Blueprint &table)
+    {
+        table.id();
+
+        for (const auto &column : castedColumns())
+            table.string(column);
+    },
+        m_connection);
+
+    QList<QString> columns {ID};
+    columns << castedColumns();
+
+    QList<QList<QVariant>> values;
+    values.reserve(RowsCount);
+
+    for (qsizetype id = 1; id <= RowsCount; ++id) {
+        QList<QVariant> row {id};
+        row.reserve(CastedColumnsCount + 1);
+
+        for (auto i = 1; i <= CastedColumnsCount; ++i)
+            row << QString::number(id * i);
+
+        values << std::move(row);
+    }
+
+    DB::table(BenchmarkTable, m_connection)->insert(columns, values);
+
+    m_hydrated = BenchmarkCasts::all();
+
+    const BenchmarkCasts instance;
+    m_withoutCastPlan.reserve(m_hydrated.size());
+
+    for (const auto &model : std::as_const(m_hydrated))
+        m_withoutCastPlan << instance.newFromBuilder(model.getAttributes(),
+                                                     m_connection);
+}
+
+void tst_Benchmark_CastAttributes::cleanupTestCase() const
+{
+    Schema::dropIfExists(BenchmarkTable, m_connection);
+}
+
+void tst_Benchmark_CastAttributes::getAttribute_WithoutCastPlan() const
+{
+    QCOMPARE(m_withoutCastPlan.size(), RowsCount);
+
+    QBENCHMARK {
+        castAll(m_withoutCastPlan);
+    }
+}
+
+void tst_Benchmark_CastAttributes::getAttribute_Hydrated() const
+{
+    QCOMPARE(m_hydrated.size(), RowsCount);
+
+    QBENCHMARK {
+        castAll(m_hydrated);
+    }
+}
+
+void tst_Benchmark_CastAttributes::attributesToMap_WithoutCastPlan() const
+{
+    QCOMPARE(m_withoutCastPlan.size(), RowsCount);
+
+    QBENCHMARK {
+        for (const auto &model : m_withoutCastPlan)
+            QCOMPARE(model.attributesToMap().size(), CastedColumnsCount + 1);
+    }
+}
+
+void tst_Benchmark_CastAttributes::attributesToMap_Hydrated() const
+{
+    QCOMPARE(m_hydrated.size(), RowsCount);
+
+    QBENCHMARK {
+        for (const auto &model : m_hydrated)
+            QCOMPARE(model.attributesToMap().size(), CastedColumnsCount + 1);
+    }
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+void tst_Benchmark_CastAttributes::castAll(
+        const ModelsCollection<BenchmarkCasts> &models)
+{
+    const auto &columns = castedColumns();
+
+    for (const auto &model : models)
+        for (qsizetype i = 0; i < columns.size(); ++i)
+            QCOMPARE(model.getAttribute(columns.at(i)).typeId(), castedType(i));
+}
+
+QTEST_MAIN(tst_Benchmark_CastAttributes)
+
+#include "tst_benchmark_castattributes.moc"
@@ -0,0 +1,5 @@
+include($$TINYORM_SOURCE_TREE/tests/qmake/common.pri)
+include($$TINYORM_SOURCE_TREE/tests/qmake/TinyUtils.pri)
+include($$TINYORM_SOURCE_TREE/tests/models/models.pri)
+
+SOURCES += tst_benchmark_eagerloading.cpp
@@ -0,0 +1,148 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+#include "macros.hpp"
+
+#include "models/torrent.hpp"
+
+using Orm::Constants::ID;
+using Orm::Constants::NAME;
+
+using TypeUtils = Orm::Utils::Type;
+
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Types::ModelsCollection;
+
+using TestUtils::Databases;
+
+using Models::Torrent;
+using Models::TorrentPreviewableFile;
+
+class tst_Benchmark_EagerLoading : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void copyResults_Files() const;
+    void match_HasMany() const;
+
+    void copyResults_Torrents() const;
+    void match_BelongsTo() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Number of the parent torrents. */
+    constexpr static auto TorrentsCount = 1000;
+    /*! Number of the torrent files of every torrent. */
+    constexpr static auto FilesCount = 5;
+
+    /*! Connection name used in this benchmark. */
+    QString m_connection;
+    /*! The torrents (in memory). */
+    ModelsCollection<Torrent> m_torrents;
+    /*! The torrent files of all the torrents (in memory). */
+    ModelsCollection<TorrentPreviewableFile> m_files;
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Benchmark_EagerLoading::initTestCase()
+{
+    m_connection = Databases::createConnection(Databases::SQLITE);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Nothing is queried, the connection is only used to create the relations
+    ConnectionOverride::connection = m_connection;
+
+    m_torrents.reserve(TorrentsCount);
+    m_files.reserve(static_cast<qsizetype>(TorrentsCount) * FilesCount);
+
+    for (auto id = 1; id <= TorrentsCount; ++id) {
+        Torrent torrent;
+        torrent.setAttribute(ID, id)
+               .setAttribute(NAME, sl("torrent %1").arg(id));
+
+        m_torrents << std::move(torrent);
+
+        for (auto index = 0; index < FilesCount; ++index) {
+            TorrentPreviewableFile file;
+            file.setAttribute(ID, (id * FilesCount) + index)
+                .setAttribute("torrent_id", id)
+                .setAttribute("file_index", index);
+
+            m_files << std::move(file);
+        }
+    }
+}
+
+/* The match() moves the related models out of the results, so every iteration
+   matches a fresh copy of the results, the copyResults_xyz() measure the copy. */
+
+void tst_Benchmark_EagerLoading::copyResults_Files() const
+{
+    QBENCHMARK {
+        auto results = m_files;
+        // Detach
+        QVERIFY(results.begin() != results.end());
+    }
+}
+
+void tst_Benchmark_EagerLoading::match_HasMany() const
+{
+    // The matched relations are set on the copies, the m_torrents stay unchanged
+    auto torrents = m_torrents;
+    auto torrentPointers = torrents.toPointers();
+
+    const auto relation = Torrent().torrentFiles();
+
+    QBENCHMARK {
+        relation->match(torrentPointers,
+                        ModelsCollection<TorrentPreviewableFile>(m_files),
+                        "torrentFiles");
+    }
+
+    QCOMPARE(torrents.first().getRelation<TorrentPreviewableFile>("torrentFiles")
+                             .size(),
+             FilesCount);
+}
+
+void tst_Benchmark_EagerLoading::copyResults_Torrents() const
+{
+    QBENCHMARK {
+        auto results = m_torrents;
+        // Detach
+        QVERIFY(results.begin() != results.end());
+    }
+}
+
+void tst_Benchmark_EagerLoading::match_BelongsTo() const
+{
+    // The matched relations are set on the copies, the m_files stay unchanged
+    auto files = m_files;
+    auto filePointers = files.toPointers();
+
+    const auto relation = TorrentPreviewableFile().torrent();
+
+    QBENCHMARK {
+        relation->match(filePointers, ModelsCollection<Torrent>(m_torrents),
+                        "torrent");
+    }
+
+    QCOMPARE(files.first().getRelation<Torrent, Orm::One>("torrent")->getKey(),
+             QVariant(1));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Benchmark_EagerLoading)
+
+#include "tst_benchmark_eagerloading.moc"
@@ -0,0 +1,211 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#  include <malloc.h>
+#  define TINY_BENCHMARK_MALLINFO2
+#endif
+
+#include "orm/db.hpp"
+#include "orm/schema.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+#include "macros.hpp"
+
+using Orm::Constants::ID;
+
+using Orm::DB;
+using Orm::Schema;
+using Orm::SchemaNs::Blueprint;
+
+using TypeUtils = Orm::Utils::Type;
+
+using Orm::Tiny::AttributeItem;
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Model;
+using Orm::Tiny::Types::ModelsCollection;
+
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Table name used by the benchmark. */
+    const auto BenchmarkTable = sl("benchmark_hydration");
+
+    class BenchmarkRow final : public Model<BenchmarkRow> // NOLINT(bugprone-exception-escape, misc-no-recursion)
+    {
+        friend Model;
+        using Model::Model;
+
+        /*! The table associated with the model (created by the benchmark). */
+        QString u_table {BenchmarkTable};
+
+        /*! Indicates whether the model should be timestamped. */
+        bool u_timestamps = false;
+    };
+} // namespace
+
+class tst_Benchmark_Hydration : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void hydrate_PerModelHash() const;
+    void hydrate_Get() const;
+
+    void memory_PerModelHash() const;
+    void memory_Get() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Create the models from the fetched rows, every model builds its own
+        attribute positions hash (how the models were hydrated before). */
+    ModelsCollection<BenchmarkRow> perModelHash() const;
+
+    /*! Number of the bytes currently allocated on the heap. */
+    static std::size_t allocatedBytes();
+
+    /*! Number of the rows in the benchmark table. */
+    constexpr static qsizetype RowsCount = 1000;
+    /*! Number of the columns (except the ID) in the benchmark table. */
+    constexpr static auto ColumnsCount = 10;
+
+    /*! Connection name used in this benchmark. */
+    QString m_connection;
+    /*! The fetched rows used to create the models. */
+    QList<QList<AttributeItem>> m_rows;
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Benchmark_Hydration::initTestCase()
+{
+    m_connection = Databases::createConnection(Databases::SQLITE);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    ConnectionOverride::connection = m_connection;
+
+    Schema::dropIfExists(BenchmarkTable, m_connection);
+    Schema::create(BenchmarkTable, [](Blueprint &table)
+    {
+        table.id();
+
+        for (auto i = 1; i <= ColumnsCount; ++i)
+            table.string(sl("column_%1").arg(i));
+    },
+        m_connection);
+
+    QList<QString> columns {ID};
+    columns.reserve(ColumnsCount + 1);
+    for (auto i = 1; i <= ColumnsCount; ++i)
+        columns << sl("column_%1").arg(i);
+
+    QList<QList<QVariant>> values;
+    values.reserve(RowsCount);
+
+    for (auto id = 1; id <= RowsCount; ++id) {
+        QList<QVariant> row {id};
+        row.reserve(ColumnsCount + 1);
+
+        for (auto i = 1; i <= ColumnsCount; ++i)
+            row << sl("value %1-%2").arg(id).arg(i);
+
+        values << std::move(row);
+    }
+
+    DB::table(BenchmarkTable, m_connection)->insert(columns, values);
+
+    for (auto &&model : BenchmarkRow::all())
+        m_rows << model.getAttributes();
+}
+
+void tst_Benchmark_Hydration::cleanupTestCase() const
+{
+    Schema::dropIfExists(BenchmarkTable, m_connection);
+}
+
+void tst_Benchmark_Hydration::hydrate_PerModelHash() const
+{
+    QBENCHMARK {
+        const auto models = perModelHash();
+        QCOMPARE(models.size(), RowsCount);
+    }
+}
+
+void tst_Benchmark_Hydration::hydrate_Get() const
+{
+    QBENCHMARK {
+        const auto models = BenchmarkRow::all();
+        QCOMPARE(models.size(), RowsCount);
+    }
+}
+
+void tst_Benchmark_Hydration::memory_PerModelHash() const
+{
+#ifdef TINY_BENCHMARK_MALLINFO2
+    const auto before = allocatedBytes();
+
+    const auto models = perModelHash();
+    QCOMPARE(models.size(), RowsCount);
+
+    QTest::setBenchmarkResult(static_cast<qreal>(allocatedBytes() - before),
+                              QTest::BytesAllocated);
+#else
+    QSKIP("The allocated bytes are measured using the glibc mallinfo2().", );
+#endif
+}
+
+void tst_Benchmark_Hydration::memory_Get() const
+{
+#ifdef TINY_BENCHMARK_MALLINFO2
+    const auto before = allocatedBytes();
+
+    // The fetched result is already freed, only the hydrated models are measured
+    const auto models = BenchmarkRow::all();
+    QCOMPARE(models.size(), RowsCount);
+
+    QTest::setBenchmarkResult(static_cast<qreal>(allocatedBytes() - before),
+                              QTest::BytesAllocated);
+#else
+    QSKIP("The allocated bytes are measured using the glibc mallinfo2().", );
+#endif
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+ModelsCollection<BenchmarkRow> tst_Benchmark_Hydration::perModelHash() const
+{
+    const BenchmarkRow instance;
+
+    ModelsCollection<BenchmarkRow> models;
+    models.reserve(m_rows.size());
+
+    for (const auto &row : m_rows)
+        models << instance.newFromBuilder(row, m_connection);
+
+    return models;
+}
+
+std::size_t tst_Benchmark_Hydration::allocatedBytes()
+{
+#ifdef TINY_BENCHMARK_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+QTEST_MAIN(tst_Benchmark_Hydration)
+
+#include "tst_benchmark_hydration.moc"
@@ -0,0 +1,166 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+#include "macros.hpp"
+
+#include "models/torrent.hpp"
+
+using Orm::Constants::HASH_;
+using Orm::Constants::ID;
+using Orm::Constants::NAME;
+using Orm::Constants::NOTE;
+using Orm::Constants::Progress;
+using Orm::Constants::SIZE_;
+
+using TypeUtils = Orm::Utils::Type;
+
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Types::ModelsCollection;
+
+using TestUtils::Databases;
+
+using Models::Torrent;
+using Models::TorrentPreviewableFile;
+
+class tst_Benchmark_Serialization : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void toJson_QJsonDocument_data() const;
+    void toJson_QJsonDocument() const;
+
+    void toJson_data() const;
+    void toJson() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Add the JSON format column and rows to the current test data. */
+    static void addFormatRows();
+
+    /*! Create the torrents with the loaded torrent files relation (in memory). */
+    static ModelsCollection<Torrent> createTorrents();
+
+    /*! Number of the torrents in the serialized collection. */
+    constexpr static auto TorrentsCount = 200;
+    /*! Number of the torrent files of every torrent. */
+    constexpr static auto FilesCount = 10;
+
+    /*! Connection name used in this benchmark. */
+    QString m_connection;
+    /*! The nested collection to serialize. */
+    ModelsCollection<Torrent> m_torrents;
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Benchmark_Serialization::initTestCase()
+{
+    m_connection = Databases::createConnection(Databases::SQLITE);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Nothing is queried, the connection is only used to format the values
+    ConnectionOverride::connection = m_connection;
+
+    m_torrents = createTorrents();
+
+    // Both ways have to produce the same JSON
+    QCOMPARE(m_torrents.toJson(),
+             m_torrents.toJsonDocument().toJson(QJsonDocument::Compact));
+}
+
+void tst_Benchmark_Serialization::toJson_QJsonDocument_data() const
+{
+    addFormatRows();
+}
+
+void tst_Benchmark_Serialization::toJson_QJsonDocument() const
+{
+    QFETCH(int, format);
+
+    const auto jsonFormat = static_cast<QJsonDocument::JsonFormat>(format);
+
+    QBENCHMARK {
+        QVERIFY(!m_torrents.toJsonDocument().toJson(jsonFormat).isEmpty());
+    }
+}
+
+void tst_Benchmark_Serialization::toJson_data() const
+{
+    addFormatRows();
+}
+
+void tst_Benchmark_Serialization::toJson() const
+{
+    QFETCH(int, format);
+
+    const auto jsonFormat = static_cast<QJsonDocument::JsonFormat>(format);
+
+    QBENCHMARK {
+        QVERIFY(!m_torrents.toJson(jsonFormat).isEmpty());
+    }
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+void tst_Benchmark_Serialization::addFormatRows()
+{
+    QTest::addColumn<int>("format");
+
+    QTest::newRow("Compact") << static_cast<int>(QJsonDocument::Compact);
+    QTest::newRow("Indented") << static_cast<int>(QJsonDocument::Indented);
+}
+
+ModelsCollection<Torrent> tst_Benchmark_Serialization::createTorrents()
+{
+    ModelsCollection<Torrent> torrents;
+    torrents.reserve(TorrentsCount);
+
+    for (auto id = 1; id <= TorrentsCount; ++id) {
+        Torrent torrent;
+        torrent.setAttribute(ID, id)
+               .setAttribute(NAME, sl("torrent %1").arg(id))
+               .setAttribute(SIZE_, id * 1024)
+               .setAttribute(Progress, id % 1000)
+               .setAttribute(HASH_, QString::number(id).repeated(40).left(40))
+               .setAttribute(NOTE, id % 2 == 0 ? QVariant(sl("note \"%1\"").arg(id))
+                                               : QVariant());
+
+        ModelsCollection<TorrentPreviewableFile> files;
+        files.reserve(FilesCount);
+
+        for (auto index = 0; index < FilesCount; ++index) {
+            TorrentPreviewableFile file;
+            file.setAttribute(ID, (id * FilesCount) + index)
+                .setAttribute("torrent_id", id)
+                .setAttribute("file_index", index)
+                .setAttribute("filepath", sl("torrent%1/file%2.mkv").arg(id).arg(index))
+                .setAttribute(SIZE_, index * 512)
+                .setAttribute(Progress, index * 50)
+                .setAttribute(NOTE, sl("ünicode ñote %1\t%2").arg(id).arg(index));
+
+            files << std::move(file);
+        }
+
+        torrent.setRelation("torrentFiles", std::move(files));
+
+        torrents << std::move(torrent);
+    }
+
+    return torrents;
+}
+
+QTEST_MAIN(tst_Benchmark_Serialization)
+
+#include "tst_benchmark_serialization.moc"
@@ -6,8 +6,10 @@
 
 #include "orm/db.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/multiplerecordsfounderror.hpp"
 #include "orm/exceptions/recordsnotfounderror.hpp"
+#include "orm/query/querycache.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -26,12 +28,15 @@ using Orm::Constants::QMYSQL;
 using Orm::Constants::SIZE_;
 using Orm::Constants::dummy_NONEXISTENT;
 
+using Orm::ChunkedWriteProgress;
 using Orm::DB;
 using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::MultipleRecordsFoundError;
 using Orm::Exceptions::RecordsNotFoundError;
 using Orm::Exceptions::RuntimeError;
 using Orm::Query::Builder;
+using Orm::Query::QueryCache;
 using Orm::TTimeZone;
 using Orm::Types::SqlQuery;
 
@@ -68,6 +73,9 @@ private Q_SLOTS:
     void insert_select_diacritic() const;
     void insert_select_emoji() const;
 
+    void insertGetIds() const;
+    void insertGetIds_WithPrimaryKey_Failed() const;
+
     /* where dates */
     void whereDate_QDate();
     void whereDate_QDateTime();
@@ -116,6 +124,17 @@ private Q_SLOTS:
 
     void limit() const;
 
+    void remember() const;
+    void remember_InvalidateOnWrite() const;
+    void remember_InvalidateOnWrite_NestedQueries() const;
+    void remember_InvalidateOnWrite_Unions() const;
+    void remember_InvalidateOnWrite_CommonTableExpressions() const;
+    void remember_WrittenTag_DeleteWithJoins() const;
+    void remember_Get_Failed() const;
+    void remember_InvalidateOnCommit() const;
+    void remember_StaleResult_NotCached() const;
+    void remember_InvalidTtl() const;
+
     /* Builds Queries */
     void sole() const;
     void sole_RecordsNotFoundError() const;
@@ -151,6 +170,11 @@ private Q_SLOTS:
     void eachById_ReturnFalse_WithAlias() const;
     void eachById_EmptyResult_WithAlias() const;
 
+    void updateInChunks() const;
+    void updateInChunks_ReturnFalse() const;
+    void updateInChunks_InvalidArguments() const;
+    void deleteInChunks() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -615,6 +639,41 @@ void tst_QueryBuilder::insert_select_emoji() const
     }
 }
 
+void tst_QueryBuilder::insertGetIds() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    // Restore the db even if the test fails
+    DB::beginTransaction(connection);
+
+    const auto ids = createQuery(connection)->from("roles")
+                     .insertGetIds({{{NAME, "ids1"}}, {{NAME, "ids2"}},
+                                    {{NAME, "ids3"}}});
+
+    QCOMPARE(ids.size(), 3);
+
+    // Every ID must belong to its own row
+    for (qsizetype index = 0; index < ids.size(); ++index)
+        QCOMPARE(createQuery(connection)->from("roles").find(ids.at(index))
+                 .value(NAME).value<QString>(),
+                 sl("ids%1").arg(index + 1));
+
+    DB::rollBack(connection);
+}
+
+void tst_QueryBuilder::insertGetIds_WithPrimaryKey_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    // The IDs can't be obtained for the rows with the primary key set by a user
+    TVERIFY_THROWS_EXCEPTION(
+                InvalidArgumentError,
+                createQuery(connection)->from("roles")
+                .insertGetIds({{{ID, 100}, {NAME, "ids1"}}}));
+
+    QVERIFY(!createQuery(connection)->from("roles").find(100).isValid());
+}
+
 /* where dates */
 
 void tst_QueryBuilder::whereDate_QDate()
@@ -1655,6 +1714,260 @@ void tst_QueryBuilder::limit() const
     }
 }
 
+void tst_QueryBuilder::remember() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    const auto names = createQuery(connection)->from("torrents")
+                       .whereBetween(ID, {1, 3})
+                       .orderBy(ID)
+                       .remember(std::chrono::seconds(60))
+                       .pluck(NAME);
+    // The same query is obtained from the query result cache
+    const auto namesCached = createQuery(connection)->from("torrents")
+                             .whereBetween(ID, {1, 3})
+                             .orderBy(ID)
+                             .remember(std::chrono::seconds(60))
+                             .pluck(NAME);
+    // Different bindings
+    const auto namesOther = createQuery(connection)->from("torrents")
+                            .whereBetween(ID, {2, 3})
+                            .orderBy(ID)
+                            .remember(std::chrono::seconds(60))
+                            .pluck(NAME);
+
+    const auto count = createQuery(connection)->from("torrents")
+                       .rememberForever()
+                       .count();
+    const auto countCached = createQuery(connection)->from("torrents")
+                             .rememberForever()
+                             .count();
+
+    DB::disableQueryLog(connection);
+
+    QCOMPARE(names, QList<QVariant>({"test1", "test2", "test3"}));
+    QCOMPARE(namesCached, names);
+    QCOMPARE(namesOther, QList<QVariant>({"test2", "test3"}));
+
+    QCOMPARE(count, static_cast<quint64>(7));
+    QCOMPARE(countCached, count);
+
+    // Two pluck queries and one count query
+    QCOMPARE(DB::getQueryLog(connection)->size(), 3);
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(3));
+
+    QueryCache::flush();
+}
+
+void tst_QueryBuilder::remember_InvalidateOnWrite() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    const auto name = [&connection]
+    {
+        return createQuery(connection)->from("torrents")
+                .whereEq(ID, 1)
+                .rememberForever()
+                .value(NAME);
+    };
+    const auto peersCount = [&connection]
+    {
+        return createQuery(connection)->from("torrent_peers")
+                .rememberForever({"peers"})
+                .count();
+    };
+
+    QCOMPARE(name(), QVariant("test1"));
+    QCOMPARE(peersCount(), static_cast<quint64>(6));
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(2));
+
+    // Only the cached results of the written table are forgotten
+    createQuery(connection)->from("torrents")
+            .whereEq(ID, 1)
+            .update({{NAME, "test1 remembered"}});
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+    QCOMPARE(name(), QVariant("test1 remembered"));
+
+    // Restore db
+    createQuery(connection)->from("torrents")
+            .whereEq(ID, 1)
+            .update({{NAME, "test1"}});
+
+    QCOMPARE(name(), QVariant("test1"));
+
+    // The user tags
+    QueryCache::flushTags({"peers"});
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    QueryCache::flush();
+}
+
+void tst_QueryBuilder::remember_InvalidateOnWrite_NestedQueries() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    const auto count = createQuery(connection)->from("torrents")
+                       .whereExists([](Builder &query)
+                       {
+                           query.from("torrent_peers")
+                                .whereColumnEq("torrent_peers.torrent_id",
+                                               "torrents.id");
+                       })
+                       .rememberForever()
+                       .count();
+
+    QCOMPARE(count, static_cast<quint64>(5));
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    // The tables of the exists queries are tagged too
+    QueryCache::flushTags({"torrent_peers"});
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(0));
+}
+
+void tst_QueryBuilder::remember_InvalidateOnWrite_Unions() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    const auto ids = createQuery(connection)->from("torrents")
+                     .select(ID)
+                     .unionAll(createQuery(connection)->from("torrent_peers").select(ID))
+                     .rememberForever()
+                     .pluck(ID);
+
+    QCOMPARE(ids.size(), 13);
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    // The tables of the unioned queries are tagged too
+    QueryCache::flushTags({"torrent_peers"});
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(0));
+}
+
+void tst_QueryBuilder::remember_InvalidateOnWrite_CommonTableExpressions() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    const auto count = createQuery(connection)->withExpression("t", [](Builder &query)
+                       {
+                           query.from("torrents");
+                       })
+                       .from("t")
+                       .rememberForever()
+                       .count();
+
+    QCOMPARE(count, static_cast<quint64>(7));
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    // The tables of the common table expressions are unknown, any write forgets them
+    createQuery(connection)->from("torrent_peers")
+            .whereEq(ID, -1)
+            .update({{"total_seeds", 1}});
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(0));
+}
+
+void tst_QueryBuilder::remember_WrittenTag_DeleteWithJoins() const
+{
+    // The alias of the deleted table isn't the table name
+    QCOMPARE(QueryCache::writtenTag(
+                 "delete `t` from `torrents` as `t` inner join `torrent_peers` "
+                 "on `t`.`id` = `torrent_peers`.`torrent_id`", {}),
+             std::make_optional<QString>("torrents"));
+
+    QCOMPARE(QueryCache::writtenTag("delete from `torrents` where `id` = ?", {}),
+             std::make_optional<QString>("torrents"));
+
+    // Multi-table delete, unknown table
+    QCOMPARE(QueryCache::writtenTag(
+                 "delete `t`, `p` from `torrents` as `t` inner join `torrent_peers` "
+                 "as `p` on `t`.`id` = `p`.`torrent_id`", {}),
+             std::make_optional<QString>(""));
+}
+
+void tst_QueryBuilder::remember_Get_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    // The SqlQuery can't be obtained from the query result cache
+    TVERIFY_THROWS_EXCEPTION(
+                LogicError,
+                createQuery(connection)->from("torrents").rememberForever().get());
+}
+
+void tst_QueryBuilder::remember_InvalidateOnCommit() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    QueryCache::flush();
+
+    DB::beginTransaction(connection);
+
+    // Nothing is updated, but the torrents table is written
+    createQuery(connection)->from("torrents")
+            .whereEq(ID, -1)
+            .update({{NAME, "test1 remembered"}});
+
+    // Another connection reads and caches the torrents table before the commit
+    QueryCache::put("tst_QueryBuilder::remember_InvalidateOnCommit", {}, std::nullopt,
+                    {"torrents"}, QueryCache::generation());
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    DB::commit(connection);
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(0));
+}
+
+void tst_QueryBuilder::remember_StaleResult_NotCached() const
+{
+    QueryCache::flush();
+
+    // Obtained before the select query
+    const auto generation = QueryCache::generation();
+
+    // The torrents table is written while the result is being read
+    QueryCache::flushTags({"torrents"});
+
+    QueryCache::put("tst_QueryBuilder::remember_StaleResult_NotCached", {},
+                    std::nullopt, {"torrents"}, generation);
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(0));
+
+    // Other tags aren't affected
+    QueryCache::put("tst_QueryBuilder::remember_StaleResult_NotCached", {},
+                    std::nullopt, {"torrent_peers"}, generation);
+
+    QCOMPARE(QueryCache::size(), static_cast<std::size_t>(1));
+
+    QueryCache::flush();
+}
+
+void tst_QueryBuilder::remember_InvalidTtl() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    TVERIFY_THROWS_EXCEPTION(
+                InvalidArgumentError,
+                createQuery(connection)->from("torrents")
+                .remember(std::chrono::seconds(0)));
+}
+
 /* Builds Queries */
 
 void tst_QueryBuilder::sole() const
@@ -2311,6 +2624,105 @@ void tst_QueryBuilder::eachById_EmptyResult_WithAlias() const
     QVERIFY(!callbackInvoked);
     QVERIFY(result);
 }
+
+void tst_QueryBuilder::updateInChunks() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    // Don't modify the file_property_properties table, it must have exactly 8 rows
+    DB::beginTransaction(connection);
+
+    QList<qint64> rows;
+
+    const auto callback = [&rows](const ChunkedWriteProgress &progress)
+    {
+        rows << progress.rows;
+
+        return true;
+    };
+
+    const auto progress = createQuery(connection)->from("file_property_properties")
+                          .where("value", GT, 2)
+                          .updateInChunks({{"value", 100}},
+                                          {.chunkSize = 4, .progress = callback});
+
+    QCOMPARE(progress.chunks, static_cast<qint64>(2));
+    QCOMPARE(progress.rows, static_cast<qint64>(6));
+    QCOMPARE(progress.affected, static_cast<qint64>(6));
+    QVERIFY(progress.completed);
+    QCOMPARE(rows, QList<qint64>({4, 6}));
+
+    QCOMPARE(createQuery(connection)->from("file_property_properties")
+             .whereEq("value", 100).count(),
+             static_cast<quint64>(6));
+
+    DB::rollBack(connection);
+}
+
+void tst_QueryBuilder::updateInChunks_ReturnFalse() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    DB::beginTransaction(connection);
+
+    const auto callback = [](const ChunkedWriteProgress &/*unused*/)
+    {
+        return false;
+    };
+
+    const auto progress = createQuery(connection)->from("file_property_properties")
+                          .where("value", GT, 2)
+                          .updateInChunks({{"value", 100}},
+                                          {.chunkSize = 4, .progress = callback});
+
+    QCOMPARE(progress.chunks, static_cast<qint64>(1));
+    QCOMPARE(progress.rows, static_cast<qint64>(4));
+    QCOMPARE(progress.affected, static_cast<qint64>(4));
+    QVERIFY(!progress.completed);
+
+    QCOMPARE(createQuery(connection)->from("file_property_properties")
+             .whereEq("value", 100).count(),
+             static_cast<quint64>(4));
+
+    DB::rollBack(connection);
+}
+
+void tst_QueryBuilder::updateInChunks_InvalidArguments() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    TVERIFY_THROWS_EXCEPTION(
+                InvalidArgumentError,
+                createQuery(connection)->from("file_property_properties")
+                .updateInChunks({{"value", 100}}, {.chunkSize = 0}));
+
+    TVERIFY_THROWS_EXCEPTION(
+                LogicError,
+                createQuery(connection)->from("file_property_properties")
+                .limit(2)
+                .updateInChunks({{"value", 100}}));
+}
+
+void tst_QueryBuilder::deleteInChunks() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    DB::beginTransaction(connection);
+
+    const auto progress = createQuery(connection)->from("file_property_properties")
+                          .where(ID, GT, 5)
+                          .deleteInChunks({.chunkSize = 2});
+
+    QCOMPARE(progress.chunks, static_cast<qint64>(2));
+    QCOMPARE(progress.rows, static_cast<qint64>(3));
+    QCOMPARE(progress.affected, static_cast<qint64>(3));
+    QVERIFY(progress.completed);
+
+    QCOMPARE(createQuery(connection)->from("file_property_properties").count(),
+             static_cast<quint64>(5));
+
+    DB::rollBack(connection);
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
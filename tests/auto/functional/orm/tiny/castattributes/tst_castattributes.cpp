@@ -108,6 +108,7 @@ private Q_SLOTS:
     void mergeCasts_const_lvalue() const;
     void mergeCasts_lvalue() const;
     void mergeCasts_rvalue() const;
+    void mergeCasts_AfterHydration() const;
 
     void withCasts_OnTinyBuilder() const;
     void withCasts_OnModel() const;
@@ -440,6 +441,28 @@ void tst_CastAttributes::mergeCasts_rvalue() const
     QVERIFY(toMerge.empty()); // NOLINT(bugprone-use-after-move)
 }
 
+void tst_CastAttributes::mergeCasts_AfterHydration() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    // The casts of the hydrated model are resolved once for the whole result
+    auto type = Type::on(connection)->find(1);
+
+    QVERIFY(type);
+    QVERIFY(!type->hasCast("smallint"));
+
+    // The resolved casts are invalidated
+    type->mergeCasts({{"smallint", CastType::UInt}});
+
+    QVERIFY(type->hasCast("smallint"));
+    QCOMPARE(type->getAttribute("smallint").typeId(), QMetaType::UInt);
+
+    // Restore
+    type->resetCasts();
+
+    QVERIFY(!type->hasCast("smallint"));
+}
+
 void tst_CastAttributes::withCasts_OnTinyBuilder() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
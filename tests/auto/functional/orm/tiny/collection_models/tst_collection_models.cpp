@@ -176,6 +176,9 @@ private Q_SLOTS:
 
     void toQuery() const;
 
+    /* Collection - Persistence related */
+    void saveAll_deleteAll() const;
+
     /* Collection - Relations related */
     void fresh_QList_WithItem() const;
     void fresh_WithSelectConstraint() const;
@@ -2227,6 +2230,59 @@ void tst_Collection_Models::toQuery() const
     QCOMPARE(result.constFirst().getAttributes().size(), 7);
 }
 
+void tst_Collection_Models::saveAll_deleteAll() const
+{
+    // Insert new models
+    ModelsCollection<AlbumImage> images {
+        AlbumImage({{NAME, "saveAll_image1"}, {"ext", "png"}, {SIZE_, 100}}),
+        AlbumImage({{NAME, "saveAll_image2"}, {"ext", "jpg"}, {SIZE_, 200}}),
+        AlbumImage({{NAME, "saveAll_image3"}, {"ext", "gif"}, {SIZE_, 300}}),
+    };
+
+    QVERIFY(images.saveAll());
+
+    for (const auto &image : images) {
+        QVERIFY(image.exists);
+        QVERIFY(!image.isDirty());
+    }
+
+    const auto ids = images.modelKeys();
+    QCOMPARE(AlbumImage::whereKey(ids)->count(), static_cast<quint64>(3));
+
+    /* Update existing models, the first two have the same dirty attributes so they
+       are updated at once, the last one is updated using another statement. */
+    images[0][SIZE_] = 101;
+    images[1][SIZE_] = 201;
+    images[2][SIZE_] = 301;
+    images[2]["ext"] = "webp";
+
+    QVERIFY(images.saveAll());
+
+    for (const auto &image : images)
+        QVERIFY(!image.isDirty());
+
+    // Validate the records in the database
+    {
+        auto imagesValidate = AlbumImage::whereKey(ids)->orderBy(ID).get();
+        QCOMPARE(imagesValidate.size(), 3);
+
+        QCOMPARE(imagesValidate.at(0).getAttribute<int>(SIZE_), 101);
+        QCOMPARE(imagesValidate.at(0).getAttribute<QString>("ext"), QString("png"));
+        QCOMPARE(imagesValidate.at(1).getAttribute<int>(SIZE_), 201);
+        QCOMPARE(imagesValidate.at(1).getAttribute<QString>("ext"), QString("jpg"));
+        QCOMPARE(imagesValidate.at(2).getAttribute<int>(SIZE_), 301);
+        QCOMPARE(imagesValidate.at(2).getAttribute<QString>("ext"), QString("webp"));
+    }
+
+    // Delete all models at once
+    QCOMPARE(images.deleteAll(), static_cast<std::size_t>(3));
+
+    for (const auto &image : images)
+        QVERIFY(!image.exists);
+
+    QVERIFY(AlbumImage::whereKey(ids)->doesntExist());
+}
+
 void tst_Collection_Models::fresh_QList_WithItem() const
 {
     auto images = AlbumImage::whereIn(ID, {1, 2, 3})->get();
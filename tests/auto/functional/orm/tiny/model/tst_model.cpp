@@ -5,6 +5,10 @@
 #include TINY_INCLUDE_TSqlDriver
 
 #include "orm/db.hpp"
+#include "orm/schema.hpp"
+#include "orm/tiny/softdeletes.hpp"
+#include "orm/tiny/support/identitymap.hpp"
+#include "orm/tiny/unitofwork.hpp"
 #include "orm/utils/nullvariant.hpp"
 #include "orm/utils/query.hpp"
 
@@ -28,6 +32,9 @@ using Orm::Constants::SIZE_;
 using Orm::Constants::UPDATED_AT;
 
 using Orm::DB;
+using Orm::Schema;
+using Orm::SchemaNs::Blueprint;
+using Orm::One;
 using Orm::TTimeZone;
 using Orm::Utils::NullVariant;
 
@@ -39,6 +46,12 @@ using TypeUtils = Orm::Utils::Type;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Exceptions::ModelNotFoundError;
 using Orm::Tiny::Model;
+using Orm::Tiny::Relations::BelongsTo;
+using Orm::Tiny::SoftDeletes;
+using Orm::Tiny::Support::IdentityMap;
+using Orm::Tiny::TypedColumn;
+using Orm::Tiny::TypedColumns;
+using Orm::Tiny::UnitOfWork;
 using Orm::Tiny::Types::ModelsCollection;
 
 using TestUtils::Databases;
@@ -70,6 +83,16 @@ private Q_SLOTS:
     void destroy() const;
     void destroyWithVector() const;
 
+    void unitOfWork_flush() const;
+    void unitOfWork_flush_RegisteredTwice_InTransaction() const;
+    void unitOfWork_flush_Associate_OwnersFirst() const;
+    void unitOfWork_flush_Failed_RestoresModels() const;
+    void identityMap_find() const;
+    void identityMap_Evict_OnSaveAndRemove() const;
+    void counterCache_SaveAndRemove() const;
+    void counterCache_SaveManyAndRemoveMany() const;
+    void counterCache_SoftDeletes() const;
+
     void all() const;
     void all_Columns() const;
 
@@ -109,6 +132,12 @@ private Q_SLOTS:
     void firstOrCreate_NotFound() const;
 
     void wasChanged() const;
+    void getOriginal_AfterSetAttribute() const;
+    void get_SharesAttributesHash() const;
+
+    void getTypedAttribute() const;
+    void setTypedAttribute() const;
+    void getTypedAttribute_Utf8ColumnName() const;
 
     void fresh_OnlyAttributes() const;
     void refresh_OnlyAttributes() const;
@@ -500,6 +529,570 @@ void tst_Model::destroyWithVector() const
     QVERIFY(torrentFile8.exists);
 }
 
+void tst_Model::unitOfWork_flush() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent1 {
+        {NAME, "uow1"}, {SIZE_, 101}, {Progress, 201}, {HASH_, "uow1hash"},
+    };
+    Torrent torrent2 {
+        {NAME, "uow2"}, {SIZE_, 102}, {Progress, 202}, {HASH_, "uow2hash"},
+    };
+    Torrent torrent3 {
+        {NAME, "uow3"}, {SIZE_, 103}, {Progress, 203}, {HASH_, "uow3hash"},
+    };
+
+    UnitOfWork unitOfWork(connection);
+
+    // Insert all new models using one multi-row insert
+    unitOfWork.save(torrent1).save(torrent2).save(torrent3);
+    QCOMPARE(unitOfWork.size(), 3);
+
+    auto statistics = unitOfWork.flush();
+
+    QVERIFY(unitOfWork.isEmpty());
+    QVERIFY(statistics.saved);
+    QCOMPARE(statistics.models, 3);
+    QCOMPARE(statistics.statements, 1);
+    QCOMPARE(statistics.statementsSaved(), 2);
+
+    QVERIFY(torrent1.exists);
+    QVERIFY(torrent2.exists);
+    QVERIFY(torrent3.exists);
+    QVERIFY(torrent1[ID]->isValid());
+    QVERIFY(torrent2[ID]->isValid());
+    QVERIFY(torrent3[ID]->isValid());
+
+    // Update the same dirty attributes using one update and delete using one delete
+    torrent1[Progress] = 301;
+    torrent2[Progress] = 302;
+
+    unitOfWork.save(torrent1).save(torrent2).remove(torrent3);
+
+    statistics = unitOfWork.flush();
+
+    QVERIFY(statistics.saved);
+    QCOMPARE(statistics.models, 3);
+    QCOMPARE(statistics.statements, 2);
+    QVERIFY(!torrent3.exists);
+
+    // Verify
+    auto torrents = Torrent::whereIn(ID, {torrent1[ID], torrent2[ID], torrent3[ID]})
+                    ->orderBy(ID)
+                    .get();
+
+    QCOMPARE(torrents.size(), 2);
+    QCOMPARE(torrents[0][ID], QVariant(torrent1[ID]));
+    QCOMPARE(torrents[0][Progress]->value<int>(), 301);
+    QCOMPARE(torrents[1][ID], QVariant(torrent2[ID]));
+    QCOMPARE(torrents[1][Progress]->value<int>(), 302);
+
+    // Restore db
+    statistics = unitOfWork.remove(torrent1).remove(torrent2).flush();
+
+    QCOMPARE(statistics.models, 2);
+    QCOMPARE(statistics.statements, 1);
+    QVERIFY(!torrent1.exists);
+    QVERIFY(!torrent2.exists);
+}
+
+void tst_Model::unitOfWork_flush_RegisteredTwice_InTransaction() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent1 {
+        {NAME, "uow4"}, {SIZE_, 104}, {Progress, 204}, {HASH_, "uow4hash"},
+    };
+    Torrent torrent2 {
+        {NAME, "uow5"}, {SIZE_, 105}, {Progress, 205}, {HASH_, "uow5hash"},
+    };
+
+    // The unit of work doesn't begin the nested transaction
+    DB::beginTransaction(connection);
+
+    UnitOfWork unitOfWork(connection);
+
+    // The same model is registered only once
+    unitOfWork.save(torrent1).save(torrent2).save(torrent1);
+    QCOMPARE(unitOfWork.size(), 2);
+
+    auto statistics = unitOfWork.flush();
+
+    QVERIFY(DB::connection(connection).inTransaction());
+    QVERIFY(statistics.saved);
+    QCOMPARE(statistics.models, 2);
+    QCOMPARE(statistics.statements, 1);
+    QVERIFY(torrent1.exists);
+    QVERIFY(torrent2.exists);
+
+    // The last registration of the same model wins
+    unitOfWork.save(torrent1).remove(torrent2).remove(torrent1);
+    QCOMPARE(unitOfWork.size(), 2);
+
+    statistics = unitOfWork.flush();
+
+    QCOMPARE(statistics.models, 2);
+    QCOMPARE(statistics.statements, 1);
+    QVERIFY(!torrent1.exists);
+    QVERIFY(!torrent2.exists);
+
+    // Restore db
+    DB::rollBack(connection);
+}
+
+void tst_Model::unitOfWork_flush_Associate_OwnersFirst() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent {
+        {NAME, "uow6"}, {SIZE_, 106}, {Progress, 206}, {HASH_, "uow6hash"},
+    };
+    TorrentPeer peer;
+    peer.setAttribute("total_seeds", 16);
+
+    UnitOfWork unitOfWork(connection);
+
+    // The child is registered before its parent
+    unitOfWork.associate(peer, &TorrentPeer::torrent, torrent).save(torrent);
+    QCOMPARE(unitOfWork.size(), 2);
+
+    auto statistics = unitOfWork.flush();
+
+    QVERIFY(statistics.saved);
+    QCOMPARE(statistics.statements, 2);
+    QVERIFY(torrent.exists);
+    QVERIFY(peer.exists);
+    // The new parent's key was copied to the child's foreign key
+    QCOMPARE(peer["torrent_id"], QVariant(torrent[ID]));
+
+    // Verify
+    auto peerVerify = TorrentPeer::find(peer.getKey());
+    QVERIFY(peerVerify);
+    QCOMPARE(peerVerify->getAttribute("torrent_id"), QVariant(torrent[ID]));
+
+    // Restore db (children are deleted first)
+    statistics = unitOfWork.remove(torrent).remove(peer).flush();
+
+    QCOMPARE(statistics.statements, 2);
+    QVERIFY(!torrent.exists);
+    QVERIFY(!peer.exists);
+}
+
+void tst_Model::unitOfWork_flush_Failed_RestoresModels() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent {
+        {NAME, "uow7"}, {SIZE_, 107}, {Progress, 207}, {HASH_, "uow7hash"},
+    };
+    TorrentPeer peer;
+    peer.setAttribute("total_seeds-NON_EXISTENT", 17);
+
+    UnitOfWork unitOfWork(connection);
+
+    unitOfWork.save(torrent).associate(peer, &TorrentPeer::torrent, torrent);
+
+    TVERIFY_THROWS_EXCEPTION(QueryError, unitOfWork.flush());
+
+    // The inserted torrent was rolled back, so it's restored
+    QVERIFY(!torrent.exists);
+    QVERIFY(!torrent.getAttributesHash().contains(ID));
+    QVERIFY(!peer.exists);
+    QVERIFY(!peer.getAttributesHash().contains("torrent_id"));
+    // The registrations are kept, so the flush can be retried
+    QCOMPARE(unitOfWork.size(), 2);
+
+    peer.unsetAttribute("total_seeds-NON_EXISTENT");
+    peer.setAttribute("total_seeds", 17);
+
+    const auto statistics = unitOfWork.flush();
+
+    QVERIFY(statistics.saved);
+    QVERIFY(torrent.exists);
+    QVERIFY(peer.exists);
+    QCOMPARE(peer["torrent_id"], QVariant(torrent[ID]));
+
+    // Restore db
+    unitOfWork.remove(torrent).remove(peer).flush();
+
+    QVERIFY(!torrent.exists);
+    QVERIFY(!peer.exists);
+}
+
+void tst_Model::identityMap_find() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    std::optional<Torrent> torrent1;
+    std::optional<Torrent> torrent1Remembered;
+    ModelsCollection<Torrent> torrents;
+    std::optional<TorrentPeer> peer;
+    std::size_t rememberedSize = 0;
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    IdentityMap::withIdentityMap([&]
+    {
+        torrent1 = Torrent::find(1);
+        // Already loaded inside the identity map scope, no query
+        torrent1Remembered = Torrent::find(1);
+        // Only the torrent ID 2 is queried
+        torrents = Torrent::findMany({1, 2});
+        // The peer is queried but the eager loaded torrent ID 1 is already loaded
+        peer = TorrentPeer::with("torrent")->find(1);
+
+        rememberedSize = IdentityMap::size();
+    });
+
+    DB::disableQueryLog(connection);
+
+    // All the remembered models are forgotten at the end of the scope
+    QVERIFY(!IdentityMap::isEnabled());
+    QCOMPARE(IdentityMap::size(), static_cast<std::size_t>(0));
+    // The peer was loaded with the relation so it isn't remembered
+    QCOMPARE(rememberedSize, static_cast<std::size_t>(2));
+
+    QVERIFY(torrent1);
+    QVERIFY(torrent1Remembered);
+    QCOMPARE((*torrent1Remembered)[ID], QVariant(1));
+    QCOMPARE((*torrent1Remembered)[NAME], QVariant("test1"));
+
+    QCOMPARE(torrents.size(), 2);
+    QCOMPARE(torrents.modelKeys<quint64>(), QList<quint64>({1, 2}));
+
+    QVERIFY(peer);
+    auto *const peerTorrent = peer->getRelation<Torrent, One>("torrent");
+    QVERIFY(peerTorrent != nullptr);
+    QCOMPARE((*peerTorrent)[ID], QVariant(1));
+
+    // find(1), findMany() for the ID 2 only, and the peer
+    const auto queryLog = DB::getQueryLog(connection);
+    QCOMPARE(queryLog->size(), 3);
+    QCOMPARE(queryLog->at(1).boundValues.size(), 1);
+}
+
+void tst_Model::identityMap_Evict_OnSaveAndRemove() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent {
+        {NAME, "identity map"}, {SIZE_, 101}, {Progress, 201},
+        {HASH_, "identitymaphash"},
+    };
+    QVERIFY(torrent.save());
+
+    std::size_t rememberedSize = 0;
+    std::size_t sizeAfterSave = 0;
+    std::size_t sizeAfterRemove = 0;
+    std::optional<Torrent> torrentSaved;
+    bool removed = false;
+
+    IdentityMap::withIdentityMap([&]
+    {
+        auto torrentRemembered = Torrent::find(torrent[ID]);
+        rememberedSize = IdentityMap::size();
+
+        // Forget the saved model
+        torrentRemembered->setAttribute(Progress, 301);
+        torrentRemembered->save();
+        sizeAfterSave = IdentityMap::size();
+
+        // Fresh model from the database
+        torrentSaved = Torrent::find(torrent[ID]);
+
+        // Forget the removed model
+        removed = torrentSaved->remove();
+        sizeAfterRemove = IdentityMap::size();
+    });
+
+    QCOMPARE(rememberedSize, static_cast<std::size_t>(1));
+    QCOMPARE(sizeAfterSave, static_cast<std::size_t>(0));
+    QCOMPARE(sizeAfterRemove, static_cast<std::size_t>(0));
+
+    QVERIFY(torrentSaved);
+    QCOMPARE((*torrentSaved)[Progress]->value<int>(), 301);
+
+    QVERIFY(removed);
+    QVERIFY(!Torrent::find(torrent[ID]));
+}
+
+namespace
+{
+    class TorrentPeer_CounterCache final : // NOLINT(bugprone-exception-escape, misc-no-recursion)
+            public Model<TorrentPeer_CounterCache, Torrent>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get a torrent that owns the torrent peer. */
+        std::unique_ptr<BelongsTo<TorrentPeer_CounterCache, Torrent>>
+        torrent()
+        {
+            return belongsTo<Torrent>("torrent_id");
+        }
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"torrent_peers"};
+
+        /*! Map of relation names to methods. */
+        QHash<QString, RelationVisitor> u_relations {
+            {"torrent", [](auto &v) { v(&TorrentPeer_CounterCache::torrent); }},
+        };
+
+        /*! The torrent's size column is used as the counter of its peers. */
+        QHash<QString, QString> u_counterCaches {
+            {"torrent", SIZE_},
+        };
+    };
+} // namespace
+
+void tst_Model::counterCache_SaveAndRemove() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent1 {{NAME, "counter cache 1"}, {HASH_, "countercache1hash"}};
+    QVERIFY(torrent1.save());
+    Torrent torrent2 {{NAME, "counter cache 2"}, {HASH_, "countercache2hash"}};
+    QVERIFY(torrent2.save());
+
+    const auto counter = [](const Torrent &torrent)
+    {
+        return Torrent::findOrFail(torrent.getKey()).getAttribute(SIZE_);
+    };
+
+    TorrentPeer_CounterCache peer1;
+    peer1.setAttribute("torrent_id", torrent1.getKey())
+         .setAttribute("leechers", 1).setAttribute("total_leechers", 1);
+    QVERIFY(peer1.save());
+
+    TorrentPeer_CounterCache peer2;
+    peer2.setAttribute("torrent_id", torrent1.getKey())
+         .setAttribute("leechers", 2).setAttribute("total_leechers", 2);
+    QVERIFY(peer2.save());
+
+    QCOMPARE(counter(torrent1), QVariant(2));
+    QCOMPARE(counter(torrent2), QVariant(0));
+
+    // Changed owner, the original owner is decremented and the new one incremented
+    peer2.setAttribute("torrent_id", torrent2.getKey());
+    QVERIFY(peer2.save());
+
+    QCOMPARE(counter(torrent1), QVariant(1));
+    QCOMPARE(counter(torrent2), QVariant(1));
+
+    // The same owner, no counter is updated
+    peer1.setAttribute("leechers", 3);
+    QVERIFY(peer1.save());
+
+    QCOMPARE(counter(torrent1), QVariant(1));
+    QCOMPARE(counter(torrent2), QVariant(1));
+
+    QVERIFY(peer1.remove());
+    QVERIFY(peer2.remove());
+
+    QCOMPARE(counter(torrent1), QVariant(0));
+    QCOMPARE(counter(torrent2), QVariant(0));
+
+    // Restore the database
+    QVERIFY(torrent1.remove());
+    QVERIFY(torrent2.remove());
+}
+
+void tst_Model::counterCache_SaveManyAndRemoveMany() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent1 {{NAME, "counter cache 1"}, {HASH_, "countercache1hash"}};
+    QVERIFY(torrent1.save());
+    Torrent torrent2 {{NAME, "counter cache 2"}, {HASH_, "countercache2hash"}};
+    QVERIFY(torrent2.save());
+
+    const auto counter = [](const Torrent &torrent)
+    {
+        return Torrent::findOrFail(torrent.getKey()).getAttribute(SIZE_);
+    };
+
+    TorrentPeer_CounterCache peer1;
+    peer1.setAttribute("torrent_id", torrent1.getKey())
+         .setAttribute("leechers", 1).setAttribute("total_leechers", 1);
+    TorrentPeer_CounterCache peer2;
+    peer2.setAttribute("torrent_id", torrent1.getKey())
+         .setAttribute("leechers", 2).setAttribute("total_leechers", 2);
+    TorrentPeer_CounterCache peer3;
+    peer3.setAttribute("torrent_id", torrent2.getKey())
+         .setAttribute("leechers", 3).setAttribute("total_leechers", 3);
+
+    // Number of the counter updates of the owners (the torrents table)
+    const auto counterUpdates = [&connection]
+    {
+        const auto queryLog = DB::getQueryLog(connection);
+
+        return static_cast<int>(std::ranges::count_if(*queryLog, [](const auto &log)
+        {
+            return log.query.startsWith("update ") && log.query.contains("torrents");
+        }));
+    };
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    // The batch write updates the counter of every owner only once
+    QVERIFY(TorrentPeer_CounterCache::saveMany({&peer1, &peer2, &peer3}));
+
+    QCOMPARE(counterUpdates(), 2);
+    DB::flushQueryLog(connection);
+
+    QCOMPARE(counter(torrent1), QVariant(2));
+    QCOMPARE(counter(torrent2), QVariant(1));
+
+    // Changed owner and the clean model
+    peer2.setAttribute("torrent_id", torrent2.getKey());
+    QVERIFY(TorrentPeer_CounterCache::saveMany({&peer1, &peer2}));
+
+    QCOMPARE(counterUpdates(), 2);
+    DB::flushQueryLog(connection);
+
+    QCOMPARE(counter(torrent1), QVariant(1));
+    QCOMPARE(counter(torrent2), QVariant(2));
+
+    QCOMPARE(TorrentPeer_CounterCache::removeMany({&peer1, &peer2, &peer3}),
+             static_cast<std::size_t>(3));
+
+    QCOMPARE(counterUpdates(), 2);
+    DB::disableQueryLog(connection);
+
+    QCOMPARE(counter(torrent1), QVariant(0));
+    QCOMPARE(counter(torrent2), QVariant(0));
+
+    // Restore the database
+    QVERIFY(torrent1.remove());
+    QVERIFY(torrent2.remove());
+}
+
+namespace
+{
+    class TorrentPeer_CounterCache_SoftDeletes final : // NOLINT(bugprone-exception-escape, misc-no-recursion)
+            public Model<TorrentPeer_CounterCache_SoftDeletes, Torrent>,
+            public SoftDeletes<TorrentPeer_CounterCache_SoftDeletes>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get a torrent that owns the torrent peer. */
+        std::unique_ptr<BelongsTo<TorrentPeer_CounterCache_SoftDeletes, Torrent>>
+        torrent()
+        {
+            return belongsTo<Torrent>("torrent_id");
+        }
+
+    private:
+        /*! The table associated with the model (created by the test). */
+        QString u_table {"counter_cache_peers"};
+
+        /*! Indicates whether the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! Map of relation names to methods. */
+        QHash<QString, RelationVisitor> u_relations {
+            {"torrent", [](auto &v) { v(&TorrentPeer_CounterCache_SoftDeletes::torrent); }},
+        };
+
+        /*! The torrent's size column is used as the counter of its peers. */
+        QHash<QString, QString> u_counterCaches {
+            {"torrent", SIZE_},
+        };
+    };
+} // namespace
+
+void tst_Model::counterCache_SoftDeletes() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // The soft-deletable peers table
+    Schema::dropIfExists("counter_cache_peers", connection);
+    Schema::create("counter_cache_peers", [](Blueprint &table)
+    {
+        table.id();
+
+        table.unsignedBigInteger("torrent_id").nullable();
+        table.softDeletes();
+    },
+        connection);
+
+    Torrent torrent {{NAME, "counter cache 1"}, {HASH_, "countercache1hash"}};
+    QVERIFY(torrent.save());
+
+    const auto counter = [&torrent]
+    {
+        return Torrent::findOrFail(torrent.getKey()).getAttribute(SIZE_);
+    };
+
+    TorrentPeer_CounterCache_SoftDeletes peer1;
+    peer1.setAttribute("torrent_id", torrent.getKey());
+    QVERIFY(peer1.save());
+
+    TorrentPeer_CounterCache_SoftDeletes peer2;
+    peer2.setAttribute("torrent_id", torrent.getKey());
+    QVERIFY(peer2.save());
+
+    QCOMPARE(counter(), QVariant(2));
+
+    // Soft delete decrements the counter
+    QVERIFY(peer1.remove());
+    QVERIFY(peer1.trashed());
+
+    QCOMPARE(counter(), QVariant(1));
+
+    // Restore increments the counter
+    QVERIFY(peer1.restore());
+    QVERIFY(!peer1.trashed());
+
+    QCOMPARE(counter(), QVariant(2));
+
+    // Force deleting the soft-deleted model doesn't decrement the counter again
+    QVERIFY(peer1.remove());
+    QCOMPARE(counter(), QVariant(1));
+
+    QVERIFY(peer1.forceDelete());
+    QVERIFY(!peer1.exists);
+
+    QCOMPARE(counter(), QVariant(1));
+
+    // Force deleting the model that isn't trashed decrements the counter
+    QVERIFY(peer2.forceDelete());
+    QVERIFY(!peer2.exists);
+
+    QCOMPARE(counter(), QVariant(0));
+
+    // Restore the database
+    QVERIFY(torrent.remove());
+
+    Schema::drop("counter_cache_peers", connection);
+}
+
 void tst_Model::all() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
@@ -1236,6 +1829,141 @@ void tst_Model::wasChanged() const
     torrent->save();
 }
 
+void tst_Model::get_SharesAttributesHash() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = Torrent::whereIn(ID, {1, 2})->orderBy(ID).get();
+    QCOMPARE(torrents.size(), 2);
+
+    auto &torrent1 = torrents[0];
+    auto &torrent2 = torrents[1];
+
+    // All the hydrated models share the attributes hash of the first model
+    QCOMPARE(&torrent1.getAttributesHash(), &torrent2.getAttributesHash());
+
+    // Adding an attribute makes a private copy
+    torrent2.setAttribute("tinyorm_test_only", 1);
+
+    QVERIFY(&torrent1.getAttributesHash() != &torrent2.getAttributesHash());
+    QVERIFY(!torrent1.getAttributesHash().contains("tinyorm_test_only"));
+    QVERIFY(torrent2.getAttributesHash().contains("tinyorm_test_only"));
+
+    QCOMPARE(torrent1.getAttribute(NAME), QVariant("test1"));
+    QCOMPARE(torrent2.getAttribute(NAME), QVariant("test2"));
+    QCOMPARE(torrent2.getAttribute("tinyorm_test_only"), QVariant(1));
+}
+
+void tst_Model::getOriginal_AfterSetAttribute() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrent = Torrent::find(3);
+
+    QVERIFY(!torrent->isDirty());
+    QCOMPARE(torrent->getRawOriginal(NAME), QVariant("test3"));
+    QVERIFY(torrent->getOriginalsHash().contains(NAME));
+
+    torrent->setAttribute(NAME, "test3 changed");
+
+    // The original attributes must stay untouched after the attribute was changed
+    QVERIFY(torrent->isDirty(NAME));
+    QVERIFY(!torrent->isDirty(SIZE_));
+    QCOMPARE(torrent->getAttribute(NAME), QVariant("test3 changed"));
+    QCOMPARE(torrent->getRawOriginal(NAME), QVariant("test3"));
+    QCOMPARE(torrent->getOriginal(NAME), QVariant("test3"));
+    QCOMPARE(torrent->getRawOriginals().size(), torrent->getAttributes().size());
+}
+
+void tst_Model::getTypedAttribute() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = Torrent::whereIn(ID, {2, 3})->orderBy(ID).get();
+
+    QCOMPARE(torrents.size(), 2);
+
+    for (const auto &torrent : torrents) {
+        const auto id = torrent.getTypedAttribute<"id">();
+
+        QCOMPARE(id, torrent.getKeyCasted());
+        QCOMPARE(torrent.getTypedAttribute<"name">(), QStringLiteral("test%1").arg(id));
+        QCOMPARE(torrent.getTypedAttribute<"size">(), 10 + id);
+        QCOMPARE(torrent.getTypedAttribute<"progress">(), static_cast<int>(id) * 100);
+    }
+
+    // Different attributes layout
+    auto torrent = Torrent::select({NAME, ID})->find(3);
+
+    QVERIFY(torrent);
+    QCOMPARE(torrent->getTypedAttribute<"id">(), static_cast<quint64>(3));
+    QCOMPARE(torrent->getTypedAttribute<"name">(), QString("test3"));
+    // Not selected, the default value of the declared type is returned
+    QCOMPARE(torrent->getTypedAttribute<"size">(), static_cast<quint64>(0));
+}
+
+void tst_Model::setTypedAttribute() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrent = Torrent::find(3);
+
+    torrent->setTypedAttribute<"progress">(333);
+
+    QVERIFY(torrent->isDirty(Progress));
+    QCOMPARE(torrent->getTypedAttribute<"progress">(), 333);
+    QCOMPARE(torrent->getAttribute(Progress), QVariant(333));
+    QCOMPARE(torrent->getRawOriginal(Progress).value<int>(), 300);
+
+    // The typed slot is cleared by the dynamic write too
+    torrent->setAttribute(Progress, 334);
+
+    QCOMPARE(torrent->getTypedAttribute<"progress">(), 334);
+
+    // The copy has its own typed slots
+    auto copy = *torrent;
+    copy.setAttribute(Progress, 335);
+
+    QCOMPARE(copy.getTypedAttribute<"progress">(), 335);
+    QCOMPARE(torrent->getTypedAttribute<"progress">(), 334);
+}
+
+namespace
+{
+    class TypedColumns_Utf8 final : public Model<TypedColumns_Utf8> // NOLINT(bugprone-exception-escape, misc-no-recursion)
+    {
+        friend Model;
+        using Model::Model;
+
+        /*! The columns declared at compile-time (non-ASCII column name). */
+        using Columns = TypedColumns<TypedColumn<"počet", int>,
+                                     TypedColumn<"pocet", int>>;
+    };
+} // namespace
+
+void tst_Model::getTypedAttribute_Utf8ColumnName() const
+{
+    TypedColumns_Utf8 model;
+    model.setAttribute(QStringLiteral("počet"), 5);
+
+    QCOMPARE(model.getTypedAttribute<"počet">(), 5);
+    // The first letters are the same, but the column isn't the same
+    QCOMPARE(model.getTypedAttribute<"pocet">(), 0);
+
+    model.setAttribute(QStringLiteral("pocet"), 6);
+
+    QCOMPARE(model.getTypedAttribute<"počet">(), 5);
+    QCOMPARE(model.getTypedAttribute<"pocet">(), 6);
+}
+
 void tst_Model::fresh_OnlyAttributes() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
@@ -6,6 +6,8 @@
 #endif
 
 #include "orm/db.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/query/querycache.hpp"
 #include "orm/utils/query.hpp"
 
 #include "databases.hpp"
@@ -21,6 +23,8 @@
 
 using Orm::Constants::ASTERISK;
 using Orm::Constants::CREATED_AT;
+using Orm::Constants::DESC;
+using Orm::Constants::GT;
 using Orm::Constants::ID;
 using Orm::Constants::NAME;
 using Orm::Constants::Progress;
@@ -31,8 +35,10 @@ using Orm::Constants::SIZE_;
 using Orm::Constants::UPDATED_AT;
 
 using Orm::DB;
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::RuntimeError;
 using Orm::One;
+using Orm::Query::QueryCache;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
 using Orm::TTimeZone;
@@ -44,6 +50,8 @@ using Orm::Tiny::AttributeItem;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Exceptions::RelationMappingNotFoundError;
 using Orm::Tiny::Exceptions::RelationNotLoadedError;
+using Orm::Tiny::Model;
+using Orm::Tiny::Relations::HasOne;
 using Orm::Tiny::Relations::Pivot;
 using Orm::Tiny::Types::ModelsCollection;
 
@@ -65,6 +73,7 @@ using Models::TorrentPreviewableFileEager;
 using Models::TorrentPreviewableFileEager_WithDefault;
 using Models::TorrentPreviewableFileProperty;
 using Models::TorrentPreviewableFilePropertyEager;
+using Models::User;
 
 class tst_Model_Relations : public QObject // clazy:exclude=ctor-missing-parent-argument
 {
@@ -94,6 +103,18 @@ private Q_SLOTS:
     void with_HasOne() const;
     void with_HasMany() const;
     void with_BelongsTo() const;
+    void with_BelongsTo_SharedParent_DetachesOnWrite() const;
+    void withJoin_HasOne() const;
+    void withJoin_HasOne_NotFound() const;
+    void withJoin_BelongsTo() const;
+    void withJoin_HasMany_Failed() const;
+    void withJoin_WithDefault() const;
+    void withJoin_SoftDeletes() const;
+    void withJoin_HasOne_MatchesMany() const;
+    void withJoin_RelationWithWheres_Failed() const;
+    void withJoin_HasOne_MatchesMany_Limit() const;
+    void withJoin_UnqualifiedColumns() const;
+    void withJoin_Remember() const;
     void with_BelongsToMany() const;
     void with_BelongsToMany_Twice() const;
     void with_Vector_MoreRelations() const;
@@ -104,6 +125,7 @@ private Q_SLOTS:
     void with_WithSelectConstraint_BelongsToMany() const;
     void with_WithLambdaConstraint() const;
     void with_WithLambdaConstraint_BelongsToMany() const;
+    void with_WithLambdaConstraint_Limit_PerParent() const;
 
     void with_NestedRelations() const;
     void with_NestedRelations_WithSelectConstraint_HasOne() const;
@@ -742,6 +764,395 @@ void tst_Model_Relations::with_BelongsTo() const
     QCOMPARE(typeid (file), typeid (TorrentPreviewableFile *));
 }
 
+void tst_Model_Relations::with_BelongsTo_SharedParent_DetachesOnWrite() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto files = TorrentPreviewableFile::with("torrent.torrentPeer")
+                 ->whereEq("torrent_id", 5)
+                 .orderBy(ID)
+                 .get();
+    QCOMPARE(files.size(), 3);
+
+    auto *torrent1 = files[0].getRelation<Torrent, One>("torrent");
+    auto *torrent2 = files[1].getRelation<Torrent, One>("torrent");
+    auto *torrent3 = files[2].getRelation<Torrent, One>("torrent");
+    QVERIFY(torrent1 && torrent2 && torrent3);
+    QVERIFY(torrent1 != torrent2 && torrent2 != torrent3);
+
+    // All the children share the same parent's attributes hash
+    QCOMPARE(&torrent1->getAttributesHash(), &torrent2->getAttributesHash());
+    QCOMPARE(&torrent2->getAttributesHash(), &torrent3->getAttributesHash());
+
+    // Modifying one parent copy must not affect others
+    torrent2->setAttribute("tinyorm_test_only", 1);
+    torrent3->unsetAttribute(NAME);
+
+    QVERIFY(&torrent1->getAttributesHash() != &torrent2->getAttributesHash());
+    QVERIFY(&torrent1->getAttributesHash() != &torrent3->getAttributesHash());
+
+    QVERIFY(!torrent1->getAttributesHash().contains("tinyorm_test_only"));
+    QVERIFY(torrent2->getAttributesHash().contains("tinyorm_test_only"));
+    QVERIFY(torrent1->getAttributesHash().contains(NAME));
+    QVERIFY(!torrent3->getAttributesHash().contains(NAME));
+
+    QCOMPARE(torrent1->getAttribute(NAME), QVariant("test5"));
+    QCOMPARE(torrent2->getAttribute(NAME), QVariant("test5"));
+    QVERIFY(!torrent3->getAttribute(NAME).isValid());
+    QCOMPARE(torrent2->getAttribute("tinyorm_test_only"), QVariant(1));
+
+    // All the parent copies also share the parent's loaded relations
+    QCOMPARE(&std::as_const(*torrent1).getRelations(),
+             &std::as_const(*torrent2).getRelations());
+    QCOMPARE(&std::as_const(*torrent2).getRelations(),
+             &std::as_const(*torrent3).getRelations());
+
+    // Modifying the nested relation of one parent copy must not affect others
+    auto *peer2 = torrent2->getRelation<TorrentPeer, One>("torrentPeer");
+    QVERIFY(peer2);
+    const auto seeds = peer2->getAttribute("seeds");
+    peer2->setAttribute("seeds", 100);
+
+    QVERIFY(&std::as_const(*torrent1).getRelations() !=
+            &std::as_const(*torrent2).getRelations());
+    QCOMPARE(torrent1->getRelation<TorrentPeer, One>("torrentPeer")
+                     ->getAttribute("seeds"),
+             seeds);
+    QCOMPARE(torrent3->getRelation<TorrentPeer, One>("torrentPeer")
+                     ->getAttribute("seeds"),
+             seeds);
+
+    /* The relations are unshared once the pointers to the related models were
+       obtained, so the copy made after it doesn't see the following writes. */
+    auto torrent2Copy = *torrent2;
+    peer2->setAttribute("seeds", 200);
+
+    QCOMPARE(torrent2Copy.getRelation<TorrentPeer, One>("torrentPeer")
+                         ->getAttribute("seeds"),
+             QVariant(100));
+}
+
+void tst_Model_Relations::withJoin_HasOne() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrent = Torrent::withJoin("torrentPeer")->find(2);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+    QCOMPARE(torrent->getKey(), QVariant(2));
+    QCOMPARE(torrent->getAttribute(NAME), QVariant("test2"));
+    // Marker and related columns must not be hydrated into the parent model
+    QVERIFY(!torrent->getAttributesHash().contains("tinyorm_join_torrentPeer"));
+    QVERIFY(!torrent->getAttributesHash().contains("seeds"));
+
+    QVERIFY(torrent->relationLoaded("torrentPeer"));
+    auto *peer = torrent->getRelation<TorrentPeer, One>("torrentPeer");
+    QVERIFY(peer);
+    QVERIFY(peer->exists);
+    QCOMPARE(peer->getKey(), QVariant(2));
+    QCOMPARE(peer->getAttribute("torrent_id"), torrent->getKey());
+    QCOMPARE(peer->getAttribute("seeds"), QVariant(2));
+    QCOMPARE(typeid (peer), typeid (TorrentPeer *));
+}
+
+void tst_Model_Relations::withJoin_HasOne_NotFound() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // Torrent with the ID 6 doesn't have any peer
+    auto torrent = Torrent::withJoin("torrentPeer")->find(6);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+    QCOMPARE(torrent->getKey(), QVariant(6));
+
+    QVERIFY(torrent->relationLoaded("torrentPeer"));
+    QVERIFY(torrent->getRelation<TorrentPeer, One>("torrentPeer") == nullptr);
+}
+
+void tst_Model_Relations::withJoin_BelongsTo() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto fileProperty = TorrentPreviewableFileProperty::withJoin("torrentFile")
+                        ->find(2);
+    QVERIFY(fileProperty);
+    QVERIFY(fileProperty->exists);
+    QCOMPARE(fileProperty->getKey(), QVariant(2));
+    QCOMPARE(fileProperty->getAttribute("previewable_file_id"), QVariant(3));
+
+    auto *file = fileProperty->getRelation<TorrentPreviewableFile, One>("torrentFile");
+    QVERIFY(file);
+    QVERIFY(file->exists);
+    QCOMPARE(file->getKey(), QVariant(3));
+    QCOMPARE(file->getAttribute("filepath"), QVariant("test2_file2.mkv"));
+    QCOMPARE(typeid (file), typeid (TorrentPreviewableFile *));
+}
+
+void tst_Model_Relations::withJoin_HasMany_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    TVERIFY_THROWS_EXCEPTION(RuntimeError,
+                             Torrent::withJoin("torrentFiles")->find(2));
+}
+
+void tst_Model_Relations::withJoin_WithDefault() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // Previewable file with the ID 9 doesn't have any torrent and file property
+    auto file = TorrentPreviewableFile::withJoin(
+                    QList<QString> {"torrent_WithVectorDefaults",
+                                    "fileProperty_WithVectorDefaults"})
+                ->find(9);
+    QVERIFY(file);
+    QVERIFY(file->exists);
+    QCOMPARE(file->getKey(), QVariant(9));
+
+    // BelongsTo
+    auto *torrent = file->getRelation<Torrent, One>("torrent_WithVectorDefaults");
+    QVERIFY(torrent);
+    QVERIFY(!torrent->exists);
+    QCOMPARE(torrent->getAttribute(NAME), QVariant("default_torrent_name"));
+    QCOMPARE(torrent->getAttribute(SIZE_), QVariant(123));
+
+    // HasOne
+    auto *fileProperty = file->getRelation<TorrentPreviewableFileProperty, One>(
+                             "fileProperty_WithVectorDefaults");
+    QVERIFY(fileProperty);
+    QVERIFY(!fileProperty->exists);
+    QCOMPARE(fileProperty->getAttribute(NAME), QVariant("default_fileproperty_name"));
+    QCOMPARE(fileProperty->getAttribute(SIZE_), QVariant(321));
+    QCOMPARE(fileProperty->getAttribute("previewable_file_id"), QVariant(9));
+}
+
+void tst_Model_Relations::withJoin_SoftDeletes() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // Don't modify the users table
+    DB::beginTransaction(connection);
+
+    // The torrent with the ID 5 belongs to the user with the ID 2
+    QVERIFY(User::findOrFail(2).remove());
+
+    auto torrent = Torrent::withJoin("user")->find(5);
+    QVERIFY(torrent);
+    QCOMPARE(torrent->getAttribute("user_id"), QVariant(2));
+
+    // The trashed user isn't loaded, the same as for the with()
+    QVERIFY(torrent->relationLoaded("user"));
+    QVERIFY(torrent->getRelation<User, One>("user") == nullptr);
+
+    DB::rollBack(connection);
+}
+
+namespace
+{
+    class Torrent_WithJoin final : // NOLINT(bugprone-exception-escape, misc-no-recursion)
+            public Model<Torrent_WithJoin, TorrentPeer, TorrentPreviewableFile>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get the first previewable file of the torrent (more files can match). */
+        std::unique_ptr<HasOne<Torrent_WithJoin, TorrentPreviewableFile>>
+        torrentFile()
+        {
+            return hasOne<TorrentPreviewableFile>("torrent_id");
+        }
+
+        /*! Get the torrent peer with more than one seed. */
+        std::unique_ptr<HasOne<Torrent_WithJoin, TorrentPeer>>
+        torrentPeer_Constrained()
+        {
+            // Ownership of a unique_ptr()
+            auto relation = hasOne<TorrentPeer>("torrent_id");
+
+            relation->where("seeds", GT, 1);
+
+            return relation;
+        }
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"torrents"};
+
+        /*! Map of relation names to methods. */
+        QHash<QString, RelationVisitor> u_relations {
+            {"torrentFile",             [](auto &v) { v(&Torrent_WithJoin::torrentFile); }},
+            {"torrentPeer_Constrained", [](auto &v) { v(&Torrent_WithJoin::torrentPeer_Constrained); }},
+        };
+    };
+} // namespace
+
+void tst_Model_Relations::withJoin_HasOne_MatchesMany() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // The torrent with the ID 5 has three previewable files
+    auto torrents = Torrent_WithJoin::withJoin("torrentFile")
+                    ->whereIn("torrents.id", {2, 5})
+                    .orderBy("torrents.id")
+                    .get();
+
+    // Only the first matched row of every torrent is hydrated
+    QCOMPARE(torrents.size(),
+             static_cast<ModelsCollection<Torrent_WithJoin>::size_type>(2));
+    QCOMPARE(torrents.at(0).getKey(), QVariant(2));
+    QCOMPARE(torrents.at(1).getKey(), QVariant(5));
+
+    for (auto &torrent : torrents) {
+        auto *file = torrent.getRelation<TorrentPreviewableFile, One>("torrentFile");
+        QVERIFY(file);
+        QVERIFY(file->exists);
+        QCOMPARE(file->getAttribute("torrent_id"), torrent.getKey());
+    }
+}
+
+void tst_Model_Relations::withJoin_RelationWithWheres_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    TVERIFY_THROWS_EXCEPTION(
+                LogicError,
+                Torrent_WithJoin::withJoin("torrentPeer_Constrained")->find(2));
+}
+
+void tst_Model_Relations::withJoin_HasOne_MatchesMany_Limit() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    /* The torrent with the ID 5 has three previewable files, the limit would count
+       the joined rows so the relation is loaded using the separate query. */
+    auto torrents = Torrent_WithJoin::withJoin("torrentFile")
+                    ->whereIn(ID, {2, 5})
+                    .orderByDesc(ID)
+                    .limit(2)
+                    .get();
+
+    DB::disableQueryLog(connection);
+
+    QCOMPARE(DB::getQueryLog(connection)->size(), 2);
+
+    QCOMPARE(torrents.size(),
+             static_cast<ModelsCollection<Torrent_WithJoin>::size_type>(2));
+    QCOMPARE(torrents.at(0).getKey(), QVariant(5));
+    QCOMPARE(torrents.at(1).getKey(), QVariant(2));
+
+    for (auto &torrent : torrents) {
+        QVERIFY(torrent.relationLoaded("torrentFile"));
+
+        auto *file = torrent.getRelation<TorrentPreviewableFile, One>("torrentFile");
+        QVERIFY(file);
+        QVERIFY(file->exists);
+        QCOMPARE(file->getAttribute("torrent_id"), torrent.getKey());
+    }
+}
+
+void tst_Model_Relations::withJoin_UnqualifiedColumns() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    /* The joined torrent_previewable_files table also has the id column, the user's
+       unqualified columns belong to the torrents table. */
+    auto builder = Torrent_WithJoin::withJoin("torrentFile");
+    builder->select({ID, NAME}).orderBy(ID)
+             .where([](auto &query)
+    {
+        query.whereIn(ID, {2, 5});
+    });
+
+    auto torrents = builder->get();
+
+    QCOMPARE(torrents.size(),
+             static_cast<ModelsCollection<Torrent_WithJoin>::size_type>(2));
+    QCOMPARE(torrents.at(0).getKey(), QVariant(2));
+    QCOMPARE(torrents.at(0).getAttribute(NAME), QVariant("test2"));
+    QCOMPARE(torrents.at(1).getKey(), QVariant(5));
+    QCOMPARE(torrents.at(1).getAttribute(NAME), QVariant("test5"));
+
+    for (auto &torrent : torrents) {
+        auto *file = torrent.getRelation<TorrentPreviewableFile, One>("torrentFile");
+        QVERIFY(file);
+        QCOMPARE(file->getAttribute("torrent_id"), torrent.getKey());
+    }
+
+    // The builder's query (also the nested query) stays unchanged
+    const auto &query = builder->getQuery();
+    QCOMPARE(std::get<QString>(query.getColumns().constFirst()), ID);
+    QCOMPARE(std::get<QString>(query.getWheres().constFirst().nestedQuery
+                               ->getWheres().constFirst().column),
+             ID);
+    QCOMPARE(builder->get().size(), torrents.size());
+}
+
+void tst_Model_Relations::withJoin_Remember() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    QueryCache::flush();
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    const auto torrentPeer = []
+    {
+        return Torrent::withJoin("torrentPeer")
+                ->remember(std::chrono::seconds(60))
+                .find(2);
+    };
+
+    auto torrent = torrentPeer();
+    // The same query is obtained from the query result cache
+    auto torrentCached = torrentPeer();
+
+    DB::disableQueryLog(connection);
+
+    QCOMPARE(DB::getQueryLog(connection)->size(), 1);
+
+    for (auto *model : {&torrent, &torrentCached}) {
+        QVERIFY(*model);
+        QCOMPARE((*model)->getKey(), QVariant(2));
+        QVERIFY(!(*model)->getAttributesHash().contains("tinyorm_join_torrentPeer"));
+
+        auto *peer = (*model)->getRelation<TorrentPeer, One>("torrentPeer");
+        QVERIFY(peer);
+        QCOMPARE(peer->getAttribute("torrent_id"), QVariant(2));
+        QCOMPARE(peer->getAttribute("seeds"), QVariant(2));
+    }
+
+    QueryCache::flush();
+}
+
 void tst_Model_Relations::with_BelongsToMany() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
@@ -1179,6 +1590,52 @@ void tst_Model_Relations::with_WithLambdaConstraint_BelongsToMany() const
     }
 }
 
+void tst_Model_Relations::with_WithLambdaConstraint_Limit_PerParent() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    // The limit is applied to every parent model (group limit), not to the whole query
+    auto torrents = Torrent::with({{"torrentFiles", [](auto &query)
+                                    {
+                                        query.orderBy(ID, DESC).limit(2);
+                                    }}})
+                    ->whereIn(ID, {2, 5, 7})
+                    .orderBy(ID)
+                    .get();
+    QCOMPARE(torrents.size(), 3);
+
+    // Expected file IDs for every torrent ID
+    std::unordered_map<quint64, QList<QVariant>> expectedFileIds {
+        {2, {3, 2}},
+        {5, {8, 7}},
+        {7, {12, 11}},
+    };
+
+    for (auto &torrent : torrents) {
+        QVERIFY(torrent.exists);
+
+        auto files = torrent.getRelation<TorrentPreviewableFile>("torrentFiles");
+        QVERIFY(files.size() <= 2);
+
+        QList<QVariant> fileIds;
+        fileIds.reserve(files.size());
+
+        for (auto *file : files) {
+            QVERIFY(file);
+            QVERIFY(file->exists);
+            QCOMPARE(file->getAttribute("torrent_id"), torrent.getKey());
+            // The internal row number column must not be hydrated
+            QVERIFY(!file->getAttributesHash().contains("tinyorm_row"));
+
+            fileIds << file->getKey();
+        }
+
+        QCOMPARE(fileIds, expectedFileIds.at(torrent.getKey().value<quint64>()));
+    }
+}
+
 void tst_Model_Relations::with_NestedRelations() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
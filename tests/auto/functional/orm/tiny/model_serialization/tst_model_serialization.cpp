@@ -1,6 +1,11 @@
+#include <QBuffer>
 #include <QCoreApplication>
+#include <QDataStream>
 #include <QTest>
 
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/tiny/utils/cbor.hpp"
+
 #include "databases.hpp"
 #include "macros.hpp"
 
@@ -21,6 +26,8 @@ using Orm::Constants::SIZE_;
 using Orm::Constants::UPDATED_AT;
 using Orm::Constants::pivot_;
 
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::One;
 using Orm::TTimeZone;
 using Orm::Utils::NullVariant;
 
@@ -30,6 +37,7 @@ using Orm::Tiny::AttributeItem;
 using Orm::Tiny::CastType;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Types::ModelsCollection;
+using Orm::Tiny::Utils::Cbor;
 
 using TestUtils::Databases;
 
@@ -44,6 +52,36 @@ using Models::TorrentPreviewableFile;
 using Models::Type;
 using Models::User;
 
+/* The user types are in the named namespace, so their type names written by the CBOR
+   serialization are the same for all compilers. */
+namespace CborTypes
+{
+    /*! The user type with the QDataStream operators. */
+    struct Point
+    {
+        int x = 0;
+        int y = 0;
+
+        bool operator==(const Point &) const = default;
+    };
+
+    QDataStream &operator<<(QDataStream &stream, const Point &point)
+    {
+        return stream << point.x << point.y;
+    }
+
+    QDataStream &operator>>(QDataStream &stream, Point &point)
+    {
+        return stream >> point.x >> point.y;
+    }
+
+    /*! The user type w/o the QDataStream operators. */
+    struct NotStreamable
+    {
+        int value = 0;
+    };
+} // namespace CborTypes
+
 class tst_Model_Serialization : public QObject // clazy:exclude=ctor-missing-parent-argument
 {
     Q_OBJECT
@@ -141,6 +179,16 @@ private Q_SLOTS:
     void toJson_RelationOnly_HasMany() const;
     void toJson_RelationOnly_BelongsToMany() const;
 
+    void toJson_SameAsQJsonDocument_Collection() const;
+    void toJson_SameAsQJsonDocument_AllTypes() const;
+    void toJson_Device() const;
+
+    void toCbor_fromCbor_WithRelations() const;
+    void toCbor_fromCbor_DirtyAttributes() const;
+    void toCbor_fromCbor_Collection_PreservesTypes() const;
+    void toCbor_fromCbor_UserType() const;
+    void toCbor_UserType_NotStreamable_Failed() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Connection name used in this test case. */
@@ -2976,6 +3024,141 @@ R"([
 
     QCOMPARE(json, expectedJson);
 }
+
+void tst_Model_Serialization::toJson_SameAsQJsonDocument_Collection() const
+{
+    auto torrents = Torrent::with({"torrentPeer", "user", "torrentFiles", "tags"})
+                    ->orderBy(ID)
+                    .get();
+    QVERIFY(!torrents.isEmpty());
+
+    QCOMPARE(torrents.toJson(),
+             torrents.toJsonDocument().toJson(QJsonDocument::Compact));
+    QCOMPARE(torrents.toJson(QJsonDocument::Indented),
+             torrents.toJsonDocument().toJson(QJsonDocument::Indented));
+}
+
+void tst_Model_Serialization::toJson_SameAsQJsonDocument_AllTypes() const
+{
+    auto types = Type::all();
+    QVERIFY(!types.isEmpty());
+
+    for (const auto &type : types) {
+        QCOMPARE(type.toJson(),
+                 type.toJsonDocument().toJson(QJsonDocument::Compact));
+        QCOMPARE(type.toJson(QJsonDocument::Indented),
+                 type.toJsonDocument().toJson(QJsonDocument::Indented));
+    }
+}
+
+void tst_Model_Serialization::toJson_Device() const
+{
+    auto torrent = Torrent::with({"torrentPeer", "user", "torrentFiles"})->find(7);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+    QVERIFY(torrent->toJson(buffer, QJsonDocument::Indented));
+
+    QCOMPARE(buffer.data(), torrent->toJson(QJsonDocument::Indented));
+}
+
+void tst_Model_Serialization::toCbor_fromCbor_WithRelations() const
+{
+    auto torrent = Torrent::with({"torrentPeer", "user", "torrentFiles", "tags"})
+                   ->find(7);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    auto restored = Torrent::fromCbor(torrent->toCbor());
+
+    QVERIFY(restored.exists);
+    QCOMPARE(restored.getAttributes(), torrent->getAttributes());
+    QCOMPARE(restored.getRelations().size(), torrent->getRelations().size());
+    QCOMPARE(restored.toMap(), torrent->toMap());
+
+    auto *torrentPeer = restored.getRelationValue<TorrentPeer, One>("torrentPeer");
+    QVERIFY(torrentPeer);
+    QVERIFY(torrentPeer->exists);
+    QCOMPARE(torrentPeer->getAttributes(),
+             (torrent->getRelationValue<TorrentPeer, One>("torrentPeer")
+              ->getAttributes()));
+}
+
+void tst_Model_Serialization::toCbor_fromCbor_DirtyAttributes() const
+{
+    auto torrent = Torrent::find(1);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    const auto originalName = torrent->getAttribute(NAME);
+    torrent->setAttribute(NAME, "test1 dirty");
+
+    auto restored = Torrent::fromCbor(torrent->toCbor());
+
+    QVERIFY(restored.isDirty(NAME));
+    QVERIFY(!restored.isDirty(SIZE_));
+    QCOMPARE(restored.getAttribute(NAME), QVariant("test1 dirty"));
+    QCOMPARE(restored.getOriginal(NAME), originalName);
+    QCOMPARE(restored.getRawOriginals(), torrent->getRawOriginals());
+}
+
+void tst_Model_Serialization::toCbor_fromCbor_Collection_PreservesTypes() const
+{
+    auto types = Type::all();
+    QVERIFY(!types.isEmpty());
+
+    auto restored = ModelsCollection<Type>::fromCbor(types.toCbor());
+    QCOMPARE(restored.size(), types.size());
+
+    for (ModelsCollection<Type>::size_type i = 0; i < types.size(); ++i) {
+        const auto &attributes = types.at(i).getAttributes();
+        const auto &restoredAttributes = restored.at(i).getAttributes();
+        QCOMPARE(restoredAttributes.size(), attributes.size());
+
+        for (QList<AttributeItem>::size_type j = 0; j < attributes.size(); ++j) {
+            const auto &[key, value] = attributes.at(j);
+            const auto &restoredAttribute = restoredAttributes.at(j);
+
+            QCOMPARE(restoredAttribute.key, key);
+            QCOMPARE(restoredAttribute.value.typeId(), value.typeId());
+            QCOMPARE(restoredAttribute.value.isNull(), value.isNull());
+
+            // NaN isn't equal to itself
+            if (value == value) // NOLINT(misc-redundant-expression)
+                QCOMPARE(restoredAttribute.value, value);
+        }
+    }
+}
+
+void tst_Model_Serialization::toCbor_fromCbor_UserType() const
+{
+    const auto value = QVariant::fromValue(CborTypes::Point {1, 2});
+
+    QByteArray cbor;
+    QCborStreamWriter writer(&cbor);
+    Cbor::writeValue(writer, value);
+
+    QCborStreamReader reader(cbor);
+    const auto restored = Cbor::readValue(reader);
+
+    // The user type is restored by its type name
+    QCOMPARE(restored.metaType(), value.metaType());
+    QVERIFY(restored.value<CborTypes::Point>() == (CborTypes::Point {1, 2}));
+}
+
+void tst_Model_Serialization::toCbor_UserType_NotStreamable_Failed() const
+{
+    QByteArray cbor;
+    QCborStreamWriter writer(&cbor);
+
+    TVERIFY_THROWS_EXCEPTION(
+                InvalidArgumentError,
+                Cbor::writeValue(writer,
+                                 QVariant::fromValue(CborTypes::NotStreamable {1})));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 QTEST_MAIN(tst_Model_Serialization)
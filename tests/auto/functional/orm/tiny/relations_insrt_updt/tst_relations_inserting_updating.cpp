@@ -1,6 +1,10 @@
 #include <QCoreApplication>
 #include <QTest>
 
+#include "orm/db.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/support/deferredtouches.hpp"
+
 #include "databases.hpp"
 #include "macros.hpp"
 
@@ -17,8 +21,11 @@ using Orm::Constants::Progress;
 using Orm::Constants::SIZE_;
 using Orm::Constants::Updated_;
 
+using Orm::DB;
 using Orm::One;
 
+using Orm::Exceptions::RuntimeError;
+
 using TQueryError;
 
 using TypeUtils = Orm::Utils::Type;
@@ -48,6 +55,8 @@ private Q_SLOTS:
     void saveMany_OnHasOneOrMany() const;
     void saveMany_OnHasOneOrMany_WithRValue() const;
     void saveMany_OnHasOneOrMany_Failed() const;
+    void saveMany_OnHasOneOrMany_DifferentAttributes_AssignsIds() const;
+    void saveMany_OnHasOneOrMany_WithPrimaryKeys_KeepsIds() const;
 
     void create_OnHasOneOrMany() const;
     void create_OnHasOneOrMany_WithRValue() const;
@@ -83,6 +92,9 @@ private Q_SLOTS:
 
     void dissociate() const;
 
+    void touchOwners_WithDeferredTouches() const;
+    void touchOwners_WithDeferredTouches_Failed() const;
+
     void attach_BasicPivot_WithIds() const;
     void attach_BasicPivot_WithModels() const;
     void attach_CustomPivot_WithIds() const;
@@ -106,6 +118,7 @@ private Q_SLOTS:
 
     void sync_BasicPivot_WithIds() const;
     void sync_BasicPivot_IdsWithAttributes() const;
+    void sync_BasicPivot_UnchangedAttributes_NotUpdated() const;
     void sync_CustomPivot_WithIds() const;
     void sync_CustomPivot_IdsWithAttributes() const;
 
@@ -408,6 +421,115 @@ void tst_Relations_Inserting_Updating::saveMany_OnHasOneOrMany_Failed() const
     QVERIFY(savedFiles.isEmpty());
 }
 
+void tst_Relations_Inserting_Updating::
+     saveMany_OnHasOneOrMany_DifferentAttributes_AssignsIds() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrent = Torrent::find(5);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    // Two multi-rows inserts, the second group doesn't have the note attribute
+    auto savedFiles = torrent->torrentFiles()->saveMany({{
+        {"file_index", 3},
+        {"filepath",   "test5_file4-saveMany-bulk.mkv"},
+        {SIZE_,        322322},
+        {Progress,     777},
+        {NOTE,         "relation's saveMany bulk file1"},
+    }, {
+        {"file_index", 4},
+        {"filepath",   "test5_file5-saveMany-bulk.mkv"},
+        {SIZE_,        333322},
+        {Progress,     888},
+    }, {
+        {"file_index", 5},
+        {"filepath",   "test5_file6-saveMany-bulk.mkv"},
+        {SIZE_,        344322},
+        {Progress,     999},
+        {NOTE,         "relation's saveMany bulk file3"},
+    }});
+    QCOMPARE(savedFiles.size(), 3);
+
+    std::unordered_set<quint64> ids;
+
+    for (auto &savedFile : savedFiles) {
+        QVERIFY(savedFile.exists);
+        QVERIFY(!savedFile.isDirty());
+        QVERIFY(savedFile[ID]->isValid());
+        QCOMPARE(savedFile["torrent_id"], QVariant(5));
+
+        // Every model must get the primary key of its own row
+        const auto fileVerify = TorrentPreviewableFile::find(savedFile[ID]);
+        QVERIFY(fileVerify);
+        QCOMPARE((*fileVerify)["filepath"], savedFile.getAttribute("filepath"));
+        QCOMPARE((*fileVerify)["file_index"], savedFile.getAttribute("file_index"));
+
+        ids.emplace(savedFile.getKeyCasted());
+    }
+    QCOMPARE(ids.size(), 3);
+
+    // Remove files, restore db
+    for (auto &savedFile : savedFiles) {
+        QVERIFY(savedFile.remove());
+        QVERIFY(!savedFile.exists);
+    }
+}
+
+void tst_Relations_Inserting_Updating::
+     saveMany_OnHasOneOrMany_WithPrimaryKeys_KeepsIds() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    auto torrent = Torrent::find(5);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    TorrentPreviewableFile file1({
+        {"file_index", 3},
+        {"filepath",   "test5_file4-saveMany-ids.mkv"},
+        {SIZE_,        322322},
+        {Progress,     777},
+    });
+    // The primary key isn't fillable
+    file1.setAttribute(ID, 1002);
+
+    TorrentPreviewableFile file2({
+        {"file_index", 4},
+        {"filepath",   "test5_file5-saveMany-ids.mkv"},
+        {SIZE_,        333322},
+        {Progress,     888},
+    });
+    file2.setAttribute(ID, 1001);
+
+    // The generated IDs must not overwrite the primary keys set by a user
+    auto savedFiles = torrent->torrentFiles()->saveMany({std::move(file1),
+                                                        std::move(file2)});
+    QCOMPARE(savedFiles.size(), 2);
+
+    QCOMPARE(savedFiles[0][ID], QVariant(1002));
+    QCOMPARE(savedFiles[1][ID], QVariant(1001));
+
+    for (auto &savedFile : savedFiles) {
+        QVERIFY(savedFile.exists);
+        QVERIFY(!savedFile.isDirty());
+
+        const auto fileVerify = TorrentPreviewableFile::find(savedFile[ID]);
+        QVERIFY(fileVerify);
+        QCOMPARE((*fileVerify)["filepath"], savedFile.getAttribute("filepath"));
+    }
+
+    // Remove files, restore db
+    for (auto &savedFile : savedFiles) {
+        QVERIFY(savedFile.remove());
+        QVERIFY(!savedFile.exists);
+    }
+}
+
 void tst_Relations_Inserting_Updating::create_OnHasOneOrMany() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
@@ -1554,6 +1676,134 @@ void tst_Relations_Inserting_Updating::dissociate() const
     QVERIFY(verifyTorrent5 == nullptr);
 }
 
+void tst_Relations_Inserting_Updating::touchOwners_WithDeferredTouches() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent {
+        {NAME, "test100"}, {SIZE_, 100}, {Progress, 555},
+        {HASH_, "xyzhash100"}, {NOTE, "deferred touches"},
+    };
+    torrent.save();
+
+    TorrentPreviewableFile file1 {
+        {"file_index", 0}, {"filepath", "test100_file1.mkv"}, {SIZE_, 1001},
+        {Progress, 101}, {NOTE, "deferred touches"},
+    };
+    TorrentPreviewableFile file2 {
+        {"file_index", 1}, {"filepath", "test100_file2.mkv"}, {SIZE_, 1002},
+        {Progress, 102}, {NOTE, "deferred touches"},
+    };
+    TorrentPreviewableFile file3 {
+        {"file_index", 2}, {"filepath", "test100_file3.mkv"}, {SIZE_, 1003},
+        {Progress, 103}, {NOTE, "deferred touches"},
+    };
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    DB::withDeferredTouches([&torrent, &file1, &file2, &file3]
+    {
+        // Every save() touches the torrent (TorrentPreviewableFile::u_touches)
+        torrent.torrentFiles()->save(file1);
+        torrent.torrentFiles()->save(file2);
+        torrent.torrentFiles()->save(file3);
+    });
+
+    DB::disableQueryLog(connection);
+
+    QVERIFY(file1.exists);
+    QVERIFY(file2.exists);
+    QVERIFY(file3.exists);
+
+    // 3 inserts and only 1 update that touches the torrent at the end
+    const auto queryLog = DB::getQueryLog(connection);
+    QCOMPARE(queryLog->size(), 4);
+
+    const auto &touchLog = queryLog->at(3);
+    QVERIFY(touchLog.query.startsWith("update "));
+    QCOMPARE(touchLog.boundValues.size(), 2);
+    QCOMPARE(touchLog.boundValues.at(1).value<quint64>(),
+             torrent[ID]->value<quint64>());
+
+    // Nothing is deferred outside of the withDeferredTouches()
+    QVERIFY(!Orm::Support::DeferredTouches::isDeferring());
+
+    // Restore db
+    QVERIFY(file1.remove());
+    QVERIFY(file2.remove());
+    QVERIFY(file3.remove());
+    QVERIFY(torrent.remove());
+}
+
+void tst_Relations_Inserting_Updating::touchOwners_WithDeferredTouches_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent1 {
+        {NAME, "test100"}, {SIZE_, 100}, {Progress, 555},
+        {HASH_, "xyzhash100"}, {NOTE, "deferred touches"},
+    };
+    torrent1.save();
+    Torrent torrent2 {
+        {NAME, "test101"}, {SIZE_, 101}, {Progress, 556},
+        {HASH_, "xyzhash101"}, {NOTE, "deferred touches"},
+    };
+    torrent2.save();
+
+    TorrentPreviewableFile file1 {
+        {"file_index", 0}, {"filepath", "test100_file1.mkv"}, {SIZE_, 1001},
+        {Progress, 101}, {NOTE, "deferred touches"},
+    };
+    TorrentPreviewableFile file2 {
+        {"file_index", 0}, {"filepath", "test101_file1.mkv"}, {SIZE_, 1011},
+        {Progress, 111}, {NOTE, "deferred touches"},
+    };
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    TVERIFY_THROWS_EXCEPTION(RuntimeError,
+                             DB::withDeferredTouches([&]
+    {
+        // Saved outside of the transaction, the torrent1 has to be touched
+        torrent1.torrentFiles()->save(file1);
+
+        // Saved in the rolled back transaction, the torrent2 can't be touched
+        DB::beginTransaction(connection);
+        torrent2.torrentFiles()->save(file2);
+        DB::rollBack(connection);
+
+        throw RuntimeError("deferred touches failed");
+    }));
+
+    DB::disableQueryLog(connection);
+
+    // Only the torrent1 is touched at the end of the failed scope
+    const auto queryLog = DB::getQueryLog(connection);
+
+    QList<QVariant> touchedIds;
+    for (const auto &log : *queryLog)
+        if (log.query.startsWith("update "))
+            touchedIds << log.boundValues.constLast();
+
+    QCOMPARE(touchedIds.size(), 1);
+    QCOMPARE(touchedIds.constFirst().value<quint64>(),
+             torrent1[ID]->value<quint64>());
+
+    // Nothing is deferred outside of the withDeferredTouches()
+    QVERIFY(!Orm::Support::DeferredTouches::isDeferring());
+
+    // Restore db
+    QVERIFY(file1.remove());
+    QVERIFY(torrent1.remove());
+    QVERIFY(torrent2.remove());
+}
+
 void tst_Relations_Inserting_Updating::attach_BasicPivot_WithIds() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
@@ -2741,6 +2991,76 @@ void tst_Relations_Inserting_Updating::sync_BasicPivot_IdsWithAttributes() const
     torrent103.remove();
 }
 
+void tst_Relations_Inserting_Updating::sync_BasicPivot_UnchangedAttributes_NotUpdated() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent100 {
+        {NAME, "test100"}, {SIZE_, 100}, {Progress, 555},
+        {HASH_, "xyzhash100"}, {NOTE, "sync with pivot"},
+    };
+    torrent100.save();
+    Torrent torrent101 {
+        {NAME, "test101"}, {SIZE_, 101}, {Progress, 556},
+        {HASH_, "xyzhash101"}, {NOTE, "sync with pivot"},
+    };
+    torrent101.save();
+    Torrent torrent102 {
+        {NAME, "test102"}, {SIZE_, 102}, {Progress, 557},
+        {HASH_, "xyzhash102"}, {NOTE, "sync with pivot"},
+    };
+    torrent102.save();
+
+    auto tag5 = Tag::find(5);
+    QVERIFY(tag5);
+    QVERIFY(tag5->exists);
+
+    const auto tagId = (*tag5)[ID];
+
+    tag5->torrents()->attach({{torrent100}, {torrent101}, {torrent102}},
+                             {{"active", true}}, false);
+
+    // Only the torrent101 and torrent102 pivots are changed
+    const auto changed = tag5->torrents()->syncWithoutDetaching(
+                             {{torrent100[ID]->value<quint64>(), {{"active", true}}},
+                              {torrent101[ID]->value<quint64>(), {{"active", false}}},
+                              {torrent102[ID]->value<quint64>(), {{"active", false}}}});
+
+    // Verify result
+    QVERIFY(changed.at(Attached).isEmpty());
+    QVERIFY(changed.at(Detached).isEmpty());
+
+    const auto &updatedVector = changed.at(Updated_);
+    QCOMPARE(updatedVector.size(), 2);
+    QVERIFY(updatedVector.contains(torrent101[ID].value()));
+    QVERIFY(updatedVector.contains(torrent102[ID].value()));
+
+    // Verify tagged values in the database
+    auto taggeds = Tagged::whereEq("tag_id", tagId)
+                   ->whereIn("torrent_id", {torrent100[ID], torrent101[ID],
+                                            torrent102[ID]})
+                   .get();
+
+    QCOMPARE(taggeds.size(), 3);
+
+    // Expected active attribute values by the tag ID
+    std::unordered_map<quint64, bool> taggedActive {
+        {torrent100[ID]->value<quint64>(), true},
+        {torrent101[ID]->value<quint64>(), false},
+        {torrent102[ID]->value<quint64>(), false},
+    };
+
+    for (auto &tagged : taggeds)
+        QCOMPARE(tagged["active"]->value<bool>(),
+                 taggedActive.at(tagged["torrent_id"]->value<quint64>()));
+
+    torrent100.remove();
+    torrent101.remove();
+    torrent102.remove();
+}
+
 void tst_Relations_Inserting_Updating::sync_CustomPivot_WithIds() const
 {
     QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
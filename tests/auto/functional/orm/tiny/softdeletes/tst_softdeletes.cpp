@@ -1,6 +1,8 @@
 #include <QCoreApplication>
 #include <QTest>
 
+#include "orm/db.hpp"
+
 #include "databases.hpp"
 
 #include "models/setting.hpp"
@@ -14,7 +16,9 @@ using Orm::Constants::UPDATED_AT;
 
 using TypeUtils = Orm::Utils::Type;
 
+using Orm::DB;
 using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Types::ModelsCollection;
 
 using TestUtils::Databases;
 
@@ -61,6 +65,10 @@ private Q_SLOTS:
     void forceDelete_NotTrashed_OnModel() const;
     void forceDelete_NotTrashed_OnTinyBuilder() const;
 
+    void deleteAll_restoreAll_forceDeleteAll_OnCollection() const;
+
+    void deleteInChunks_OnTinyBuilder() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Connection name used in this test case. */
@@ -1333,6 +1341,73 @@ void tst_SoftDeletes::forceDelete_NotTrashed_OnTinyBuilder() const
     QVERIFY(User::withTrashed()->whereKey(user1.getKey()).doesntExist());
     QVERIFY(User::withTrashed()->whereKey(user2.getKey()).doesntExist());
 }
+
+void tst_SoftDeletes::deleteAll_restoreAll_forceDeleteAll_OnCollection() const
+{
+    // Create test users
+    ModelsCollection<User> users {
+        User::create({{NAME, "liltrash-all"},
+                      {"is_banned", false},
+                      {NOTE, "deleteAll test"}}),
+        User::create({{NAME, "loltrash-all"},
+                      {"is_banned", false},
+                      {NOTE, "deleteAll test"}}),
+    };
+    QVERIFY(users.at(0).exists);
+    QVERIFY(users.at(1).exists);
+
+    const auto ids = users.modelKeys();
+
+    // Soft delete all users at once
+    QCOMPARE(users.deleteAll(), static_cast<std::size_t>(2));
+
+    for (const auto &user : users) {
+        QVERIFY(user.exists);
+        QVERIFY(user.trashed());
+        QVERIFY(!user.isDirty());
+    }
+    QCOMPARE(User::whereKey(ids)->count(), static_cast<quint64>(0));
+    QCOMPARE(User::onlyTrashed()->whereKey(ids).count(), static_cast<quint64>(2));
+
+    // Restore all users at once
+    QVERIFY(users.restoreAll());
+
+    for (const auto &user : users) {
+        QVERIFY(user.exists);
+        QVERIFY(!user.trashed());
+        QVERIFY(!user.isDirty());
+    }
+    QCOMPARE(User::whereKey(ids)->count(), static_cast<quint64>(2));
+
+    // Force delete all users at once
+    QCOMPARE(users.forceDeleteAll(), static_cast<std::size_t>(2));
+
+    for (const auto &user : users)
+        QVERIFY(!user.exists);
+
+    QVERIFY(User::withTrashed()->whereKey(ids).doesntExist());
+}
+
+void tst_SoftDeletes::deleteInChunks_OnTinyBuilder() const
+{
+    // Don't modify the users table, the soft deleted users are restored by rollBack()
+    DB::beginTransaction(m_connection);
+
+    const QList<QVariant> ids {1, 2, 3};
+
+    const auto progress = User::whereKey(ids)->deleteInChunks({.chunkSize = 2});
+
+    QCOMPARE(progress.chunks, static_cast<qint64>(2));
+    QCOMPARE(progress.rows, static_cast<qint64>(3));
+    QCOMPARE(progress.affected, static_cast<qint64>(3));
+    QVERIFY(progress.completed);
+
+    // Soft deleted only
+    QCOMPARE(User::whereKey(ids)->count(), static_cast<quint64>(0));
+    QCOMPARE(User::onlyTrashed()->whereKey(ids).count(), static_cast<quint64>(3));
+
+    DB::rollBack(m_connection);
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 QTEST_MAIN(tst_SoftDeletes)
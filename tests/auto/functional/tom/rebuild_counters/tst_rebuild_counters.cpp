@@ -0,0 +1,293 @@
+#include <QCoreApplication>
+#include <QTest>
+
+#include "orm/db.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/schema.hpp"
+#include "orm/utils/type.hpp"
+
+#include "tom/application.hpp"
+#include "tom/tomconstants.hpp"
+
+#include "databases.hpp"
+#include "macros.hpp"
+
+using Orm::Constants::ID;
+
+using Orm::DB;
+using Orm::Exceptions::RuntimeError;
+using Orm::Schema;
+using Orm::SchemaNs::Blueprint;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TomApplication = Tom::Application;
+
+using Tom::Constants::DbRebuildCounters;
+
+using TestUtils::Databases;
+
+class tst_Rebuild_Counters : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void init() const;
+    void cleanup() const;
+
+    void rebuildCounters() const;
+    void rebuildCounters_DeletedAt() const;
+    void rebuildCounters_Chunk() const;
+    void rebuildCounters_InvalidChunk_Failed() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Type used for comparing the rebuilt counters (owner ID and counter). */
+    using Counters = std::map<quint64, quint64>;
+
+    /*! Prepare arguments and invoke runCommand(). */
+    [[nodiscard]] static int
+    invokeCommand(const QString &connection, const QString &name,
+                  const std::vector<const char *> &arguments = {});
+    /*! Create a tom application instance and invoke the given command. */
+    static int runCommand(int &argc, const std::vector<const char *> &argv);
+
+    /*! Get the counters of all owners. */
+    static Counters counters(const QString &connection);
+    /*! Get the number of the executed update statements from the query log. */
+    static qsizetype updatesCount(const QString &connection);
+
+    /*! Throw if the environment is production because it needs confirmation. */
+    static void throwIfWrongEnvironment(const char *environmentEnvName);
+
+    /*! Owner table name with the counter cache column. */
+    inline static const auto OwnersTable = sl("counter_owners");
+    /*! Related (counted) table name. */
+    inline static const auto RelatedTable = sl("counter_related");
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Rebuild_Counters::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::MYSQL,
+                                                           Databases::MARIADB,
+                                                           Databases::POSTGRESQL,
+                                                           Databases::SQLITE,
+                                                          });
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkippedAny.arg(TypeUtils::classPureBasename(*this))
+                                           .toUtf8().constData(), );
+
+    QTest::addColumn<QString>("connection");
+
+    // Run all tests for all supported database connections
+    for (const auto &connection : connections)
+        QTest::newRow(connection.toUtf8().constData()) << connection;
+
+    // Obtain the command-line arguments from the runWithArguments()
+    TomApplication::enableInUnitTests();
+}
+
+void tst_Rebuild_Counters::init() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    Schema::dropIfExists(RelatedTable, connection);
+    Schema::dropIfExists(OwnersTable, connection);
+
+    Schema::create(OwnersTable, [](Blueprint &table)
+    {
+        table.id();
+
+        table.unsignedBigInteger("related_count").defaultValue(0);
+    },
+        connection);
+
+    Schema::create(RelatedTable, [](Blueprint &table)
+    {
+        table.id();
+
+        table.unsignedBigInteger("owner_id").nullable();
+        table.softDeletes();
+    },
+        connection);
+
+    // The stale counters have to be rebuilt
+    DB::table(OwnersTable, connection)->insert({ID, "related_count"},
+                                               {{1, 5}, {2, 0}, {3, 7}});
+
+    /* The owner 1 has 3 related rows (one of them is soft deleted), the owner 2 has
+       1 related row, and the owner 3 has no related rows. */
+    DB::table(RelatedTable, connection)->insert(
+                {ID, "owner_id", "deleted_at"},
+                {{1, 1, {}}, {2, 1, {}}, {3, 1, "2024-01-01 00:00:00"}, {4, 2, {}},
+                 {5, {}, {}}});
+}
+
+void tst_Rebuild_Counters::cleanup() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    Schema::dropIfExists(RelatedTable, connection);
+    Schema::dropIfExists(OwnersTable, connection);
+}
+
+void tst_Rebuild_Counters::rebuildCounters() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    const auto exitCode = invokeCommand(connection, DbRebuildCounters,
+                                        {"counter_owners", "counter_related", "owner_id",
+                                         "--column=related_count"});
+
+    QCOMPARE(exitCode, EXIT_SUCCESS);
+    QCOMPARE(counters(connection), (Counters {{1, 3}, {2, 1}, {3, 0}}));
+}
+
+void tst_Rebuild_Counters::rebuildCounters_DeletedAt() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    const auto exitCode = invokeCommand(connection, DbRebuildCounters,
+                                        {"counter_owners", "counter_related", "owner_id",
+                                         "--column=related_count",
+                                         "--deleted-at=deleted_at"});
+
+    QCOMPARE(exitCode, EXIT_SUCCESS);
+    // The soft deleted related row isn't counted
+    QCOMPARE(counters(connection), (Counters {{1, 2}, {2, 1}, {3, 0}}));
+}
+
+void tst_Rebuild_Counters::rebuildCounters_Chunk() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    DB::flushQueryLog(connection);
+    DB::enableQueryLog(connection);
+
+    const auto exitCode = invokeCommand(connection, DbRebuildCounters,
+                                        {"counter_owners", "counter_related", "owner_id",
+                                         "--column=related_count", "--chunk=2"});
+
+    DB::disableQueryLog(connection);
+
+    QCOMPARE(exitCode, EXIT_SUCCESS);
+    // One update statement for every chunk of owners
+    QCOMPARE(updatesCount(connection), 2);
+    QCOMPARE(counters(connection), (Counters {{1, 3}, {2, 1}, {3, 0}}));
+}
+
+void tst_Rebuild_Counters::rebuildCounters_InvalidChunk_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection); // NOLINT(modernize-type-traits)
+
+    const auto exitCode = invokeCommand(connection, DbRebuildCounters,
+                                        {"counter_owners", "counter_related", "owner_id",
+                                         "--column=related_count", "--chunk=0"});
+
+    QCOMPARE(exitCode, EXIT_FAILURE);
+    // Nothing was rebuilt
+    QCOMPARE(counters(connection), (Counters {{1, 5}, {2, 0}, {3, 7}}));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+int tst_Rebuild_Counters::invokeCommand(const QString &connection, const QString &name,
+                                        const std::vector<const char *> &arguments)
+{
+    static const auto connectionTmpl = sl("--database=%1");
+
+    // Prepare fake argc and argv
+    const auto nameArr = name.toUtf8();
+    // DB connection to use
+    const auto connectionArr = connectionTmpl.arg(connection).toUtf8();
+
+    std::vector<const char *> argv {
+#ifdef _WIN32
+        "tom.exe",
+#else
+        "tom",
+#endif
+        nameArr.constData(),
+        connectionArr.constData(),
+    };
+
+    argv.reserve(argv.size() + arguments.size());
+    std::ranges::copy(arguments, std::back_inserter(argv));
+
+    int argc = static_cast<int>(argv.size());
+
+    return runCommand(argc, argv);
+}
+
+int tst_Rebuild_Counters::runCommand(int &argc, const std::vector<const char *> &argv)
+{
+    // Current environment variable name
+    const auto *const environmentEnvName = "TOM_TESTS_ENV";
+
+    try {
+        // Throw if the environment is production because it needs confirmation
+        throwIfWrongEnvironment(environmentEnvName);
+
+        // env. should be always local or development
+        return TomApplication(argc, const_cast<char **>(argv.data()),
+                              Databases::managerShared(), environmentEnvName)
+                .runWithArguments({argv.cbegin(), argv.cend()});
+
+    } catch (const std::exception &e) {
+
+        TomApplication::logException(e, true);
+    }
+
+    return EXIT_FAILURE;
+}
+
+tst_Rebuild_Counters::Counters
+tst_Rebuild_Counters::counters(const QString &connection)
+{
+    auto query = DB::table(OwnersTable, connection)->orderBy(ID)
+                 .get({ID, "related_count"});
+
+    Counters result;
+
+    while (query.next())
+        result.emplace(query.value(ID).value<quint64>(),
+                       query.value("related_count").value<quint64>());
+
+    return result;
+}
+
+qsizetype tst_Rebuild_Counters::updatesCount(const QString &connection)
+{
+    const auto queryLog = DB::getQueryLog(connection);
+
+    return std::ranges::count_if(*queryLog, [](const auto &log)
+    {
+        return log.query.startsWith(QStringLiteral("update "), Qt::CaseInsensitive);
+    });
+}
+
+void tst_Rebuild_Counters::throwIfWrongEnvironment(const char *const environmentEnvName)
+{
+    const auto environment = qEnvironmentVariable(environmentEnvName);
+
+    if (environment != QLatin1String("production") &&
+        environment != QLatin1String("prod")
+    )
+        return;
+
+    throw RuntimeError(
+                sl("The '%1' environment variable can't be 'prod' or 'production' "
+                   "because production environment needs confirmation, please set it "
+                   "to any other supported value as local, development, or testing.")
+                .arg(environmentEnvName));
+}
+
+QTEST_MAIN(tst_Rebuild_Counters)
+
+#include "tst_rebuild_counters.moc"
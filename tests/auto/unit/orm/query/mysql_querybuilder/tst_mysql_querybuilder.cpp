@@ -136,6 +136,17 @@ private Q_SLOTS:
     void joinSub_QueryBuilderOverload_WithWhere() const;
     void joinSub_CallbackOverload() const;
 
+    void withExpression_QueryBuilderOverload_WithWhere() const;
+    void withExpression_CallbackOverload_Multiple() const;
+    void withRecursiveExpression_QStringOverload() const;
+
+    void union_QueryBuilderOverload() const;
+    void union_SharedPtrOverload_ModifiedAfterUnion() const;
+    void unionAll_CallbackOverload_WithOrderByLimitOffset() const;
+
+    void indexHints() const;
+    void optimizerHint() const;
+
     void where() const;
     void where_WithVectorValue() const;
     void where_WithVectorValue_DefaultCondition() const;
@@ -221,6 +232,8 @@ private Q_SLOTS:
     void limitOffset() const;
     void takeSkip() const;
     void forPage() const;
+    void groupLimit() const;
+    void groupLimit_WithOffset_OrderByRawBindings() const;
 
     void lock() const;
 
@@ -229,6 +242,8 @@ private Q_SLOTS:
 
     void update() const;
     void update_WithExpression() const;
+    void updateMany() const;
+    void updateMany_BuilderUnchanged() const;
 
     void upsert_UseUpsertAlias() const;
     void upsert_UseUpsertAlias_Disabled() const;
@@ -1352,6 +1367,183 @@ void tst_MySql_QueryBuilder::joinSub_CallbackOverload() const
              QList<QVariant>({QVariant(5), QVariant("xyz")}));
 }
 
+void tst_MySql_QueryBuilder::withExpression_QueryBuilderOverload_WithWhere() const
+{
+    auto builder = createQuery();
+
+    auto subQuery = createQuery();
+    subQuery->from("users")
+            .select({ID, NAME})
+            .where(ID, "<", 5);
+
+    builder->withExpression("active_users", *subQuery)
+            .from("active_users")
+            .whereEq(NAME, "xyz");
+
+    QCOMPARE(builder->toSql(),
+             "with `active_users` as ("
+                 "select `id`, `name` from `users` where `id` < ?) "
+             "select * from `active_users` where `name` = ?");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(5), QVariant("xyz")}));
+}
+
+void tst_MySql_QueryBuilder::withExpression_CallbackOverload_Multiple() const
+{
+    auto builder = createQuery();
+
+    builder->withExpression("u", [](auto &query)
+    {
+        query.from("users").select(ID).whereEq(NAME, "xyz");
+    })
+            .withRecursiveExpression("numbers",
+                                     "select 1 union all select n + 1 from numbers "
+                                     "where n < 10",
+                                     {"n"})
+            .from("u")
+            .where(ID, "<", 5);
+
+    QCOMPARE(builder->toSql(),
+             "with recursive `u` as (select `id` from `users` where `name` = ?), "
+             "`numbers` (`n`) as (select 1 union all select n + 1 from numbers "
+             "where n < 10) "
+             "select * from `u` where `id` < ?");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant("xyz"), QVariant(5)}));
+}
+
+void tst_MySql_QueryBuilder::withRecursiveExpression_QStringOverload() const
+{
+    auto builder = createQuery();
+
+    builder->withRecursiveExpression(
+                "tree",
+                "select id, parent_id from categories where id = 1 union all "
+                "select c.id, c.parent_id from categories c "
+                "inner join tree on tree.id = c.parent_id",
+                {ID, "parent_id"})
+            .from("tree");
+
+    QCOMPARE(builder->toSql(),
+             "with recursive `tree` (`id`, `parent_id`) as ("
+             "select id, parent_id from categories where id = 1 union all "
+             "select c.id, c.parent_id from categories c "
+             "inner join tree on tree.id = c.parent_id) "
+             "select * from `tree`");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_MySql_QueryBuilder::union_QueryBuilderOverload() const
+{
+    auto builder = createQuery();
+
+    auto unionQuery = createQuery();
+    unionQuery->select(ID).from("torrent_previewable_files").whereEq("torrent_id", 2);
+
+    builder->select(ID).from("torrents").whereEq(ID, 1).union_(*unionQuery);
+
+    QCOMPARE(builder->toSql(),
+             "(select `id` from `torrents` where `id` = ?) "
+             "union (select `id` from `torrent_previewable_files` "
+             "where `torrent_id` = ?)");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_MySql_QueryBuilder::union_SharedPtrOverload_ModifiedAfterUnion() const
+{
+    auto builder = createQuery();
+
+    auto unionQuery = createQuery();
+    unionQuery->select(ID).from("torrent_previewable_files").whereEq("torrent_id", 2);
+
+    builder->select(ID).from("torrents").whereEq(ID, 1).union_(unionQuery);
+
+    // The union query was cloned, it doesn't affect the compiled SQL nor bindings
+    unionQuery->whereEq("file_index", 0);
+
+    QCOMPARE(builder->toSql(),
+             "(select `id` from `torrents` where `id` = ?) "
+             "union (select `id` from `torrent_previewable_files` "
+             "where `torrent_id` = ?)");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_MySql_QueryBuilder::unionAll_CallbackOverload_WithOrderByLimitOffset() const
+{
+    auto builder = createQuery();
+
+    builder->select(ID).from("torrents")
+            .unionAll([](auto &query)
+    {
+        query.select(ID).from("torrent_peers");
+    })
+            .orderBy(ID, DESC).limit(5).offset(10);
+
+    QCOMPARE(builder->toSql(),
+             "(select `id` from `torrents`) "
+             "union all (select `id` from `torrent_peers`) "
+             "order by `id` desc limit 5 offset 10");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_MySql_QueryBuilder::indexHints() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").useIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` use index (torrents_name_index) "
+                 "where `id` > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").forceIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` force index (torrents_name_index) "
+                 "where `id` > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").ignoreIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` ignore index (torrents_name_index) "
+                 "where `id` > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+}
+
+void tst_MySql_QueryBuilder::optimizerHint() const
+{
+    auto builder = createQuery();
+
+    builder->select({ID, NAME}).from("torrents")
+            .optimizerHint("MAX_EXECUTION_TIME(1000)")
+            .optimizerHint("NO_INDEX_MERGE(torrents)");
+
+    QCOMPARE(builder->toSql(),
+             "select /*+ MAX_EXECUTION_TIME(1000) NO_INDEX_MERGE(torrents) */ "
+             "`id`, `name` from `torrents`");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
 void tst_MySql_QueryBuilder::where() const
 {
     {
@@ -3261,6 +3453,46 @@ void tst_MySql_QueryBuilder::forPage() const
              "select * from `torrents` limit 30 offset 120");
 }
 
+void tst_MySql_QueryBuilder::groupLimit() const
+{
+    auto builder = createQuery();
+
+    builder->from("torrent_previewable_files")
+            .whereIn("torrent_id", {1, 2})
+            .orderBy("size", DESC)
+            .groupLimit(2, "torrent_id");
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select *, row_number() over ("
+             "partition by `torrent_id` order by `size` desc) as `tinyorm_row` "
+             "from `torrent_previewable_files` where `torrent_id` in (?, ?)) "
+             "as `tinyorm_table` where `tinyorm_row` <= 2 order by `tinyorm_row`");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_MySql_QueryBuilder::groupLimit_WithOffset_OrderByRawBindings() const
+{
+    auto builder = createQuery();
+
+    builder->select({ID, "torrent_id"}).from("torrent_previewable_files")
+            .whereEq("torrent_id", 1)
+            .orderByRaw("`size` > ?", {100})
+            .offset(1)
+            .limit(5)
+            .groupLimit(3, "torrent_id");
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select `id`, `torrent_id`, row_number() over ("
+             "partition by `torrent_id` order by `size` > ?) as `tinyorm_row` "
+             "from `torrent_previewable_files` where `torrent_id` = ?) "
+             "as `tinyorm_table` where `tinyorm_row` <= 4 and `tinyorm_row` > 1 "
+             "order by `tinyorm_row`");
+    // The order by bindings have to be before the where bindings
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(100), QVariant(1)}));
+}
+
 void tst_MySql_QueryBuilder::lock() const
 {
     // lock for update
@@ -3394,6 +3626,54 @@ void tst_MySql_QueryBuilder::update_WithExpression() const
              QList<QVariant>({QVariant(6), QVariant(10)}));
 }
 
+void tst_MySql_QueryBuilder::updateMany() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        const auto [affected, query] =
+                connection.query()->from("torrents")
+                .whereEq("user_id", 1)
+                .updateMany(ID, {{{ID, 1}, {NAME, "xyz"}, {SIZE_, 11}},
+                                 {{ID, 2}, {NAME, "abc"}, {SIZE_, 12}}});
+
+        // Affecting statements must return -1 if pretending
+        QVERIFY(affected == -1);
+        QVERIFY(query);
+        QVERIFY(!query->isActive());
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "update `torrents` "
+             "set `name` = case `id` when ? then ? when ? then ? else `name` end, "
+                 "`size` = case `id` when ? then ? when ? then ? else `size` end "
+             "where `user_id` = ? and `id` in (?, ?)");
+    QCOMPARE(firstLog.boundValues,
+             QList<QVariant>({QVariant(1), QVariant("xyz"), QVariant(2), QVariant("abc"),
+                              QVariant(1), QVariant(11),    QVariant(2), QVariant(12),
+                              QVariant(1), QVariant(1),     QVariant(2)}));
+}
+
+void tst_MySql_QueryBuilder::updateMany_BuilderUnchanged() const
+{
+    auto builder = createQuery();
+
+    builder->from("torrents").whereEq("user_id", 1);
+
+    DB::connection(m_connection).pretend([&builder]
+    {
+        builder->updateMany(ID, {{{ID, 1}, {NAME, "xyz"}},
+                                 {{ID, 2}, {NAME, "abc"}}});
+    });
+
+    // The where in clause of the keys was added to the copy of the query
+    QCOMPARE(builder->toSql(), "select * from `torrents` where `user_id` = ?");
+    QCOMPARE(builder->getBindings(), QList<QVariant>({QVariant(1)}));
+}
+
 void tst_MySql_QueryBuilder::upsert_UseUpsertAlias() const
 {
     const auto configVersion = sl("8.0.19");
@@ -78,6 +78,16 @@ private Q_SLOTS:
     void joinSub_QueryBuilderOverload_WithWhere() const;
     void joinSub_CallbackOverload() const;
 
+    void withExpression_QueryBuilderOverload_WithWhere() const;
+    void withExpression_CallbackOverload_Multiple() const;
+    void withRecursiveExpression_QStringOverload() const;
+
+    void union_QueryBuilderOverload() const;
+    void unionAll_CallbackOverload_WithOrderByLimitOffset() const;
+
+    void indexHints() const;
+    void optimizerHint() const;
+
     void where() const;
     void where_WithVectorValue() const;
     void where_WithVectorValue_DefaultCondition() const;
@@ -133,6 +143,8 @@ private Q_SLOTS:
     void limitOffset() const;
     void takeSkip() const;
     void forPage() const;
+    void groupLimit() const;
+    void groupLimit_WithOffset_OrderByRawBindings() const;
 
     void lock() const;
 
@@ -141,6 +153,8 @@ private Q_SLOTS:
 
     void update() const;
     void update_WithExpression() const;
+    void update_WithCommonTableExpression_Limit() const;
+    void updateMany() const;
 
     void upsert() const;
     void upsert_WithoutUpdate_UpdateAll() const;
@@ -852,6 +866,159 @@ void tst_PostgreSQL_QueryBuilder::joinSub_CallbackOverload() const
              QList<QVariant>({QVariant(5), QVariant("xyz")}));
 }
 
+void tst_PostgreSQL_QueryBuilder::withExpression_QueryBuilderOverload_WithWhere() const
+{
+    auto builder = createQuery();
+
+    auto subQuery = createQuery();
+    subQuery->from("users")
+            .select({ID, NAME})
+            .where(ID, "<", 5);
+
+    builder->withExpression("active_users", *subQuery)
+            .from("active_users")
+            .whereEq(NAME, "xyz");
+
+    QCOMPARE(builder->toSql(),
+             "with \"active_users\" as ("
+                 "select \"id\", \"name\" from \"users\" where \"id\" < ?) "
+             "select * from \"active_users\" where \"name\" = ?");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(5), QVariant("xyz")}));
+}
+
+void tst_PostgreSQL_QueryBuilder::withExpression_CallbackOverload_Multiple() const
+{
+    auto builder = createQuery();
+
+    builder->withExpression("u", [](auto &query)
+    {
+        query.from("users").select(ID).whereEq(NAME, "xyz");
+    })
+            .withRecursiveExpression("numbers",
+                                     "select 1 union all select n + 1 from numbers "
+                                     "where n < 10",
+                                     {"n"})
+            .from("u")
+            .where(ID, "<", 5);
+
+    QCOMPARE(builder->toSql(),
+             "with recursive \"u\" as (select \"id\" from \"users\" where \"name\" = ?), "
+             "\"numbers\" (\"n\") as (select 1 union all select n + 1 from numbers "
+             "where n < 10) "
+             "select * from \"u\" where \"id\" < ?");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant("xyz"), QVariant(5)}));
+}
+
+void tst_PostgreSQL_QueryBuilder::withRecursiveExpression_QStringOverload() const
+{
+    auto builder = createQuery();
+
+    builder->withRecursiveExpression(
+                "tree",
+                "select id, parent_id from categories where id = 1 union all "
+                "select c.id, c.parent_id from categories c "
+                "inner join tree on tree.id = c.parent_id",
+                {ID, "parent_id"})
+            .from("tree");
+
+    QCOMPARE(builder->toSql(),
+             "with recursive \"tree\" (\"id\", \"parent_id\") as ("
+             "select id, parent_id from categories where id = 1 union all "
+             "select c.id, c.parent_id from categories c "
+             "inner join tree on tree.id = c.parent_id) "
+             "select * from \"tree\"");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_PostgreSQL_QueryBuilder::union_QueryBuilderOverload() const
+{
+    auto builder = createQuery();
+
+    auto unionQuery = createQuery();
+    unionQuery->select(ID).from("torrent_previewable_files").whereEq("torrent_id", 2);
+
+    builder->select(ID).from("torrents").whereEq(ID, 1).union_(*unionQuery);
+
+    QCOMPARE(builder->toSql(),
+             "(select \"id\" from \"torrents\" where \"id\" = ?) "
+             "union (select \"id\" from \"torrent_previewable_files\" "
+             "where \"torrent_id\" = ?)");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_PostgreSQL_QueryBuilder::unionAll_CallbackOverload_WithOrderByLimitOffset() const
+{
+    auto builder = createQuery();
+
+    builder->select(ID).from("torrents")
+            .unionAll([](auto &query)
+    {
+        query.select(ID).from("torrent_peers");
+    })
+            .orderBy(ID, DESC).limit(5).offset(10);
+
+    QCOMPARE(builder->toSql(),
+             "(select \"id\" from \"torrents\") "
+             "union all (select \"id\" from \"torrent_peers\") "
+             "order by \"id\" desc limit 5 offset 10");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_PostgreSQL_QueryBuilder::indexHints() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").useIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").forceIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").ignoreIndex("torrents_name_index")
+                .where(ID, ">", 3);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" > ?");
+        QCOMPARE(builder->getBindings(),
+                 QList<QVariant> {QVariant(3)});
+    }
+}
+
+void tst_PostgreSQL_QueryBuilder::optimizerHint() const
+{
+    auto builder = createQuery();
+
+    builder->select({ID, NAME}).from("torrents")
+            .optimizerHint("MAX_EXECUTION_TIME(1000)")
+            .optimizerHint("NO_INDEX_MERGE(torrents)");
+
+    QCOMPARE(builder->toSql(),
+             "select \"id\", \"name\" from \"torrents\"");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
 void tst_PostgreSQL_QueryBuilder::where() const
 {
     {
@@ -1882,6 +2049,46 @@ void tst_PostgreSQL_QueryBuilder::forPage() const
              "select * from \"torrents\" limit 30 offset 120");
 }
 
+void tst_PostgreSQL_QueryBuilder::groupLimit() const
+{
+    auto builder = createQuery();
+
+    builder->from("torrent_previewable_files")
+            .whereIn("torrent_id", {1, 2})
+            .orderBy("size", DESC)
+            .groupLimit(2, "torrent_id");
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select *, row_number() over ("
+             "partition by \"torrent_id\" order by \"size\" desc) as \"tinyorm_row\" "
+             "from \"torrent_previewable_files\" where \"torrent_id\" in (?, ?)) "
+             "as \"tinyorm_table\" where \"tinyorm_row\" <= 2 order by \"tinyorm_row\"");
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_PostgreSQL_QueryBuilder::groupLimit_WithOffset_OrderByRawBindings() const
+{
+    auto builder = createQuery();
+
+    builder->select({ID, "torrent_id"}).from("torrent_previewable_files")
+            .whereEq("torrent_id", 1)
+            .orderByRaw("\"size\" > ?", {100})
+            .offset(1)
+            .limit(5)
+            .groupLimit(3, "torrent_id");
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select \"id\", \"torrent_id\", row_number() over ("
+             "partition by \"torrent_id\" order by \"size\" > ?) as \"tinyorm_row\" "
+             "from \"torrent_previewable_files\" where \"torrent_id\" = ?) "
+             "as \"tinyorm_table\" where \"tinyorm_row\" <= 4 and \"tinyorm_row\" > 1 "
+             "order by \"tinyorm_row\"");
+    // The order by bindings have to be before the where bindings
+    QCOMPARE(builder->getBindings(),
+             QList<QVariant>({QVariant(100), QVariant(1)}));
+}
+
 void tst_PostgreSQL_QueryBuilder::lock() const
 {
     // lock for update
@@ -2016,6 +2223,69 @@ void tst_PostgreSQL_QueryBuilder::update_WithExpression() const
              QList<QVariant>({QVariant(6), QVariant(10)}));
 }
 
+void tst_PostgreSQL_QueryBuilder::update_WithCommonTableExpression_Limit() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->withExpression("ids", [](auto &query)
+        {
+            query.from("users").select(ID).where(ID, "<", 5);
+        })
+                .from("torrents")
+                .whereEq(ID, 10)
+                .limit(1)
+                .update({{NAME, "xyz"}});
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "with \"ids\" as (select \"id\" from \"users\" where \"id\" < ?) "
+             "update \"torrents\" set \"name\" = ? where \"ctid\" in ("
+                 "select \"torrents\".\"ctid\" from \"torrents\" "
+                 "where \"id\" = ? limit 1)");
+    QCOMPARE(firstLog.boundValues,
+             QList<QVariant>({QVariant(5), QVariant("xyz"), QVariant(10)}));
+}
+
+void tst_PostgreSQL_QueryBuilder::updateMany() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        const auto [affected, query] =
+                connection.query()->from("torrents")
+                .whereEq("user_id", 1)
+                .updateMany(ID, {{{ID, 1}, {NAME, "xyz"}, {SIZE_, 11}},
+                                 {{ID, 2}, {NAME, "abc"}, {SIZE_, 12}}});
+
+        // Affecting statements must return -1 if pretending
+        QVERIFY(affected == -1);
+        QVERIFY(query);
+        QVERIFY(!query->isActive());
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "update \"torrents\" "
+             "set \"name\" = \"tinyorm_update_values\".\"tinyorm_value_0\", "
+                 "\"size\" = \"tinyorm_update_values\".\"tinyorm_value_1\" "
+             "from ((select \"id\", \"name\", \"size\" from \"torrents\" limit 0) "
+                   "union all values (?, ?, ?), (?, ?, ?)) "
+             "as \"tinyorm_update_values\" "
+                 "(\"tinyorm_key\", \"tinyorm_value_0\", \"tinyorm_value_1\") "
+             "where \"torrents\".\"id\" = \"tinyorm_update_values\".\"tinyorm_key\" "
+               "and (\"user_id\" = ? and \"id\" in (?, ?))");
+    QCOMPARE(firstLog.boundValues,
+             QList<QVariant>({QVariant(1), QVariant("xyz"), QVariant(11),
+                              QVariant(2), QVariant("abc"), QVariant(12),
+                              QVariant(1), QVariant(1),     QVariant(2)}));
+}
+
 void tst_PostgreSQL_QueryBuilder::upsert() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
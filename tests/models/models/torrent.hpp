@@ -36,6 +36,8 @@ using Orm::Constants::SPACE_IN;
 
 using Orm::Tiny::Model;
 using Orm::Tiny::Relations::Pivot;
+using Orm::Tiny::TypedColumn;
+using Orm::Tiny::TypedColumns;
 //using Orm::Tiny::SoftDeletes;
 
 #ifdef PROJECT_TINYORM_PLAYGROUND
@@ -222,6 +224,12 @@ private:
 //        {"added_on", QDateTime({2021, 4, 1}, {15, 10, 10}, QtTimeZoneConfig::utc())},
 //    };
 
+    /*! The columns declared at compile-time (typed attributes access). */
+    using Columns = TypedColumns<TypedColumn<"id",       quint64>,
+                                 TypedColumn<"name",     QString>,
+                                 TypedColumn<"size",     quint64>,
+                                 TypedColumn<"progress", int>>;
+
     /*! The attributes that are mass assignable. */
     inline static const QStringList u_fillable { // NOLINT(cppcoreguidelines-interfaces-global-init)
         ID,
@@ -14,6 +14,7 @@ headersList += \
     $$PWD/tom/commands/aboutcommand.hpp \
     $$PWD/tom/commands/command.hpp \
     $$PWD/tom/commands/completecommand.hpp \
+    $$PWD/tom/commands/database/rebuildcounterscommand.hpp \
     $$PWD/tom/commands/database/seedcommand.hpp \
     $$PWD/tom/commands/database/wipecommand.hpp \
     $$PWD/tom/commands/environmentcommand.hpp \
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef TOM_COMMANDS_DATABASE_REBUILDCOUNTERSCOMMAND_HPP
+#define TOM_COMMANDS_DATABASE_REBUILDCOUNTERSCOMMAND_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include "tom/commands/command.hpp"
+#include "tom/concerns/confirmable.hpp"
+#include "tom/concerns/pretendable.hpp"
+#include "tom/concerns/usingconnection.hpp"
+#include "tom/tomconstants.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom::Commands::Database
+{
+
+    /*! Recalculate the counter cache column from the related table. */
+    class RebuildCountersCommand : public Command,
+                                   public Concerns::Confirmable,
+                                   public Concerns::Pretendable,
+                                   public Concerns::UsingConnection
+    {
+        Q_DISABLE_COPY_MOVE(RebuildCountersCommand)
+
+        /*! Alias for the DatabaseConnection. */
+        using DatabaseConnection = Orm::DatabaseConnection;
+        /*! Alias for the Command. */
+        using Command = Commands::Command;
+
+    public:
+        /*! Constructor. */
+        RebuildCountersCommand(Application &application, QCommandLineParser &parser);
+        /*! Virtual destructor. */
+        ~RebuildCountersCommand() override = default;
+
+        /*! The console command name. */
+        inline QString name() const override;
+        /*! The console command description. */
+        inline QString description() const override;
+
+        /*! The console command positional arguments signature. */
+        const std::vector<PositionalArgument> &positionalArguments() const override;
+        /*! The signature of the console command. */
+        QList<CommandLineOption> optionsSignature() const override;
+
+        /*! Execute the console command. */
+        int run() override;
+
+    protected:
+        /*! Recalculate the counters of all owners, one update for every chunk. */
+        qint64 rebuildCounters(DatabaseConnection &connection) const;
+        /*! Get the correlated subquery counting the related rows of the owner. */
+        QString countSubquery(DatabaseConnection &connection) const;
+
+        /*! Get the counter cache column name. */
+        QString counterColumn() const;
+        /*! Get the chunk size (the number of owners updated by one statement). */
+        qint64 chunkSize() const;
+    };
+
+    /* public */
+
+    QString RebuildCountersCommand::name() const
+    {
+        return Constants::DbRebuildCounters;
+    }
+
+    QString RebuildCountersCommand::description() const
+    {
+        return QStringLiteral("Recalculate the counter cache column from the related "
+                              "table");
+    }
+
+} // namespace Tom::Commands::Database
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_COMMANDS_DATABASE_REBUILDCOUNTERSCOMMAND_HPP
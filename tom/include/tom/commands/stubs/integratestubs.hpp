@@ -153,8 +153,8 @@ _tom()
 
     # Inaccurate completion if the tom command is not on the system path, it doesn't
     # provide all options
-    commands='env help inspire integrate list migrate db:seed db:wipe
-        make:migration make:model make:seeder migrate:fresh migrate:install
+    commands='env help inspire integrate list migrate db:rebuild-counters db:seed
+        db:wipe make:migration make:model make:seeder migrate:fresh migrate:install
         migrate:refresh migrate:reset migrate:rollback migrate:status
         migrate:uninstall'
 
@@ -219,6 +219,7 @@ __tom_commands() {
         'integrate:Enable tab-completion for the given shell'
         'list:List commands'
         'migrate:Run the database migrations'
+        'db\:rebuild-counters:Recalculate the counter cache columns'
         'db\:seed:Seed the database with records'
         'db\:wipe:Drop all tables, views, and types'
         'make\:migration:Create a new migration file'
@@ -383,6 +384,21 @@ _tom() {
                 '--step[Force the migrations to be run so they can be rolled back individually]'
             ;;
 
+        db:rebuild-counters)
+            _arguments \
+                $common_options \
+                '1:owner table name:()' \
+                '2:related table name:()' \
+                '3:foreign key name:()' \
+                '--column=[The counter cache column on the owner table \[default: "<related>_count"\]]:column name' \
+                '--owner-key=[The owner key referenced by the foreign key \[default: "id"\]]:column name' \
+                '--deleted-at=[Count only the related rows with the NULL in this column]:column name' \
+                '--chunk=[The number of owner rows updated by one statement \[default: 1000\]]:chunk size' \
+                '--database=[The database connection to use]:connection:__tom_connections' \
+                '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
+                '--pretend[Dump the SQL queries that would be run]'
+            ;;
+
         db:seed)
             _arguments \
                 $common_options \
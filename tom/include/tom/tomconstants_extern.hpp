@@ -44,6 +44,9 @@ namespace Tom::Constants
     // list
     TINYORM_EXPORT extern const QString namespace_;
     TINYORM_EXPORT extern const QString shell_;
+    // db:rebuild-counters
+    TINYORM_EXPORT extern const QString owner_;
+    TINYORM_EXPORT extern const QString related_;
 
     // Commands' options
     // Used by more commands
@@ -92,6 +95,10 @@ namespace Tom::Constants
     TINYORM_EXPORT extern const QString hidden_up;
     TINYORM_EXPORT extern const QString accessors_up;
     TINYORM_EXPORT extern const QString appends_up;
+    TINYORM_EXPORT extern const QString column_up;
+    TINYORM_EXPORT extern const QString owner_key_up;
+    TINYORM_EXPORT extern const QString deleted_at_up;
+    TINYORM_EXPORT extern const QString chunk_up;
     TINYORM_EXPORT extern const QString only_up;
     // complete
     TINYORM_EXPORT extern const QString commandline;
@@ -100,6 +107,11 @@ namespace Tom::Constants
     TINYORM_EXPORT extern const QString cword_;
     // list
     TINYORM_EXPORT extern const QString raw_;
+    // db:rebuild-counters
+    TINYORM_EXPORT extern const QString column_;
+    TINYORM_EXPORT extern const QString owner_key;
+    TINYORM_EXPORT extern const QString deleted_at;
+    TINYORM_EXPORT extern const QString chunk_;
     // db:seed
     TINYORM_EXPORT extern const QString class_;
     // db:wipe
@@ -167,6 +179,7 @@ namespace Tom::Constants
     // Command names
     TINYORM_EXPORT extern const QString About;
     TINYORM_EXPORT extern const QString Complete;
+    TINYORM_EXPORT extern const QString DbRebuildCounters;
     TINYORM_EXPORT extern const QString DbSeed;
     TINYORM_EXPORT extern const QString DbWipe;
     TINYORM_EXPORT extern const QString Inspire;
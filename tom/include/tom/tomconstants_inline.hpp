@@ -43,6 +43,9 @@ namespace Tom::Constants
     // list
     inline const QString namespace_   = QStringLiteral("namespace");
     inline const QString shell_       = QStringLiteral("shell");
+    // db:rebuild-counters
+    inline const QString owner_       = QStringLiteral("owner");
+    inline const QString related_     = QStringLiteral("related");
 
     // Commands' options
     // Used by more commands
@@ -91,6 +94,10 @@ namespace Tom::Constants
     inline const QString hidden_up          = QStringLiteral("HIDDEN");
     inline const QString accessors_up       = QStringLiteral("ACCESSORS");
     inline const QString appends_up         = QStringLiteral("APPENDS");
+    inline const QString column_up          = QStringLiteral("COLUMN");
+    inline const QString owner_key_up       = QStringLiteral("OWNERKEY");
+    inline const QString deleted_at_up      = QStringLiteral("DELETEDAT");
+    inline const QString chunk_up           = QStringLiteral("CHUNK");
     inline const QString only_up            = QStringLiteral("ONLY");
     // complete
     inline const QString commandline        = QStringLiteral("commandline");
@@ -99,6 +106,11 @@ namespace Tom::Constants
     inline const QString cword_             = QStringLiteral("cword");
     // list
     inline const QString raw_               = QStringLiteral("raw");
+    // db:rebuild-counters
+    inline const QString column_            = QStringLiteral("column");
+    inline const QString owner_key          = QStringLiteral("owner-key");
+    inline const QString deleted_at         = QStringLiteral("deleted-at");
+    inline const QString chunk_             = QStringLiteral("chunk");
     // db:seed
     inline const QString class_             = QStringLiteral("class");
     // db:wipe
@@ -165,27 +177,28 @@ namespace Tom::Constants
     inline const QString ShZsh        = QStringLiteral("zsh");
 
     // Command names
-    inline const QString About            = QStringLiteral("about");
-    inline const QString Complete         = QStringLiteral("complete");
-    inline const QString DbSeed           = QStringLiteral("db:seed");
-    inline const QString DbWipe           = QStringLiteral("db:wipe");
-    inline const QString Inspire          = QStringLiteral("inspire");
-    inline const QString List             = QStringLiteral("list");
-    inline const QString &Env             = Tom::Constants::env;
-    inline const QString &Help            = Tom::Constants::help;
-    inline const QString MakeMigration    = QStringLiteral("make:migration");
-    inline const QString MakeModel        = QStringLiteral("make:model");
-    inline const QString MakeProject      = QStringLiteral("make:project");
-    inline const QString MakeSeeder       = QStringLiteral("make:seeder");
-    inline const QString &Migrate         = Tom::Constants::NsMigrate;
-    inline const QString MigrateFresh     = QStringLiteral("migrate:fresh");
-    inline const QString MigrateInstall   = QStringLiteral("migrate:install");
-    inline const QString MigrateRollback  = QStringLiteral("migrate:rollback");
-    inline const QString MigrateRefresh   = QStringLiteral("migrate:refresh");
-    inline const QString MigrateReset     = QStringLiteral("migrate:reset");
-    inline const QString MigrateStatus    = QStringLiteral("migrate:status");
-    inline const QString MigrateUninstall = QStringLiteral("migrate:uninstall");
-    inline const QString Integrate        = QStringLiteral("integrate");
+    inline const QString About             = QStringLiteral("about");
+    inline const QString Complete          = QStringLiteral("complete");
+    inline const QString DbRebuildCounters = QStringLiteral("db:rebuild-counters");
+    inline const QString DbSeed            = QStringLiteral("db:seed");
+    inline const QString DbWipe            = QStringLiteral("db:wipe");
+    inline const QString Inspire           = QStringLiteral("inspire");
+    inline const QString List              = QStringLiteral("list");
+    inline const QString &Env              = Tom::Constants::env;
+    inline const QString &Help             = Tom::Constants::help;
+    inline const QString MakeMigration     = QStringLiteral("make:migration");
+    inline const QString MakeModel         = QStringLiteral("make:model");
+    inline const QString MakeProject       = QStringLiteral("make:project");
+    inline const QString MakeSeeder        = QStringLiteral("make:seeder");
+    inline const QString &Migrate          = Tom::Constants::NsMigrate;
+    inline const QString MigrateFresh      = QStringLiteral("migrate:fresh");
+    inline const QString MigrateInstall    = QStringLiteral("migrate:install");
+    inline const QString MigrateRollback   = QStringLiteral("migrate:rollback");
+    inline const QString MigrateRefresh    = QStringLiteral("migrate:refresh");
+    inline const QString MigrateReset      = QStringLiteral("migrate:reset");
+    inline const QString MigrateStatus     = QStringLiteral("migrate:status");
+    inline const QString MigrateUninstall  = QStringLiteral("migrate:uninstall");
+    inline const QString Integrate         = QStringLiteral("integrate");
 
 } // namespace Tom::Constants
 
@@ -9,6 +9,7 @@ sourcesList += \
     $$PWD/tom/commands/aboutcommand.cpp \
     $$PWD/tom/commands/command.cpp \
     $$PWD/tom/commands/completecommand.cpp \
+    $$PWD/tom/commands/database/rebuildcounterscommand.cpp \
     $$PWD/tom/commands/database/seedcommand.cpp \
     $$PWD/tom/commands/database/wipecommand.cpp \
     $$PWD/tom/commands/environmentcommand.cpp \
@@ -31,6 +31,7 @@
 
 #include "tom/commands/aboutcommand.hpp"
 #include "tom/commands/completecommand.hpp"
+#include "tom/commands/database/rebuildcounterscommand.hpp"
 #include "tom/commands/database/seedcommand.hpp"
 #include "tom/commands/database/wipecommand.hpp"
 #include "tom/commands/environmentcommand.hpp"
@@ -90,6 +91,7 @@ using TypeUtils = Orm::Utils::Type;
 using Tom::Commands::AboutCommand;
 using Tom::Commands::Command;
 using Tom::Commands::CompleteCommand;
+using Tom::Commands::Database::RebuildCountersCommand;
 using Tom::Commands::Database::SeedCommand;
 using Tom::Commands::Database::WipeCommand;
 using Tom::Commands::EnvironmentCommand;
@@ -112,6 +114,7 @@ using Tom::Commands::Migrations::UninstallCommand;
 
 using Tom::Constants::About;
 using Tom::Constants::Complete;
+using Tom::Constants::DbRebuildCounters;
 using Tom::Constants::DbSeed;
 using Tom::Constants::DbWipe;
 using Tom::Constants::Env;
@@ -610,6 +613,9 @@ Application::createCommand(const QString &command, const OptionalParserRef parse
     if (command == Complete)
         return std::make_unique<CompleteCommand>(*this, parserRef);
 
+    if (command == DbRebuildCounters)
+        return std::make_unique<RebuildCountersCommand>(*this, parserRef);
+
     if (command == DbSeed)
         return std::make_unique<SeedCommand>(*this, parserRef);
 
@@ -763,7 +769,7 @@ Application::commandNames()
         // global namespace
         About, Complete, Env, Help, Inspire, Integrate, List, Migrate,
         // db
-        DbSeed, DbWipe,
+        DbRebuildCounters, DbSeed, DbWipe,
         // make
         MakeMigration, MakeModel, /*MakeProject,*/ MakeSeeder,
         // migrate
@@ -809,11 +815,11 @@ const std::vector<std::tuple<int, int>> &Application::commandsIndexes()
     static const std::vector<std::tuple<int, int>> cached {
         {0,   8}, // "" - also global
         {0,   8}, // global
-        {8,  10}, // db
-        {10, 13}, // make
-        {13, 20}, // migrate
-        {8,  20}, // namespaced
-        {0,  20}, // all
+        {8,  11}, // db
+        {11, 14}, // make
+        {14, 21}, // migrate
+        {8,  21}, // namespaced
+        {0,  21}, // all
     };
 
     return cached;
@@ -0,0 +1,199 @@
+#include "tom/commands/database/rebuildcounterscommand.hpp"
+
+#include <QCommandLineParser>
+
+#include <orm/databaseconnection.hpp>
+#include <orm/query/querybuilder.hpp>
+
+#include "tom/exceptions/invalidargumenterror.hpp"
+#include "tom/tomconstants.hpp"
+
+#ifndef sl
+/*! Alias for the QStringLiteral(). */
+#  define sl(str) QStringLiteral(str)
+#endif
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::DOT_IN;
+using Orm::Constants::EQ;
+using Orm::Constants::ID;
+using Orm::Constants::database_;
+
+using Orm::Query::Expression;
+using Orm::UpdateItem;
+using Orm::Types::SqlQuery;
+
+using Tom::Constants::chunk_;
+using Tom::Constants::chunk_up;
+using Tom::Constants::column_;
+using Tom::Constants::column_up;
+using Tom::Constants::database_up;
+using Tom::Constants::deleted_at;
+using Tom::Constants::deleted_at_up;
+using Tom::Constants::force;
+using Tom::Constants::foreign_key;
+using Tom::Constants::owner_;
+using Tom::Constants::owner_key;
+using Tom::Constants::owner_key_up;
+using Tom::Constants::pretend;
+using Tom::Constants::related_;
+
+namespace Tom::Commands::Database
+{
+
+/* public */
+
+RebuildCountersCommand::RebuildCountersCommand(Application &application,
+                                               QCommandLineParser &parser)
+    : Command(application, parser)
+    , Concerns::UsingConnection(connectionResolver())
+{}
+
+const std::vector<PositionalArgument> &
+RebuildCountersCommand::positionalArguments() const
+{
+    static const std::vector<PositionalArgument> cached {
+        {owner_,      sl("The owner table name with the counter cache column")},
+        {related_,    sl("The related (counted) table name")},
+        {foreign_key, sl("The foreign key on the related table")},
+    };
+
+    return cached;
+}
+
+QList<CommandLineOption> RebuildCountersCommand::optionsSignature() const
+{
+    return {
+        {column_,      sl("The counter cache column on the owner table "
+                          "<comment>(default: <related>_count)</comment>"),
+                       column_up}, // Value
+        {owner_key,    sl("The owner key referenced by the foreign key"), owner_key_up,
+                       ID}, // Value
+        {deleted_at,   sl("Count only the related rows with the NULL in this column"),
+                       deleted_at_up}, // Value
+        {chunk_,       sl("The number of owner rows updated by one statement"),
+                       chunk_up, sl("1000")}, // Value
+        {database_,    sl("The database connection to use <comment>(multiple values "
+                          "allowed)</comment>"), database_up}, // Value
+
+        {{QChar('f'),
+          force},      sl("Force the operation to run when in production")},
+        {pretend,      sl("Dump the SQL queries that would be run")},
+    };
+}
+
+int RebuildCountersCommand::run()
+{
+    Command::run();
+
+    // Ask for confirmation in the production environment
+    if (!confirmToProceed())
+        return EXIT_FAILURE;
+
+    // Database connection to use (multiple connections supported)
+    return usingConnections(values(database_), isDebugVerbosity(),
+                            [this](const QString &database)
+    {
+        auto &connection = this->connection(database);
+
+        /* The owners can't be selected in the pretend mode, so show one update
+           statement for all owners instead of the update for every chunk. */
+        if (isSet(pretend)) {
+            optionalPretend(true, connection, [this](auto &connection_)
+            {
+                connection_.table(argument(owner_))
+                          ->update({{counterColumn(),
+                                     Expression(countSubquery(connection_))}});
+            });
+
+            return EXIT_SUCCESS;
+        }
+
+        const auto owners = rebuildCounters(connection);
+
+        info(QStringLiteral("Rebuilt the '%1' counter of %2 '%3' rows successfully.")
+             .arg(counterColumn()).arg(owners).arg(argument(owner_)));
+
+        return EXIT_SUCCESS;
+    });
+}
+
+/* protected */
+
+qint64 RebuildCountersCommand::rebuildCounters(DatabaseConnection &connection) const
+{
+    const auto owner = argument(owner_);
+    const auto ownerKey = value(owner_key);
+
+    const QList<UpdateItem> counter {
+        {counterColumn(), Expression(countSubquery(connection))},
+    };
+
+    const auto chunkSize = this->chunkSize();
+    qint64 owners = 0;
+
+    /* Every chunk of owners is updated by one statement in its own implicit
+       transaction, so the locks are held only for one chunk at a time. */
+    connection.table(owner)->select(ownerKey)
+            .chunkById(chunkSize, [&connection, &owner, &ownerKey, &counter, chunkSize,
+                                   &owners](SqlQuery &results, const qint64 /*unused*/)
+    {
+        QList<QVariant> ids;
+        ids.reserve(chunkSize);
+
+        while (results.next())
+            ids << results.value(ownerKey);
+
+        connection.table(owner)->whereIn(ownerKey, ids).update(counter);
+
+        owners += ids.size();
+
+        return true;
+    },
+        ownerKey);
+
+    return owners;
+}
+
+QString RebuildCountersCommand::countSubquery(DatabaseConnection &connection) const
+{
+    const auto owner = argument(owner_);
+    const auto related = argument(related_);
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto query = connection.table(related);
+
+    query->selectRaw(sl("count(*)"))
+           .whereColumn(DOT_IN.arg(related, argument(foreign_key)), EQ,
+                        DOT_IN.arg(owner, value(owner_key)));
+
+    // Don't count the soft deleted rows
+    if (const auto deletedAt = value(deleted_at); !deletedAt.isEmpty())
+        query->whereNull(DOT_IN.arg(related, deletedAt));
+
+    return sl("(%1)").arg(query->toSql());
+}
+
+QString RebuildCountersCommand::counterColumn() const
+{
+    if (auto column = value(column_); !column.isEmpty())
+        return column;
+
+    return sl("%1_count").arg(argument(related_));
+}
+
+qint64 RebuildCountersCommand::chunkSize() const
+{
+    // Validation needed as the toLongLong() returns 0 if conversion fails
+    if (const auto chunkSize = value(chunk_).toLongLong(); chunkSize > 0)
+        return chunkSize;
+
+    throw Exceptions::InvalidArgumentError(
+                sl("The --chunk option must be a positive number, '%1' given.")
+                .arg(value(chunk_)));
+}
+
+} // namespace Tom::Commands::Database
+
+TINYORM_END_COMMON_NAMESPACE
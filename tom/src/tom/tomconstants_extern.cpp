@@ -32,6 +32,9 @@ namespace Tom::Constants
     // list
     const QString namespace_   = QStringLiteral("namespace");
     const QString shell_       = QStringLiteral("shell");
+    // db:rebuild-counters
+    const QString owner_       = QStringLiteral("owner");
+    const QString related_     = QStringLiteral("related");
 
     // Commands' options
     // Used by more commands
@@ -80,6 +83,10 @@ namespace Tom::Constants
     const QString hidden_up          = QStringLiteral("HIDDEN");
     const QString accessors_up       = QStringLiteral("ACCESSORS");
     const QString appends_up         = QStringLiteral("APPENDS");
+    const QString column_up          = QStringLiteral("COLUMN");
+    const QString owner_key_up       = QStringLiteral("OWNERKEY");
+    const QString deleted_at_up      = QStringLiteral("DELETEDAT");
+    const QString chunk_up           = QStringLiteral("CHUNK");
     const QString only_up            = QStringLiteral("ONLY");
     // complete
     const QString commandline        = QStringLiteral("commandline");
@@ -88,6 +95,11 @@ namespace Tom::Constants
     const QString cword_             = QStringLiteral("cword");
     // list
     const QString raw_               = QStringLiteral("raw");
+    // db:rebuild-counters
+    const QString column_            = QStringLiteral("column");
+    const QString owner_key          = QStringLiteral("owner-key");
+    const QString deleted_at         = QStringLiteral("deleted-at");
+    const QString chunk_             = QStringLiteral("chunk");
     // db:seed
     const QString class_             = QStringLiteral("class");
     // db:wipe
@@ -154,27 +166,28 @@ namespace Tom::Constants
     const QString ShZsh        = QStringLiteral("zsh");
 
     // Command names
-    const QString About            = QStringLiteral("about");
-    const QString Complete         = QStringLiteral("complete");
-    const QString DbSeed           = QStringLiteral("db:seed");
-    const QString DbWipe           = QStringLiteral("db:wipe");
-    const QString Inspire          = QStringLiteral("inspire");
-    const QString List             = QStringLiteral("list");
-    const QString &Env             = Tom::Constants::env;
-    const QString &Help            = Tom::Constants::help;
-    const QString MakeMigration    = QStringLiteral("make:migration");
-    const QString MakeModel        = QStringLiteral("make:model");
-    const QString MakeProject      = QStringLiteral("make:project");
-    const QString MakeSeeder       = QStringLiteral("make:seeder");
-    const QString &Migrate         = Tom::Constants::NsMigrate;
-    const QString MigrateFresh     = QStringLiteral("migrate:fresh");
-    const QString MigrateInstall   = QStringLiteral("migrate:install");
-    const QString MigrateRollback  = QStringLiteral("migrate:rollback");
-    const QString MigrateRefresh   = QStringLiteral("migrate:refresh");
-    const QString MigrateReset     = QStringLiteral("migrate:reset");
-    const QString MigrateStatus    = QStringLiteral("migrate:status");
-    const QString MigrateUninstall = QStringLiteral("migrate:uninstall");
-    const QString Integrate        = QStringLiteral("integrate");
+    const QString About             = QStringLiteral("about");
+    const QString Complete          = QStringLiteral("complete");
+    const QString DbRebuildCounters = QStringLiteral("db:rebuild-counters");
+    const QString DbSeed            = QStringLiteral("db:seed");
+    const QString DbWipe            = QStringLiteral("db:wipe");
+    const QString Inspire           = QStringLiteral("inspire");
+    const QString List              = QStringLiteral("list");
+    const QString &Env              = Tom::Constants::env;
+    const QString &Help             = Tom::Constants::help;
+    const QString MakeMigration     = QStringLiteral("make:migration");
+    const QString MakeModel         = QStringLiteral("make:model");
+    const QString MakeProject       = QStringLiteral("make:project");
+    const QString MakeSeeder        = QStringLiteral("make:seeder");
+    const QString &Migrate          = Tom::Constants::NsMigrate;
+    const QString MigrateFresh      = QStringLiteral("migrate:fresh");
+    const QString MigrateInstall    = QStringLiteral("migrate:install");
+    const QString MigrateRollback   = QStringLiteral("migrate:rollback");
+    const QString MigrateRefresh    = QStringLiteral("migrate:refresh");
+    const QString MigrateReset      = QStringLiteral("migrate:reset");
+    const QString MigrateStatus     = QStringLiteral("migrate:status");
+    const QString MigrateUninstall  = QStringLiteral("migrate:uninstall");
+    const QString Integrate         = QStringLiteral("integrate");
 
 } // namespace Tom::Constants
 